@@ -7,9 +7,12 @@ import android.view.View
 import com.snapchat.djinni.benchmark.DjinniPerfBenchmark
 import com.snapchat.djinni.benchmark.EnumSixValue
 import com.snapchat.djinni.benchmark.ObjectPlatform
+import com.snapchat.djinni.benchmark.ObjectPlatformUncached
 import com.snapchat.djinni.benchmark.RecordSixInt
 import java.io.File
 import java.nio.ByteBuffer
+import java.util.concurrent.CyclicBarrier
+import java.util.concurrent.atomic.AtomicBoolean
 import kotlin.math.roundToInt
 import kotlin.math.roundToLong
 
@@ -18,6 +21,11 @@ internal class ObjectPlatformImpl : ObjectPlatform() {
     }
 }
 
+internal class ObjectPlatformUncachedImpl : ObjectPlatformUncached() {
+    override fun onDone() {
+    }
+}
+
 class MainActivity : Activity() {
 
     val tag = "djinni_perf_benchmark"
@@ -87,6 +95,36 @@ class MainActivity : Activity() {
         Log.i(tag, "${name.padEnd(21)},${average.toString().padStart(8)},${sd.toString().padStart(8)},${min.toString().padStart(8)},${p50.toString().padStart(8)},${p90.toString().padStart(8)},${max.toString().padStart(8)}");
     }
 
+    // Runs `lambda` `times` times on each of `threads` threads concurrently and reports the
+    // aggregate throughput. The lambda receives the index of the thread it runs on.
+    private fun measureConcurrent(name: String, threads: Int,
+                                  lambda: (Int) -> Unit, times: Int = 10000) {
+        val barrier = CyclicBarrier(threads + 1)
+        val workers = List(threads) { t ->
+            Thread {
+                barrier.await()
+                repeat (times) { lambda(t) }
+            }
+        }
+        workers.forEach { it.start() }
+        val t1 = System.nanoTime()
+        barrier.await()
+        workers.forEach { it.join() }
+        val t2 = System.nanoTime()
+
+        val ops = threads.toLong() * times
+        val opsPerSec = (ops * 1e9 / (t2 - t1)).roundToLong()
+        val nsPerOp = ((t2 - t1).toDouble() / ops).roundToLong()
+
+        Log.i(tag, "${name.padEnd(21)},${threads.toString().padStart(8)},${opsPerSec.toString().padStart(10)},${nsPerOp.toString().padStart(8)}");
+    }
+
+    // Repeats `unit` to make a string of about `bytes` bytes of UTF-8.
+    private fun utf8String(unit: String, bytes: Int): String {
+        val unitBytes = unit.toByteArray(Charsets.UTF_8).size
+        return unit.repeat(maxOf(1, bytes / unitBytes))
+    }
+
     private fun runTestSuitePerf(dpb: DjinniPerfBenchmark) {
         val minCount = 16 // Note hard-coded string below of this size
         val lowCount = 128
@@ -127,6 +165,18 @@ class MainActivity : Activity() {
         for (i in 0..hugeCount / highCount) sg = sg + sh
         measure("argString " + hugeCount, {dpb.argString(sg)})
 
+        // roundTripString converts its argument both ways, so subtracting argString leaves the
+        // C++ to Java direction.
+        val scripts = listOf("ascii" to "abcdefgh", "latin1" to "déjà vu ", "cjk" to "汉字",
+                             "emoji" to "\uD83D\uDE00\uD83D\uDC4D") // 😀👍
+        for ((script, unit) in scripts) {
+            for (count in listOf(minCount, highCount, hugeCount)) {
+                val su = utf8String(unit, count)
+                measure("argString " + script + " " + count, {dpb.argString(su)})
+                measure("roundTrip " + script + " " + count, {val rt = dpb.roundTripString(su)})
+            }
+        }
+
         for (count in listOf(lowCount, highCount, hugeCount)) {
             val ba = ByteArray(count, { it.toByte() })
             measure("argBinary " + count, {dpb.argBinary(ba)})
@@ -135,6 +185,11 @@ class MainActivity : Activity() {
         val e = EnumSixValue.FIRST
         measure("argEnumSixValue", {dpb.argEnumSixValue(e)})
 
+        for (count in listOf(1, 8, 32)) {
+            val f = dpb.returnFlagsThirtyTwoValue(count)
+            measure("argFlagsThirtyTwoValue " + count, {dpb.argFlagsThirtyTwoValue(f)})
+        }
+
         val r = RecordSixInt(1,2,3,4,5,6)
         measure("argRecordSixInt", {dpb.argRecordSixInt(r)})
 
@@ -148,19 +203,43 @@ class MainActivity : Activity() {
         val o = ObjectPlatformImpl()
         measure("argObject", {dpb.argObject(o)})
 
+        val ou = ObjectPlatformUncachedImpl()
+        measure("argObjectUncached", {dpb.argObjectUncached(ou)})
+
+        // The count of 1 is dominated by starting the thread and attaching it to the VM; the
+        // larger ones by the callbacks themselves.
+        for (count in listOf(1, lowCount, highCount)) {
+            measure("callObjectFromThread " + count, {dpb.callObjectFromThread(o, count)}, 100)
+        }
+
         val lo = ArrayList<ObjectPlatform>(lowCount)
         for (i in 0..lowCount - 1) lo.add(ObjectPlatformImpl())
         measure("argListObject " + lowCount, {dpb.argListObject(lo)})
 
+        val lh = ArrayList<ObjectPlatform>(List(20) { o })
+        measure("argListObject hit95", {dpb.argListObject(lh)})
+
         val lr = ArrayList<RecordSixInt>(lowCount)
         for (i in 0..lowCount - 1) lr.add(RecordSixInt(1, 2, 3, 4, 5, 6))
         measure("argListRecord " + lowCount, {dpb.argListRecord(lr)})
 
+        // Wider all-i64 records, built on the C++ side to spare spelling out 64 fields here.
+        val lr16 = dpb.returnListRecordSixteenInt(lowCount)
+        measure("argListRecordSixteenInt " + lowCount, {dpb.argListRecordSixteenInt(lr16)})
+
+        val lr64 = dpb.returnListRecordSixtyFourInt(lowCount)
+        measure("argListRecordSixtyFourInt " + lowCount, {dpb.argListRecordSixtyFourInt(lr64)})
+
         val ar = ArrayList<RecordSixInt>(lowCount)
         for (i in 0..lowCount - 1) ar.add(RecordSixInt(1, 2, 3, 4, 5, 6))
         measure("argArrayRecord " + lowCount, {dpb.argArrayRecord(ar)})
 
         measure("returnInt", {val ri = dpb.returnInt(42)})
+        measure("returnEnumSixValue", {val re = dpb.returnEnumSixValue()})
+
+        for (count in listOf(1, 8, 32)) {
+            measure("returnFlagsThirtyTwoValue " + count, {val rf = dpb.returnFlagsThirtyTwoValue(count)})
+        }
 
         for (count in listOf(1, 10, lowCount)) {
             measure("returnListInt " + count, { val rli = dpb.returnListInt(count)})
@@ -170,15 +249,33 @@ class MainActivity : Activity() {
             measure("returnArrayInt " + count, { val rai = dpb.returnArrayInt(count)})
         }
 
+        for (count in listOf(16, 1000, 100000)) {
+            val times = if (count > 1000) 20 else 1000
+            val m = dpb.returnMapStringInt(count)
+            measure("argMapStringInt " + count, {dpb.argMapStringInt(m)}, times)
+            measure("returnMapStringInt " + count, {val rm = dpb.returnMapStringInt(count)}, times)
+            val s = dpb.returnSetString(count)
+            measure("argSetString " + count, {dpb.argSetString(s)}, times)
+            measure("returnSetString " + count, {val rs = dpb.returnSetString(count)}, times)
+        }
+
         for (count in listOf(minCount, lowCount, highCount, hugeCount)) {
             measure("returnString " + count, { val rs = dpb.returnString(count)})
         }
 
+        // Cycles through 32 distinct short strings. The interned variant is handed out by the
+        // JNI string cache after its first round, so it skips transcoding and allocation.
+        var si = 0
+        measure("returnShortString 32", { val rs = dpb.returnShortString(si++)}, 100000)
+        measure("returnInternedString 32", { val rs = dpb.returnInternedString(si++)}, 100000)
+
         for (count in listOf(lowCount, highCount, hugeCount)) {
             measure("returnBinary " + count, { val rb = dpb.returnBinary(count)})
+            measure("returnBinaryBuffer " + count, { val rb = dpb.returnBinaryBuffer(count)})
         }
 
         measure("returnObject", { val ro = dpb.returnObject()})
+        measure("returnObjectUncached", { val rou = dpb.returnObjectUncached()})
 
         for (count in listOf(10, 100)) {
             measure("returnListObject " + count, { val rlo = dpb.returnListObject(count)})
@@ -188,11 +285,92 @@ class MainActivity : Activity() {
             measure("returnListRecord " + count, { val rlr = dpb.returnListRecord(count)})
         }
 
+        for (count in listOf(1, 10, lowCount)) {
+            measure("returnListRecordSixteenInt " + count, { val rlr = dpb.returnListRecordSixteenInt(count)})
+        }
+
+        for (count in listOf(1, 10, lowCount)) {
+            measure("returnListRecordSixtyFourInt " + count, { val rlr = dpb.returnListRecordSixtyFourInt(count)})
+        }
+
         for (count in listOf(1, 10, lowCount)) {
             measure("returnArrayRecord " + count, { val rar = dpb.returnArrayRecord(count)})
         }
     }
 
+    // Proxy cache contention: every thread passes its own objects across the boundary, so
+    // throughput should grow with the thread count as long as the lookups don't serialize.
+    private fun runTestSuiteConcurrency(dpb: DjinniPerfBenchmark) {
+        val listCount = 16
+        val maxThreads = Runtime.getRuntime().availableProcessors()
+        val objects = List(maxThreads) { ObjectPlatformImpl() }
+        val uncachedObjects = List(maxThreads) { ObjectPlatformUncachedImpl() }
+        val lists = List(maxThreads) { ArrayList<ObjectPlatform>(List(listCount) { ObjectPlatformImpl() }) }
+        // The same object 20 times: the first lookup creates the C++ proxy, which the list being
+        // marshalled keeps alive, so the other 19 (95%) are cache hits.
+        val hitLists = List(maxThreads) { val o = ObjectPlatformImpl(); ArrayList<ObjectPlatform>(List(20) { o }) }
+        // Keeps the Java proxy alive between calls so that every returnObject is a cache hit.
+        val held = dpb.returnObject()
+
+        Log.i(tag, "name                 , threads,     ops/s,   ns/op");
+
+        var threads = 1
+        while (threads <= maxThreads) {
+            measureConcurrent("argObject", threads, { t -> dpb.argObject(objects[t]) })
+            measureConcurrent("argObjectUncached", threads, { t -> dpb.argObjectUncached(uncachedObjects[t]) })
+            measureConcurrent("argListObject " + listCount, threads, { t -> dpb.argListObject(lists[t]) }, 1000)
+            measureConcurrent("argListObject hit95", threads, { t -> dpb.argListObject(hitLists[t]) }, 1000)
+            measureConcurrent("returnObject", threads, { _ -> dpb.returnObject() })
+            measureConcurrent("returnObjectUncached", threads, { _ -> dpb.returnObjectUncached() })
+            threads *= 2
+        }
+        held.baseline()
+    }
+
+    // Large binaries: copy throughput, and the longest stall seen meanwhile by another thread that
+    // keeps allocating, and so keeps needing the GC. Copies that pin the array hold the GC off
+    // until they finish, so that stall tracks the longest critical section.
+    private fun measureLargeCopy(name: String, bytes: Int, lambda: () -> Unit, times: Int) {
+        val running = AtomicBoolean(true)
+        var maxStall = 0L
+        val probe = Thread {
+            val garbage = arrayOfNulls<ByteArray>(16)
+            var i = 0
+            var last = System.nanoTime()
+            while (running.get()) {
+                garbage[i++ % garbage.size] = ByteArray(16 * 1024)
+                val now = System.nanoTime()
+                maxStall = maxOf(maxStall, now - last)
+                last = now
+            }
+        }
+        probe.start()
+        lambda() // warm up
+        val t1 = System.nanoTime()
+        repeat (times) { lambda() }
+        val t2 = System.nanoTime()
+        running.set(false)
+        probe.join()
+
+        val mibPerSec = (bytes.toLong() * times * 1e9 / (t2 - t1) / (1024 * 1024)).roundToLong()
+        Log.i(tag, "${name.padEnd(21)},${mibPerSec.toString().padStart(8)},${(maxStall / 1000).toString().padStart(10)}");
+    }
+
+    private fun runTestSuiteLargeCopies(dpb: DjinniPerfBenchmark) {
+        Log.i(tag, "name                 ,   MiB/s, stall (us)");
+
+        for ((label, bytes) in listOf("4K" to 4 * 1024, "1M" to 1024 * 1024, "64M" to 64 * 1024 * 1024)) {
+            val times = maxOf(4, 256 * 1024 * 1024 / bytes)
+            val ba = ByteArray(bytes, { it.toByte() })
+            measureLargeCopy("argBinary " + label, bytes, {dpb.argBinary(ba)}, times)
+            measureLargeCopy("returnBinary " + label, bytes, {val rb = dpb.returnBinary(bytes)}, times)
+            measureLargeCopy("returnBinaryBuffer " + label, bytes, {val rb = dpb.returnBinaryBuffer(bytes)}, times)
+            val la = LongArray(bytes / 8) { it * 1L }
+            measureLargeCopy("argArrayInt " + label, bytes, {dpb.argArrayInt(la)}, times)
+            measureLargeCopy("returnArrayInt " + label, bytes, {val ra = dpb.returnArrayInt(bytes / 8)}, times)
+        }
+    }
+
     private fun roundTrip(dpb: DjinniPerfBenchmark, testValue: String) {
         val outputValue = dpb.roundTripString(testValue)
         val good = outputValue == testValue
@@ -229,6 +407,8 @@ class MainActivity : Activity() {
         val dpb = DjinniPerfBenchmark.getInstance()
         if (dpb != null) {
             runTestSuitePerf(dpb)
+            runTestSuiteConcurrency(dpb)
+            runTestSuiteLargeCopies(dpb)
             runTestSuiteUTF(dpb)
         }
     }
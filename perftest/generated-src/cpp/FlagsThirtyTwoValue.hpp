@@ -0,0 +1,77 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include <functional>
+
+namespace snapchat::djinni::benchmark {
+
+enum class FlagsThirtyTwoValue : int32_t {
+    FLAG1 = 1 << 0,
+    FLAG2 = 1 << 1,
+    FLAG3 = 1 << 2,
+    FLAG4 = 1 << 3,
+    FLAG5 = 1 << 4,
+    FLAG6 = 1 << 5,
+    FLAG7 = 1 << 6,
+    FLAG8 = 1 << 7,
+    FLAG9 = 1 << 8,
+    FLAG10 = 1 << 9,
+    FLAG11 = 1 << 10,
+    FLAG12 = 1 << 11,
+    FLAG13 = 1 << 12,
+    FLAG14 = 1 << 13,
+    FLAG15 = 1 << 14,
+    FLAG16 = 1 << 15,
+    FLAG17 = 1 << 16,
+    FLAG18 = 1 << 17,
+    FLAG19 = 1 << 18,
+    FLAG20 = 1 << 19,
+    FLAG21 = 1 << 20,
+    FLAG22 = 1 << 21,
+    FLAG23 = 1 << 22,
+    FLAG24 = 1 << 23,
+    FLAG25 = 1 << 24,
+    FLAG26 = 1 << 25,
+    FLAG27 = 1 << 26,
+    FLAG28 = 1 << 27,
+    FLAG29 = 1 << 28,
+    FLAG30 = 1 << 29,
+    FLAG31 = 1 << 30,
+    FLAG32 = 1 << 31,
+};
+constexpr FlagsThirtyTwoValue operator|(FlagsThirtyTwoValue lhs, FlagsThirtyTwoValue rhs) noexcept {
+    return static_cast<FlagsThirtyTwoValue>(static_cast<int32_t>(lhs) | static_cast<int32_t>(rhs));
+}
+constexpr FlagsThirtyTwoValue& operator|=(FlagsThirtyTwoValue& lhs, FlagsThirtyTwoValue rhs) noexcept {
+    return lhs = lhs | rhs;
+}
+constexpr FlagsThirtyTwoValue operator&(FlagsThirtyTwoValue lhs, FlagsThirtyTwoValue rhs) noexcept {
+    return static_cast<FlagsThirtyTwoValue>(static_cast<int32_t>(lhs) & static_cast<int32_t>(rhs));
+}
+constexpr FlagsThirtyTwoValue& operator&=(FlagsThirtyTwoValue& lhs, FlagsThirtyTwoValue rhs) noexcept {
+    return lhs = lhs & rhs;
+}
+constexpr FlagsThirtyTwoValue operator^(FlagsThirtyTwoValue lhs, FlagsThirtyTwoValue rhs) noexcept {
+    return static_cast<FlagsThirtyTwoValue>(static_cast<int32_t>(lhs) ^ static_cast<int32_t>(rhs));
+}
+constexpr FlagsThirtyTwoValue& operator^=(FlagsThirtyTwoValue& lhs, FlagsThirtyTwoValue rhs) noexcept {
+    return lhs = lhs ^ rhs;
+}
+constexpr FlagsThirtyTwoValue operator~(FlagsThirtyTwoValue x) noexcept {
+    return static_cast<FlagsThirtyTwoValue>(~static_cast<int32_t>(x));
+}
+
+} // namespace snapchat::djinni::benchmark
+
+namespace std {
+
+template <>
+struct hash<::snapchat::djinni::benchmark::FlagsThirtyTwoValue> {
+    size_t operator()(::snapchat::djinni::benchmark::FlagsThirtyTwoValue type) const {
+        return std::hash<int32_t>()(static_cast<int32_t>(type));
+    }
+};
+
+} // namespace std
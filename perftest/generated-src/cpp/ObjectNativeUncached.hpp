@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+namespace snapchat::djinni::benchmark {
+
+/** same as ObjectNative, but without identity caching */
+class ObjectNativeUncached {
+public:
+    virtual ~ObjectNativeUncached() = default;
+
+    virtual void baseline() = 0;
+};
+
+} // namespace snapchat::djinni::benchmark
@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+namespace snapchat::djinni::benchmark {
+
+/** same as ObjectPlatform, but without identity caching */
+class ObjectPlatformUncached {
+public:
+    virtual ~ObjectPlatformUncached() = default;
+
+    virtual void onDone() = 0;
+};
+
+} // namespace snapchat::djinni::benchmark
@@ -0,0 +1,64 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+namespace snapchat::djinni::benchmark {
+
+struct RecordSixteenInt final {
+    int64_t i1;
+    int64_t i2;
+    int64_t i3;
+    int64_t i4;
+    int64_t i5;
+    int64_t i6;
+    int64_t i7;
+    int64_t i8;
+    int64_t i9;
+    int64_t i10;
+    int64_t i11;
+    int64_t i12;
+    int64_t i13;
+    int64_t i14;
+    int64_t i15;
+    int64_t i16;
+
+    RecordSixteenInt(int64_t i1_,
+                     int64_t i2_,
+                     int64_t i3_,
+                     int64_t i4_,
+                     int64_t i5_,
+                     int64_t i6_,
+                     int64_t i7_,
+                     int64_t i8_,
+                     int64_t i9_,
+                     int64_t i10_,
+                     int64_t i11_,
+                     int64_t i12_,
+                     int64_t i13_,
+                     int64_t i14_,
+                     int64_t i15_,
+                     int64_t i16_)
+    : i1(std::move(i1_))
+    , i2(std::move(i2_))
+    , i3(std::move(i3_))
+    , i4(std::move(i4_))
+    , i5(std::move(i5_))
+    , i6(std::move(i6_))
+    , i7(std::move(i7_))
+    , i8(std::move(i8_))
+    , i9(std::move(i9_))
+    , i10(std::move(i10_))
+    , i11(std::move(i11_))
+    , i12(std::move(i12_))
+    , i13(std::move(i13_))
+    , i14(std::move(i14_))
+    , i15(std::move(i15_))
+    , i16(std::move(i16_))
+    {}
+};
+
+} // namespace snapchat::djinni::benchmark
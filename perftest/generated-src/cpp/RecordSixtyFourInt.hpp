@@ -0,0 +1,208 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+namespace snapchat::djinni::benchmark {
+
+struct RecordSixtyFourInt final {
+    int64_t i1;
+    int64_t i2;
+    int64_t i3;
+    int64_t i4;
+    int64_t i5;
+    int64_t i6;
+    int64_t i7;
+    int64_t i8;
+    int64_t i9;
+    int64_t i10;
+    int64_t i11;
+    int64_t i12;
+    int64_t i13;
+    int64_t i14;
+    int64_t i15;
+    int64_t i16;
+    int64_t i17;
+    int64_t i18;
+    int64_t i19;
+    int64_t i20;
+    int64_t i21;
+    int64_t i22;
+    int64_t i23;
+    int64_t i24;
+    int64_t i25;
+    int64_t i26;
+    int64_t i27;
+    int64_t i28;
+    int64_t i29;
+    int64_t i30;
+    int64_t i31;
+    int64_t i32;
+    int64_t i33;
+    int64_t i34;
+    int64_t i35;
+    int64_t i36;
+    int64_t i37;
+    int64_t i38;
+    int64_t i39;
+    int64_t i40;
+    int64_t i41;
+    int64_t i42;
+    int64_t i43;
+    int64_t i44;
+    int64_t i45;
+    int64_t i46;
+    int64_t i47;
+    int64_t i48;
+    int64_t i49;
+    int64_t i50;
+    int64_t i51;
+    int64_t i52;
+    int64_t i53;
+    int64_t i54;
+    int64_t i55;
+    int64_t i56;
+    int64_t i57;
+    int64_t i58;
+    int64_t i59;
+    int64_t i60;
+    int64_t i61;
+    int64_t i62;
+    int64_t i63;
+    int64_t i64;
+
+    RecordSixtyFourInt(int64_t i1_,
+                       int64_t i2_,
+                       int64_t i3_,
+                       int64_t i4_,
+                       int64_t i5_,
+                       int64_t i6_,
+                       int64_t i7_,
+                       int64_t i8_,
+                       int64_t i9_,
+                       int64_t i10_,
+                       int64_t i11_,
+                       int64_t i12_,
+                       int64_t i13_,
+                       int64_t i14_,
+                       int64_t i15_,
+                       int64_t i16_,
+                       int64_t i17_,
+                       int64_t i18_,
+                       int64_t i19_,
+                       int64_t i20_,
+                       int64_t i21_,
+                       int64_t i22_,
+                       int64_t i23_,
+                       int64_t i24_,
+                       int64_t i25_,
+                       int64_t i26_,
+                       int64_t i27_,
+                       int64_t i28_,
+                       int64_t i29_,
+                       int64_t i30_,
+                       int64_t i31_,
+                       int64_t i32_,
+                       int64_t i33_,
+                       int64_t i34_,
+                       int64_t i35_,
+                       int64_t i36_,
+                       int64_t i37_,
+                       int64_t i38_,
+                       int64_t i39_,
+                       int64_t i40_,
+                       int64_t i41_,
+                       int64_t i42_,
+                       int64_t i43_,
+                       int64_t i44_,
+                       int64_t i45_,
+                       int64_t i46_,
+                       int64_t i47_,
+                       int64_t i48_,
+                       int64_t i49_,
+                       int64_t i50_,
+                       int64_t i51_,
+                       int64_t i52_,
+                       int64_t i53_,
+                       int64_t i54_,
+                       int64_t i55_,
+                       int64_t i56_,
+                       int64_t i57_,
+                       int64_t i58_,
+                       int64_t i59_,
+                       int64_t i60_,
+                       int64_t i61_,
+                       int64_t i62_,
+                       int64_t i63_,
+                       int64_t i64_)
+    : i1(std::move(i1_))
+    , i2(std::move(i2_))
+    , i3(std::move(i3_))
+    , i4(std::move(i4_))
+    , i5(std::move(i5_))
+    , i6(std::move(i6_))
+    , i7(std::move(i7_))
+    , i8(std::move(i8_))
+    , i9(std::move(i9_))
+    , i10(std::move(i10_))
+    , i11(std::move(i11_))
+    , i12(std::move(i12_))
+    , i13(std::move(i13_))
+    , i14(std::move(i14_))
+    , i15(std::move(i15_))
+    , i16(std::move(i16_))
+    , i17(std::move(i17_))
+    , i18(std::move(i18_))
+    , i19(std::move(i19_))
+    , i20(std::move(i20_))
+    , i21(std::move(i21_))
+    , i22(std::move(i22_))
+    , i23(std::move(i23_))
+    , i24(std::move(i24_))
+    , i25(std::move(i25_))
+    , i26(std::move(i26_))
+    , i27(std::move(i27_))
+    , i28(std::move(i28_))
+    , i29(std::move(i29_))
+    , i30(std::move(i30_))
+    , i31(std::move(i31_))
+    , i32(std::move(i32_))
+    , i33(std::move(i33_))
+    , i34(std::move(i34_))
+    , i35(std::move(i35_))
+    , i36(std::move(i36_))
+    , i37(std::move(i37_))
+    , i38(std::move(i38_))
+    , i39(std::move(i39_))
+    , i40(std::move(i40_))
+    , i41(std::move(i41_))
+    , i42(std::move(i42_))
+    , i43(std::move(i43_))
+    , i44(std::move(i44_))
+    , i45(std::move(i45_))
+    , i46(std::move(i46_))
+    , i47(std::move(i47_))
+    , i48(std::move(i48_))
+    , i49(std::move(i49_))
+    , i50(std::move(i50_))
+    , i51(std::move(i51_))
+    , i52(std::move(i52_))
+    , i53(std::move(i53_))
+    , i54(std::move(i54_))
+    , i55(std::move(i55_))
+    , i56(std::move(i56_))
+    , i57(std::move(i57_))
+    , i58(std::move(i58_))
+    , i59(std::move(i59_))
+    , i60(std::move(i60_))
+    , i61(std::move(i61_))
+    , i62(std::move(i62_))
+    , i63(std::move(i63_))
+    , i64(std::move(i64_))
+    {}
+};
+
+} // namespace snapchat::djinni::benchmark
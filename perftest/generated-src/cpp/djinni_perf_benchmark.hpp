@@ -8,14 +8,21 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace snapchat::djinni::benchmark {
 
 class ObjectNative;
+class ObjectNativeUncached;
 class ObjectPlatform;
+class ObjectPlatformUncached;
 enum class EnumSixValue;
+enum class FlagsThirtyTwoValue;
 struct RecordSixInt;
+struct RecordSixteenInt;
+struct RecordSixtyFourInt;
 
 /** djinni_perf_benchmark: This interface will be implemented in C++ and can be called from any language. */
 class DjinniPerfBenchmark {
@@ -38,6 +45,8 @@ public:
 
     virtual void argEnumSixValue(EnumSixValue e) = 0;
 
+    virtual void argFlagsThirtyTwoValue(FlagsThirtyTwoValue f) = 0;
+
     virtual void argRecordSixInt(const RecordSixInt & r) = 0;
 
     virtual void argListInt(const std::vector<int64_t> & v) = 0;
@@ -46,20 +55,44 @@ public:
 
     virtual void argObject(const /*not-null*/ std::shared_ptr<ObjectPlatform> & c) = 0;
 
+    virtual void argObjectUncached(const /*not-null*/ std::shared_ptr<ObjectPlatformUncached> & c) = 0;
+
+    virtual void callObjectFromThread(const /*not-null*/ std::shared_ptr<ObjectPlatform> & c, int32_t count) = 0;
+
     virtual void argListObject(const std::vector</*not-null*/ std::shared_ptr<ObjectPlatform>> & l) = 0;
 
     virtual void argListRecord(const std::vector<RecordSixInt> & l) = 0;
 
+    virtual void argListRecordSixteenInt(const std::vector<RecordSixteenInt> & l) = 0;
+
+    virtual void argListRecordSixtyFourInt(const std::vector<RecordSixtyFourInt> & l) = 0;
+
     virtual void argArrayRecord(const std::vector<RecordSixInt> & a) = 0;
 
+    virtual void argMapStringInt(const std::unordered_map<std::string, int64_t> & m) = 0;
+
+    virtual void argSetString(const std::unordered_set<std::string> & s) = 0;
+
     virtual int64_t returnInt(int64_t i) = 0;
 
+    virtual EnumSixValue returnEnumSixValue() = 0;
+
+    virtual FlagsThirtyTwoValue returnFlagsThirtyTwoValue(int32_t count) = 0;
+
     virtual std::string returnString(int32_t size) = 0;
 
+    virtual std::string returnShortString(int32_t index) = 0;
+
+    virtual std::string returnInternedString(int32_t index) = 0;
+
     virtual std::vector<uint8_t> returnBinary(int32_t size) = 0;
 
+    virtual std::vector<uint8_t> returnBinaryBuffer(int32_t size) = 0;
+
     virtual /*not-null*/ std::shared_ptr<ObjectNative> returnObject() = 0;
 
+    virtual /*not-null*/ std::shared_ptr<ObjectNativeUncached> returnObjectUncached() = 0;
+
     virtual std::vector<int64_t> returnListInt(int32_t size) = 0;
 
     virtual std::vector<int64_t> returnArrayInt(int32_t size) = 0;
@@ -68,8 +101,16 @@ public:
 
     virtual std::vector<RecordSixInt> returnListRecord(int32_t size) = 0;
 
+    virtual std::vector<RecordSixteenInt> returnListRecordSixteenInt(int32_t size) = 0;
+
+    virtual std::vector<RecordSixtyFourInt> returnListRecordSixtyFourInt(int32_t size) = 0;
+
     virtual std::vector<RecordSixInt> returnArrayRecord(int32_t size) = 0;
 
+    virtual std::unordered_map<std::string, int64_t> returnMapStringInt(int32_t size) = 0;
+
+    virtual std::unordered_set<std::string> returnSetString(int32_t size) = 0;
+
     virtual std::string roundTripString(const std::string & s) = 0;
 };
 
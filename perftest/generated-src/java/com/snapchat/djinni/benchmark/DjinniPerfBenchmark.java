@@ -5,6 +5,9 @@ package com.snapchat.djinni.benchmark;
 
 import com.snapchat.djinni.NativeObjectManager;
 import java.util.ArrayList;
+import java.util.EnumSet;
+import java.util.HashMap;
+import java.util.HashSet;
 import java.util.concurrent.atomic.AtomicBoolean;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
@@ -25,6 +28,8 @@ import javax.annotation.Nonnull;
 
     public abstract void argEnumSixValue(@Nonnull EnumSixValue e);
 
+    public abstract void argFlagsThirtyTwoValue(@Nonnull EnumSet<FlagsThirtyTwoValue> f);
+
     public abstract void argRecordSixInt(@Nonnull RecordSixInt r);
 
     public abstract void argListInt(@Nonnull ArrayList<Long> v);
@@ -33,23 +38,53 @@ import javax.annotation.Nonnull;
 
     public abstract void argObject(@CheckForNull ObjectPlatform c);
 
+    public abstract void argObjectUncached(@CheckForNull ObjectPlatformUncached c);
+
+    public abstract void callObjectFromThread(@CheckForNull ObjectPlatform c, int count);
+
     public abstract void argListObject(@Nonnull ArrayList<ObjectPlatform> l);
 
     public abstract void argListRecord(@Nonnull ArrayList<RecordSixInt> l);
 
+    public abstract void argListRecordSixteenInt(@Nonnull ArrayList<RecordSixteenInt> l);
+
+    public abstract void argListRecordSixtyFourInt(@Nonnull ArrayList<RecordSixtyFourInt> l);
+
     public abstract void argArrayRecord(@Nonnull ArrayList<RecordSixInt> a);
 
+    public abstract void argMapStringInt(@Nonnull HashMap<String, Long> m);
+
+    public abstract void argSetString(@Nonnull HashSet<String> s);
+
     public abstract long returnInt(long i);
 
+    @Nonnull
+    public abstract EnumSixValue returnEnumSixValue();
+
+    @Nonnull
+    public abstract EnumSet<FlagsThirtyTwoValue> returnFlagsThirtyTwoValue(int count);
+
     @Nonnull
     public abstract String returnString(int size);
 
+    @Nonnull
+    public abstract String returnShortString(int index);
+
+    @Nonnull
+    public abstract String returnInternedString(int index);
+
     @Nonnull
     public abstract byte[] returnBinary(int size);
 
+    @Nonnull
+    public abstract java.nio.ByteBuffer returnBinaryBuffer(int size);
+
     @CheckForNull
     public abstract ObjectNative returnObject();
 
+    @CheckForNull
+    public abstract ObjectNativeUncached returnObjectUncached();
+
     @Nonnull
     public abstract ArrayList<Long> returnListInt(int size);
 
@@ -62,9 +97,21 @@ import javax.annotation.Nonnull;
     @Nonnull
     public abstract ArrayList<RecordSixInt> returnListRecord(int size);
 
+    @Nonnull
+    public abstract ArrayList<RecordSixteenInt> returnListRecordSixteenInt(int size);
+
+    @Nonnull
+    public abstract ArrayList<RecordSixtyFourInt> returnListRecordSixtyFourInt(int size);
+
     @Nonnull
     public abstract ArrayList<RecordSixInt> returnArrayRecord(int size);
 
+    @Nonnull
+    public abstract HashMap<String, Long> returnMapStringInt(int size);
+
+    @Nonnull
+    public abstract HashSet<String> returnSetString(int size);
+
     @Nonnull
     public abstract String roundTripString(@Nonnull String s);
 
@@ -140,6 +187,14 @@ import javax.annotation.Nonnull;
         }
         private native void native_argEnumSixValue(long _nativeRef, EnumSixValue e);
 
+        @Override
+        public void argFlagsThirtyTwoValue(EnumSet<FlagsThirtyTwoValue> f)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_argFlagsThirtyTwoValue(this.nativeRef, f);
+        }
+        private native void native_argFlagsThirtyTwoValue(long _nativeRef, EnumSet<FlagsThirtyTwoValue> f);
+
         @Override
         public void argRecordSixInt(RecordSixInt r)
         {
@@ -172,6 +227,22 @@ import javax.annotation.Nonnull;
         }
         private native void native_argObject(long _nativeRef, ObjectPlatform c);
 
+        @Override
+        public void argObjectUncached(ObjectPlatformUncached c)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_argObjectUncached(this.nativeRef, c);
+        }
+        private native void native_argObjectUncached(long _nativeRef, ObjectPlatformUncached c);
+
+        @Override
+        public void callObjectFromThread(ObjectPlatform c, int count)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_callObjectFromThread(this.nativeRef, c, count);
+        }
+        private native void native_callObjectFromThread(long _nativeRef, ObjectPlatform c, int count);
+
         @Override
         public void argListObject(ArrayList<ObjectPlatform> l)
         {
@@ -188,6 +259,22 @@ import javax.annotation.Nonnull;
         }
         private native void native_argListRecord(long _nativeRef, ArrayList<RecordSixInt> l);
 
+        @Override
+        public void argListRecordSixteenInt(ArrayList<RecordSixteenInt> l)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_argListRecordSixteenInt(this.nativeRef, l);
+        }
+        private native void native_argListRecordSixteenInt(long _nativeRef, ArrayList<RecordSixteenInt> l);
+
+        @Override
+        public void argListRecordSixtyFourInt(ArrayList<RecordSixtyFourInt> l)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_argListRecordSixtyFourInt(this.nativeRef, l);
+        }
+        private native void native_argListRecordSixtyFourInt(long _nativeRef, ArrayList<RecordSixtyFourInt> l);
+
         @Override
         public void argArrayRecord(ArrayList<RecordSixInt> a)
         {
@@ -196,6 +283,22 @@ import javax.annotation.Nonnull;
         }
         private native void native_argArrayRecord(long _nativeRef, ArrayList<RecordSixInt> a);
 
+        @Override
+        public void argMapStringInt(HashMap<String, Long> m)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_argMapStringInt(this.nativeRef, m);
+        }
+        private native void native_argMapStringInt(long _nativeRef, HashMap<String, Long> m);
+
+        @Override
+        public void argSetString(HashSet<String> s)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_argSetString(this.nativeRef, s);
+        }
+        private native void native_argSetString(long _nativeRef, HashSet<String> s);
+
         @Override
         public long returnInt(long i)
         {
@@ -204,6 +307,22 @@ import javax.annotation.Nonnull;
         }
         private native long native_returnInt(long _nativeRef, long i);
 
+        @Override
+        public EnumSixValue returnEnumSixValue()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnEnumSixValue(this.nativeRef);
+        }
+        private native EnumSixValue native_returnEnumSixValue(long _nativeRef);
+
+        @Override
+        public EnumSet<FlagsThirtyTwoValue> returnFlagsThirtyTwoValue(int count)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnFlagsThirtyTwoValue(this.nativeRef, count);
+        }
+        private native EnumSet<FlagsThirtyTwoValue> native_returnFlagsThirtyTwoValue(long _nativeRef, int count);
+
         @Override
         public String returnString(int size)
         {
@@ -212,6 +331,22 @@ import javax.annotation.Nonnull;
         }
         private native String native_returnString(long _nativeRef, int size);
 
+        @Override
+        public String returnShortString(int index)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnShortString(this.nativeRef, index);
+        }
+        private native String native_returnShortString(long _nativeRef, int index);
+
+        @Override
+        public String returnInternedString(int index)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnInternedString(this.nativeRef, index);
+        }
+        private native String native_returnInternedString(long _nativeRef, int index);
+
         @Override
         public byte[] returnBinary(int size)
         {
@@ -220,6 +355,14 @@ import javax.annotation.Nonnull;
         }
         private native byte[] native_returnBinary(long _nativeRef, int size);
 
+        @Override
+        public java.nio.ByteBuffer returnBinaryBuffer(int size)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnBinaryBuffer(this.nativeRef, size);
+        }
+        private native java.nio.ByteBuffer native_returnBinaryBuffer(long _nativeRef, int size);
+
         @Override
         public ObjectNative returnObject()
         {
@@ -228,6 +371,14 @@ import javax.annotation.Nonnull;
         }
         private native ObjectNative native_returnObject(long _nativeRef);
 
+        @Override
+        public ObjectNativeUncached returnObjectUncached()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnObjectUncached(this.nativeRef);
+        }
+        private native ObjectNativeUncached native_returnObjectUncached(long _nativeRef);
+
         @Override
         public ArrayList<Long> returnListInt(int size)
         {
@@ -260,6 +411,22 @@ import javax.annotation.Nonnull;
         }
         private native ArrayList<RecordSixInt> native_returnListRecord(long _nativeRef, int size);
 
+        @Override
+        public ArrayList<RecordSixteenInt> returnListRecordSixteenInt(int size)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnListRecordSixteenInt(this.nativeRef, size);
+        }
+        private native ArrayList<RecordSixteenInt> native_returnListRecordSixteenInt(long _nativeRef, int size);
+
+        @Override
+        public ArrayList<RecordSixtyFourInt> returnListRecordSixtyFourInt(int size)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnListRecordSixtyFourInt(this.nativeRef, size);
+        }
+        private native ArrayList<RecordSixtyFourInt> native_returnListRecordSixtyFourInt(long _nativeRef, int size);
+
         @Override
         public ArrayList<RecordSixInt> returnArrayRecord(int size)
         {
@@ -268,6 +435,22 @@ import javax.annotation.Nonnull;
         }
         private native ArrayList<RecordSixInt> native_returnArrayRecord(long _nativeRef, int size);
 
+        @Override
+        public HashMap<String, Long> returnMapStringInt(int size)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnMapStringInt(this.nativeRef, size);
+        }
+        private native HashMap<String, Long> native_returnMapStringInt(long _nativeRef, int size);
+
+        @Override
+        public HashSet<String> returnSetString(int size)
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_returnSetString(this.nativeRef, size);
+        }
+        private native HashSet<String> native_returnSetString(long _nativeRef, int size);
+
         @Override
         public String roundTripString(String s)
         {
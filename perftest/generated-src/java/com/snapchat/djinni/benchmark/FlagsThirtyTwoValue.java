@@ -0,0 +1,43 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+package com.snapchat.djinni.benchmark;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/*package*/ enum FlagsThirtyTwoValue {
+    FLAG1,
+    FLAG2,
+    FLAG3,
+    FLAG4,
+    FLAG5,
+    FLAG6,
+    FLAG7,
+    FLAG8,
+    FLAG9,
+    FLAG10,
+    FLAG11,
+    FLAG12,
+    FLAG13,
+    FLAG14,
+    FLAG15,
+    FLAG16,
+    FLAG17,
+    FLAG18,
+    FLAG19,
+    FLAG20,
+    FLAG21,
+    FLAG22,
+    FLAG23,
+    FLAG24,
+    FLAG25,
+    FLAG26,
+    FLAG27,
+    FLAG28,
+    FLAG29,
+    FLAG30,
+    FLAG31,
+    FLAG32,
+    ;
+}
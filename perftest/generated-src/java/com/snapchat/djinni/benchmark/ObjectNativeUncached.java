@@ -0,0 +1,36 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+package com.snapchat.djinni.benchmark;
+
+import com.snapchat.djinni.NativeObjectManager;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** same as ObjectNative, but without identity caching */
+/*package*/ abstract class ObjectNativeUncached {
+    public abstract void baseline();
+
+    public static final class CppProxy extends ObjectNativeUncached
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            NativeObjectManager.register(this, nativeRef);
+        }
+        public static native void nativeDestroy(long nativeRef);
+
+        @Override
+        public void baseline()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            native_baseline(this.nativeRef);
+        }
+        private native void native_baseline(long _nativeRef);
+    }
+}
@@ -0,0 +1,12 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+package com.snapchat.djinni.benchmark;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** same as ObjectPlatform, but without identity caching */
+/*package*/ abstract class ObjectPlatformUncached {
+    public abstract void onDone();
+}
@@ -72,4 +72,31 @@ import javax.annotation.Nonnull;
         "}";
     }
 
+    /*package*/ static long[] packList(java.util.ArrayList<RecordSixInt> list) {
+        long[] packed = new long[list.size() * 6];
+        int i = 0;
+        for (RecordSixInt value : list) {
+            packed[i++] = value.mI1;
+            packed[i++] = value.mI2;
+            packed[i++] = value.mI3;
+            packed[i++] = value.mI4;
+            packed[i++] = value.mI5;
+            packed[i++] = value.mI6;
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<RecordSixInt> unpackList(long[] packed) {
+        java.util.ArrayList<RecordSixInt> list = new java.util.ArrayList<RecordSixInt>(packed.length / 6);
+        for (int i = 0; i < packed.length; i += 6) {
+            list.add(new RecordSixInt(packed[i],
+                                      packed[i + 1],
+                                      packed[i + 2],
+                                      packed[i + 3],
+                                      packed[i + 4],
+                                      packed[i + 5]));
+        }
+        return list;
+    }
+
 }
@@ -0,0 +1,212 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+package com.snapchat.djinni.benchmark;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/*package*/ final class RecordSixteenInt {
+
+
+    /*package*/ final long mI1;
+
+    /*package*/ final long mI2;
+
+    /*package*/ final long mI3;
+
+    /*package*/ final long mI4;
+
+    /*package*/ final long mI5;
+
+    /*package*/ final long mI6;
+
+    /*package*/ final long mI7;
+
+    /*package*/ final long mI8;
+
+    /*package*/ final long mI9;
+
+    /*package*/ final long mI10;
+
+    /*package*/ final long mI11;
+
+    /*package*/ final long mI12;
+
+    /*package*/ final long mI13;
+
+    /*package*/ final long mI14;
+
+    /*package*/ final long mI15;
+
+    /*package*/ final long mI16;
+
+    public RecordSixteenInt(
+            long i1,
+            long i2,
+            long i3,
+            long i4,
+            long i5,
+            long i6,
+            long i7,
+            long i8,
+            long i9,
+            long i10,
+            long i11,
+            long i12,
+            long i13,
+            long i14,
+            long i15,
+            long i16) {
+        this.mI1 = i1;
+        this.mI2 = i2;
+        this.mI3 = i3;
+        this.mI4 = i4;
+        this.mI5 = i5;
+        this.mI6 = i6;
+        this.mI7 = i7;
+        this.mI8 = i8;
+        this.mI9 = i9;
+        this.mI10 = i10;
+        this.mI11 = i11;
+        this.mI12 = i12;
+        this.mI13 = i13;
+        this.mI14 = i14;
+        this.mI15 = i15;
+        this.mI16 = i16;
+    }
+
+    public long getI1() {
+        return mI1;
+    }
+
+    public long getI2() {
+        return mI2;
+    }
+
+    public long getI3() {
+        return mI3;
+    }
+
+    public long getI4() {
+        return mI4;
+    }
+
+    public long getI5() {
+        return mI5;
+    }
+
+    public long getI6() {
+        return mI6;
+    }
+
+    public long getI7() {
+        return mI7;
+    }
+
+    public long getI8() {
+        return mI8;
+    }
+
+    public long getI9() {
+        return mI9;
+    }
+
+    public long getI10() {
+        return mI10;
+    }
+
+    public long getI11() {
+        return mI11;
+    }
+
+    public long getI12() {
+        return mI12;
+    }
+
+    public long getI13() {
+        return mI13;
+    }
+
+    public long getI14() {
+        return mI14;
+    }
+
+    public long getI15() {
+        return mI15;
+    }
+
+    public long getI16() {
+        return mI16;
+    }
+
+    @Override
+    public String toString() {
+        return "RecordSixteenInt{" +
+                "mI1=" + mI1 +
+                "," + "mI2=" + mI2 +
+                "," + "mI3=" + mI3 +
+                "," + "mI4=" + mI4 +
+                "," + "mI5=" + mI5 +
+                "," + "mI6=" + mI6 +
+                "," + "mI7=" + mI7 +
+                "," + "mI8=" + mI8 +
+                "," + "mI9=" + mI9 +
+                "," + "mI10=" + mI10 +
+                "," + "mI11=" + mI11 +
+                "," + "mI12=" + mI12 +
+                "," + "mI13=" + mI13 +
+                "," + "mI14=" + mI14 +
+                "," + "mI15=" + mI15 +
+                "," + "mI16=" + mI16 +
+        "}";
+    }
+
+    /*package*/ static long[] packList(java.util.ArrayList<RecordSixteenInt> list) {
+        long[] packed = new long[list.size() * 16];
+        int i = 0;
+        for (RecordSixteenInt value : list) {
+            packed[i++] = value.mI1;
+            packed[i++] = value.mI2;
+            packed[i++] = value.mI3;
+            packed[i++] = value.mI4;
+            packed[i++] = value.mI5;
+            packed[i++] = value.mI6;
+            packed[i++] = value.mI7;
+            packed[i++] = value.mI8;
+            packed[i++] = value.mI9;
+            packed[i++] = value.mI10;
+            packed[i++] = value.mI11;
+            packed[i++] = value.mI12;
+            packed[i++] = value.mI13;
+            packed[i++] = value.mI14;
+            packed[i++] = value.mI15;
+            packed[i++] = value.mI16;
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<RecordSixteenInt> unpackList(long[] packed) {
+        java.util.ArrayList<RecordSixteenInt> list = new java.util.ArrayList<RecordSixteenInt>(packed.length / 16);
+        for (int i = 0; i < packed.length; i += 16) {
+            list.add(new RecordSixteenInt(packed[i],
+                                          packed[i + 1],
+                                          packed[i + 2],
+                                          packed[i + 3],
+                                          packed[i + 4],
+                                          packed[i + 5],
+                                          packed[i + 6],
+                                          packed[i + 7],
+                                          packed[i + 8],
+                                          packed[i + 9],
+                                          packed[i + 10],
+                                          packed[i + 11],
+                                          packed[i + 12],
+                                          packed[i + 13],
+                                          packed[i + 14],
+                                          packed[i + 15]));
+        }
+        return list;
+    }
+
+}
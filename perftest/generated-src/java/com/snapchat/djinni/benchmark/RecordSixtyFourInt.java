@@ -0,0 +1,740 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+package com.snapchat.djinni.benchmark;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/*package*/ final class RecordSixtyFourInt {
+
+
+    /*package*/ final long mI1;
+
+    /*package*/ final long mI2;
+
+    /*package*/ final long mI3;
+
+    /*package*/ final long mI4;
+
+    /*package*/ final long mI5;
+
+    /*package*/ final long mI6;
+
+    /*package*/ final long mI7;
+
+    /*package*/ final long mI8;
+
+    /*package*/ final long mI9;
+
+    /*package*/ final long mI10;
+
+    /*package*/ final long mI11;
+
+    /*package*/ final long mI12;
+
+    /*package*/ final long mI13;
+
+    /*package*/ final long mI14;
+
+    /*package*/ final long mI15;
+
+    /*package*/ final long mI16;
+
+    /*package*/ final long mI17;
+
+    /*package*/ final long mI18;
+
+    /*package*/ final long mI19;
+
+    /*package*/ final long mI20;
+
+    /*package*/ final long mI21;
+
+    /*package*/ final long mI22;
+
+    /*package*/ final long mI23;
+
+    /*package*/ final long mI24;
+
+    /*package*/ final long mI25;
+
+    /*package*/ final long mI26;
+
+    /*package*/ final long mI27;
+
+    /*package*/ final long mI28;
+
+    /*package*/ final long mI29;
+
+    /*package*/ final long mI30;
+
+    /*package*/ final long mI31;
+
+    /*package*/ final long mI32;
+
+    /*package*/ final long mI33;
+
+    /*package*/ final long mI34;
+
+    /*package*/ final long mI35;
+
+    /*package*/ final long mI36;
+
+    /*package*/ final long mI37;
+
+    /*package*/ final long mI38;
+
+    /*package*/ final long mI39;
+
+    /*package*/ final long mI40;
+
+    /*package*/ final long mI41;
+
+    /*package*/ final long mI42;
+
+    /*package*/ final long mI43;
+
+    /*package*/ final long mI44;
+
+    /*package*/ final long mI45;
+
+    /*package*/ final long mI46;
+
+    /*package*/ final long mI47;
+
+    /*package*/ final long mI48;
+
+    /*package*/ final long mI49;
+
+    /*package*/ final long mI50;
+
+    /*package*/ final long mI51;
+
+    /*package*/ final long mI52;
+
+    /*package*/ final long mI53;
+
+    /*package*/ final long mI54;
+
+    /*package*/ final long mI55;
+
+    /*package*/ final long mI56;
+
+    /*package*/ final long mI57;
+
+    /*package*/ final long mI58;
+
+    /*package*/ final long mI59;
+
+    /*package*/ final long mI60;
+
+    /*package*/ final long mI61;
+
+    /*package*/ final long mI62;
+
+    /*package*/ final long mI63;
+
+    /*package*/ final long mI64;
+
+    public RecordSixtyFourInt(
+            long i1,
+            long i2,
+            long i3,
+            long i4,
+            long i5,
+            long i6,
+            long i7,
+            long i8,
+            long i9,
+            long i10,
+            long i11,
+            long i12,
+            long i13,
+            long i14,
+            long i15,
+            long i16,
+            long i17,
+            long i18,
+            long i19,
+            long i20,
+            long i21,
+            long i22,
+            long i23,
+            long i24,
+            long i25,
+            long i26,
+            long i27,
+            long i28,
+            long i29,
+            long i30,
+            long i31,
+            long i32,
+            long i33,
+            long i34,
+            long i35,
+            long i36,
+            long i37,
+            long i38,
+            long i39,
+            long i40,
+            long i41,
+            long i42,
+            long i43,
+            long i44,
+            long i45,
+            long i46,
+            long i47,
+            long i48,
+            long i49,
+            long i50,
+            long i51,
+            long i52,
+            long i53,
+            long i54,
+            long i55,
+            long i56,
+            long i57,
+            long i58,
+            long i59,
+            long i60,
+            long i61,
+            long i62,
+            long i63,
+            long i64) {
+        this.mI1 = i1;
+        this.mI2 = i2;
+        this.mI3 = i3;
+        this.mI4 = i4;
+        this.mI5 = i5;
+        this.mI6 = i6;
+        this.mI7 = i7;
+        this.mI8 = i8;
+        this.mI9 = i9;
+        this.mI10 = i10;
+        this.mI11 = i11;
+        this.mI12 = i12;
+        this.mI13 = i13;
+        this.mI14 = i14;
+        this.mI15 = i15;
+        this.mI16 = i16;
+        this.mI17 = i17;
+        this.mI18 = i18;
+        this.mI19 = i19;
+        this.mI20 = i20;
+        this.mI21 = i21;
+        this.mI22 = i22;
+        this.mI23 = i23;
+        this.mI24 = i24;
+        this.mI25 = i25;
+        this.mI26 = i26;
+        this.mI27 = i27;
+        this.mI28 = i28;
+        this.mI29 = i29;
+        this.mI30 = i30;
+        this.mI31 = i31;
+        this.mI32 = i32;
+        this.mI33 = i33;
+        this.mI34 = i34;
+        this.mI35 = i35;
+        this.mI36 = i36;
+        this.mI37 = i37;
+        this.mI38 = i38;
+        this.mI39 = i39;
+        this.mI40 = i40;
+        this.mI41 = i41;
+        this.mI42 = i42;
+        this.mI43 = i43;
+        this.mI44 = i44;
+        this.mI45 = i45;
+        this.mI46 = i46;
+        this.mI47 = i47;
+        this.mI48 = i48;
+        this.mI49 = i49;
+        this.mI50 = i50;
+        this.mI51 = i51;
+        this.mI52 = i52;
+        this.mI53 = i53;
+        this.mI54 = i54;
+        this.mI55 = i55;
+        this.mI56 = i56;
+        this.mI57 = i57;
+        this.mI58 = i58;
+        this.mI59 = i59;
+        this.mI60 = i60;
+        this.mI61 = i61;
+        this.mI62 = i62;
+        this.mI63 = i63;
+        this.mI64 = i64;
+    }
+
+    public long getI1() {
+        return mI1;
+    }
+
+    public long getI2() {
+        return mI2;
+    }
+
+    public long getI3() {
+        return mI3;
+    }
+
+    public long getI4() {
+        return mI4;
+    }
+
+    public long getI5() {
+        return mI5;
+    }
+
+    public long getI6() {
+        return mI6;
+    }
+
+    public long getI7() {
+        return mI7;
+    }
+
+    public long getI8() {
+        return mI8;
+    }
+
+    public long getI9() {
+        return mI9;
+    }
+
+    public long getI10() {
+        return mI10;
+    }
+
+    public long getI11() {
+        return mI11;
+    }
+
+    public long getI12() {
+        return mI12;
+    }
+
+    public long getI13() {
+        return mI13;
+    }
+
+    public long getI14() {
+        return mI14;
+    }
+
+    public long getI15() {
+        return mI15;
+    }
+
+    public long getI16() {
+        return mI16;
+    }
+
+    public long getI17() {
+        return mI17;
+    }
+
+    public long getI18() {
+        return mI18;
+    }
+
+    public long getI19() {
+        return mI19;
+    }
+
+    public long getI20() {
+        return mI20;
+    }
+
+    public long getI21() {
+        return mI21;
+    }
+
+    public long getI22() {
+        return mI22;
+    }
+
+    public long getI23() {
+        return mI23;
+    }
+
+    public long getI24() {
+        return mI24;
+    }
+
+    public long getI25() {
+        return mI25;
+    }
+
+    public long getI26() {
+        return mI26;
+    }
+
+    public long getI27() {
+        return mI27;
+    }
+
+    public long getI28() {
+        return mI28;
+    }
+
+    public long getI29() {
+        return mI29;
+    }
+
+    public long getI30() {
+        return mI30;
+    }
+
+    public long getI31() {
+        return mI31;
+    }
+
+    public long getI32() {
+        return mI32;
+    }
+
+    public long getI33() {
+        return mI33;
+    }
+
+    public long getI34() {
+        return mI34;
+    }
+
+    public long getI35() {
+        return mI35;
+    }
+
+    public long getI36() {
+        return mI36;
+    }
+
+    public long getI37() {
+        return mI37;
+    }
+
+    public long getI38() {
+        return mI38;
+    }
+
+    public long getI39() {
+        return mI39;
+    }
+
+    public long getI40() {
+        return mI40;
+    }
+
+    public long getI41() {
+        return mI41;
+    }
+
+    public long getI42() {
+        return mI42;
+    }
+
+    public long getI43() {
+        return mI43;
+    }
+
+    public long getI44() {
+        return mI44;
+    }
+
+    public long getI45() {
+        return mI45;
+    }
+
+    public long getI46() {
+        return mI46;
+    }
+
+    public long getI47() {
+        return mI47;
+    }
+
+    public long getI48() {
+        return mI48;
+    }
+
+    public long getI49() {
+        return mI49;
+    }
+
+    public long getI50() {
+        return mI50;
+    }
+
+    public long getI51() {
+        return mI51;
+    }
+
+    public long getI52() {
+        return mI52;
+    }
+
+    public long getI53() {
+        return mI53;
+    }
+
+    public long getI54() {
+        return mI54;
+    }
+
+    public long getI55() {
+        return mI55;
+    }
+
+    public long getI56() {
+        return mI56;
+    }
+
+    public long getI57() {
+        return mI57;
+    }
+
+    public long getI58() {
+        return mI58;
+    }
+
+    public long getI59() {
+        return mI59;
+    }
+
+    public long getI60() {
+        return mI60;
+    }
+
+    public long getI61() {
+        return mI61;
+    }
+
+    public long getI62() {
+        return mI62;
+    }
+
+    public long getI63() {
+        return mI63;
+    }
+
+    public long getI64() {
+        return mI64;
+    }
+
+    @Override
+    public String toString() {
+        return "RecordSixtyFourInt{" +
+                "mI1=" + mI1 +
+                "," + "mI2=" + mI2 +
+                "," + "mI3=" + mI3 +
+                "," + "mI4=" + mI4 +
+                "," + "mI5=" + mI5 +
+                "," + "mI6=" + mI6 +
+                "," + "mI7=" + mI7 +
+                "," + "mI8=" + mI8 +
+                "," + "mI9=" + mI9 +
+                "," + "mI10=" + mI10 +
+                "," + "mI11=" + mI11 +
+                "," + "mI12=" + mI12 +
+                "," + "mI13=" + mI13 +
+                "," + "mI14=" + mI14 +
+                "," + "mI15=" + mI15 +
+                "," + "mI16=" + mI16 +
+                "," + "mI17=" + mI17 +
+                "," + "mI18=" + mI18 +
+                "," + "mI19=" + mI19 +
+                "," + "mI20=" + mI20 +
+                "," + "mI21=" + mI21 +
+                "," + "mI22=" + mI22 +
+                "," + "mI23=" + mI23 +
+                "," + "mI24=" + mI24 +
+                "," + "mI25=" + mI25 +
+                "," + "mI26=" + mI26 +
+                "," + "mI27=" + mI27 +
+                "," + "mI28=" + mI28 +
+                "," + "mI29=" + mI29 +
+                "," + "mI30=" + mI30 +
+                "," + "mI31=" + mI31 +
+                "," + "mI32=" + mI32 +
+                "," + "mI33=" + mI33 +
+                "," + "mI34=" + mI34 +
+                "," + "mI35=" + mI35 +
+                "," + "mI36=" + mI36 +
+                "," + "mI37=" + mI37 +
+                "," + "mI38=" + mI38 +
+                "," + "mI39=" + mI39 +
+                "," + "mI40=" + mI40 +
+                "," + "mI41=" + mI41 +
+                "," + "mI42=" + mI42 +
+                "," + "mI43=" + mI43 +
+                "," + "mI44=" + mI44 +
+                "," + "mI45=" + mI45 +
+                "," + "mI46=" + mI46 +
+                "," + "mI47=" + mI47 +
+                "," + "mI48=" + mI48 +
+                "," + "mI49=" + mI49 +
+                "," + "mI50=" + mI50 +
+                "," + "mI51=" + mI51 +
+                "," + "mI52=" + mI52 +
+                "," + "mI53=" + mI53 +
+                "," + "mI54=" + mI54 +
+                "," + "mI55=" + mI55 +
+                "," + "mI56=" + mI56 +
+                "," + "mI57=" + mI57 +
+                "," + "mI58=" + mI58 +
+                "," + "mI59=" + mI59 +
+                "," + "mI60=" + mI60 +
+                "," + "mI61=" + mI61 +
+                "," + "mI62=" + mI62 +
+                "," + "mI63=" + mI63 +
+                "," + "mI64=" + mI64 +
+        "}";
+    }
+
+    /*package*/ static long[] packList(java.util.ArrayList<RecordSixtyFourInt> list) {
+        long[] packed = new long[list.size() * 64];
+        int i = 0;
+        for (RecordSixtyFourInt value : list) {
+            packed[i++] = value.mI1;
+            packed[i++] = value.mI2;
+            packed[i++] = value.mI3;
+            packed[i++] = value.mI4;
+            packed[i++] = value.mI5;
+            packed[i++] = value.mI6;
+            packed[i++] = value.mI7;
+            packed[i++] = value.mI8;
+            packed[i++] = value.mI9;
+            packed[i++] = value.mI10;
+            packed[i++] = value.mI11;
+            packed[i++] = value.mI12;
+            packed[i++] = value.mI13;
+            packed[i++] = value.mI14;
+            packed[i++] = value.mI15;
+            packed[i++] = value.mI16;
+            packed[i++] = value.mI17;
+            packed[i++] = value.mI18;
+            packed[i++] = value.mI19;
+            packed[i++] = value.mI20;
+            packed[i++] = value.mI21;
+            packed[i++] = value.mI22;
+            packed[i++] = value.mI23;
+            packed[i++] = value.mI24;
+            packed[i++] = value.mI25;
+            packed[i++] = value.mI26;
+            packed[i++] = value.mI27;
+            packed[i++] = value.mI28;
+            packed[i++] = value.mI29;
+            packed[i++] = value.mI30;
+            packed[i++] = value.mI31;
+            packed[i++] = value.mI32;
+            packed[i++] = value.mI33;
+            packed[i++] = value.mI34;
+            packed[i++] = value.mI35;
+            packed[i++] = value.mI36;
+            packed[i++] = value.mI37;
+            packed[i++] = value.mI38;
+            packed[i++] = value.mI39;
+            packed[i++] = value.mI40;
+            packed[i++] = value.mI41;
+            packed[i++] = value.mI42;
+            packed[i++] = value.mI43;
+            packed[i++] = value.mI44;
+            packed[i++] = value.mI45;
+            packed[i++] = value.mI46;
+            packed[i++] = value.mI47;
+            packed[i++] = value.mI48;
+            packed[i++] = value.mI49;
+            packed[i++] = value.mI50;
+            packed[i++] = value.mI51;
+            packed[i++] = value.mI52;
+            packed[i++] = value.mI53;
+            packed[i++] = value.mI54;
+            packed[i++] = value.mI55;
+            packed[i++] = value.mI56;
+            packed[i++] = value.mI57;
+            packed[i++] = value.mI58;
+            packed[i++] = value.mI59;
+            packed[i++] = value.mI60;
+            packed[i++] = value.mI61;
+            packed[i++] = value.mI62;
+            packed[i++] = value.mI63;
+            packed[i++] = value.mI64;
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<RecordSixtyFourInt> unpackList(long[] packed) {
+        java.util.ArrayList<RecordSixtyFourInt> list = new java.util.ArrayList<RecordSixtyFourInt>(packed.length / 64);
+        for (int i = 0; i < packed.length; i += 64) {
+            list.add(new RecordSixtyFourInt(packed[i],
+                                            packed[i + 1],
+                                            packed[i + 2],
+                                            packed[i + 3],
+                                            packed[i + 4],
+                                            packed[i + 5],
+                                            packed[i + 6],
+                                            packed[i + 7],
+                                            packed[i + 8],
+                                            packed[i + 9],
+                                            packed[i + 10],
+                                            packed[i + 11],
+                                            packed[i + 12],
+                                            packed[i + 13],
+                                            packed[i + 14],
+                                            packed[i + 15],
+                                            packed[i + 16],
+                                            packed[i + 17],
+                                            packed[i + 18],
+                                            packed[i + 19],
+                                            packed[i + 20],
+                                            packed[i + 21],
+                                            packed[i + 22],
+                                            packed[i + 23],
+                                            packed[i + 24],
+                                            packed[i + 25],
+                                            packed[i + 26],
+                                            packed[i + 27],
+                                            packed[i + 28],
+                                            packed[i + 29],
+                                            packed[i + 30],
+                                            packed[i + 31],
+                                            packed[i + 32],
+                                            packed[i + 33],
+                                            packed[i + 34],
+                                            packed[i + 35],
+                                            packed[i + 36],
+                                            packed[i + 37],
+                                            packed[i + 38],
+                                            packed[i + 39],
+                                            packed[i + 40],
+                                            packed[i + 41],
+                                            packed[i + 42],
+                                            packed[i + 43],
+                                            packed[i + 44],
+                                            packed[i + 45],
+                                            packed[i + 46],
+                                            packed[i + 47],
+                                            packed[i + 48],
+                                            packed[i + 49],
+                                            packed[i + 50],
+                                            packed[i + 51],
+                                            packed[i + 52],
+                                            packed[i + 53],
+                                            packed[i + 54],
+                                            packed[i + 55],
+                                            packed[i + 56],
+                                            packed[i + 57],
+                                            packed[i + 58],
+                                            packed[i + 59],
+                                            packed[i + 60],
+                                            packed[i + 61],
+                                            packed[i + 62],
+                                            packed[i + 63]));
+        }
+        return list;
+    }
+
+}
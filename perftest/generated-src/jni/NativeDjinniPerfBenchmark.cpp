@@ -6,9 +6,14 @@
 #include "DataView_jni.hpp"
 #include "Marshal.hpp"
 #include "NativeEnumSixValue.hpp"
+#include "NativeFlagsThirtyTwoValue.hpp"
 #include "NativeObjectNative.hpp"
+#include "NativeObjectNativeUncached.hpp"
 #include "NativeObjectPlatform.hpp"
+#include "NativeObjectPlatformUncached.hpp"
 #include "NativeRecordSixInt.hpp"
+#include "NativeRecordSixteenInt.hpp"
+#include "NativeRecordSixtyFourInt.hpp"
 
 namespace djinni_generated {
 
@@ -89,6 +94,14 @@ CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_0
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argFlagsThirtyTwoValue(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_f)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        ref->argFlagsThirtyTwoValue(::djinni_generated::NativeFlagsThirtyTwoValue::toCpp(jniEnv, j_f));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argRecordSixInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_r)
 {
     try {
@@ -121,6 +134,23 @@ CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_0
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argObjectUncached(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_c)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        ref->argObjectUncached(::djinni_generated::NativeObjectPlatformUncached::toCpp(jniEnv, j_c));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1callObjectFromThread(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_c, jint j_count)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        ref->callObjectFromThread(::djinni_generated::NativeObjectPlatform::toCpp(jniEnv, j_c),
+                                  ::djinni::I32::toCpp(jniEnv, j_count));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argListObject(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_l)
 {
     try {
@@ -137,6 +167,22 @@ CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_0
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argListRecordSixteenInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_l)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        ref->argListRecordSixteenInt(::djinni::List<::djinni_generated::NativeRecordSixteenInt>::toCpp(jniEnv, j_l));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argListRecordSixtyFourInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_l)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        ref->argListRecordSixtyFourInt(::djinni::List<::djinni_generated::NativeRecordSixtyFourInt>::toCpp(jniEnv, j_l));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argArrayRecord(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_a)
 {
     try {
@@ -145,6 +191,22 @@ CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_0
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argMapStringInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_m)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        ref->argMapStringInt(::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(jniEnv, j_m));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1argSetString(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_s)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        ref->argSetString(::djinni::Set<::djinni::String>::toCpp(jniEnv, j_s));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
 CJNIEXPORT jlong JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlong j_i)
 {
     try {
@@ -154,6 +216,24 @@ CJNIEXPORT jlong JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnEnumSixValue(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnEnumSixValue();
+        return ::djinni::release(::djinni_generated::NativeEnumSixValue::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnFlagsThirtyTwoValue(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_count)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnFlagsThirtyTwoValue(::djinni::I32::toCpp(jniEnv, j_count));
+        return ::djinni::release(::djinni_generated::NativeFlagsThirtyTwoValue::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
 CJNIEXPORT jstring JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnString(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
 {
     try {
@@ -163,6 +243,24 @@ CJNIEXPORT jstring JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmar
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT jstring JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnShortString(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_index)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnShortString(::djinni::I32::toCpp(jniEnv, j_index));
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnInternedString(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_index)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnInternedString(::djinni::I32::toCpp(jniEnv, j_index));
+        return ::djinni::release(::djinni::InternedString::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
 CJNIEXPORT jbyteArray JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnBinary(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
 {
     try {
@@ -172,6 +270,15 @@ CJNIEXPORT jbyteArray JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBench
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnBinaryBuffer(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnBinaryBuffer(::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::BinaryBuffer::fromCpp(jniEnv, std::move(r)));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
 CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnObject(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
 {
     try {
@@ -181,6 +288,15 @@ CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmar
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnObjectUncached(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnObjectUncached();
+        return ::djinni::release(::djinni_generated::NativeObjectNativeUncached::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
 CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnListInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
 {
     try {
@@ -217,6 +333,24 @@ CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmar
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnListRecordSixteenInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnListRecordSixteenInt(::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::List<::djinni_generated::NativeRecordSixteenInt>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnListRecordSixtyFourInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnListRecordSixtyFourInt(::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::List<::djinni_generated::NativeRecordSixtyFourInt>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
 CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnArrayRecord(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
 {
     try {
@@ -226,6 +360,24 @@ CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmar
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnMapStringInt(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnMapStringInt(::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1returnSetString(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jint j_size)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::DjinniPerfBenchmark>(nativeRef);
+        auto r = ref->returnSetString(::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::Set<::djinni::String>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
 CJNIEXPORT jstring JNICALL Java_com_snapchat_djinni_benchmark_DjinniPerfBenchmark_00024CppProxy_native_1roundTripString(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jstring j_s)
 {
     try {
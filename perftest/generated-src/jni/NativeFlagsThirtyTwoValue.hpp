@@ -0,0 +1,26 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "FlagsThirtyTwoValue.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeFlagsThirtyTwoValue final : ::djinni::JniFlags {
+public:
+    using CppType = ::snapchat::djinni::benchmark::FlagsThirtyTwoValue;
+    using JniType = jobject;
+
+    using Boxed = NativeFlagsThirtyTwoValue;
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return static_cast<CppType>(::djinni::JniClass<NativeFlagsThirtyTwoValue>::get().flags(jniEnv, j)); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, CppType c) { return ::djinni::JniClass<NativeFlagsThirtyTwoValue>::get().create(jniEnv, static_cast<unsigned>(c), 32); }
+
+private:
+    NativeFlagsThirtyTwoValue() : JniFlags("com/snapchat/djinni/benchmark/FlagsThirtyTwoValue") {}
+    friend ::djinni::JniClass<NativeFlagsThirtyTwoValue>;
+};
+
+} // namespace djinni_generated
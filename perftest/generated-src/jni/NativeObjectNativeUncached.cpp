@@ -0,0 +1,28 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeObjectNativeUncached.hpp"  // my header
+
+namespace djinni_generated {
+
+NativeObjectNativeUncached::NativeObjectNativeUncached() : ::djinni::JniInterface<::snapchat::djinni::benchmark::ObjectNativeUncached, NativeObjectNativeUncached>("com/snapchat/djinni/benchmark/ObjectNativeUncached$CppProxy") {}
+
+NativeObjectNativeUncached::~NativeObjectNativeUncached() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_ObjectNativeUncached_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        delete reinterpret_cast<::djinni::CppProxyHandle<::snapchat::djinni::benchmark::ObjectNativeUncached>*>(nativeRef);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_snapchat_djinni_benchmark_ObjectNativeUncached_00024CppProxy_native_1baseline(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::snapchat::djinni::benchmark::ObjectNativeUncached>(nativeRef);
+        ref->baseline();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,34 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "ObjectNativeUncached.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeObjectNativeUncached final : ::djinni::JniInterface<::snapchat::djinni::benchmark::ObjectNativeUncached, NativeObjectNativeUncached> {
+public:
+    using CppType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>;
+    using CppOptType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>;
+    using JniType = jobject;
+
+    using Boxed = NativeObjectNativeUncached;
+
+    static constexpr bool kUsesProxyCache = false;
+
+    ~NativeObjectNativeUncached();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeObjectNativeUncached>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeObjectNativeUncached>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeObjectNativeUncached();
+    friend ::djinni::JniClass<NativeObjectNativeUncached>;
+    friend ::djinni::JniInterface<::snapchat::djinni::benchmark::ObjectNativeUncached, NativeObjectNativeUncached>;
+
+};
+
+} // namespace djinni_generated
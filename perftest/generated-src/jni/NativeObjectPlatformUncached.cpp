@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeObjectPlatformUncached.hpp"  // my header
+
+namespace djinni_generated {
+
+NativeObjectPlatformUncached::NativeObjectPlatformUncached() : ::djinni::JniInterface<::snapchat::djinni::benchmark::ObjectPlatformUncached, NativeObjectPlatformUncached>() {}
+
+NativeObjectPlatformUncached::~NativeObjectPlatformUncached() = default;
+
+NativeObjectPlatformUncached::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::ProxyCacheBypass{}, ::djinni::jniGetThreadEnv(), j) { }
+
+NativeObjectPlatformUncached::JavaProxy::~JavaProxy() = default;
+
+void NativeObjectPlatformUncached::JavaProxy::onDone() {
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeObjectPlatformUncached>::get();
+    jniEnv->CallVoidMethod(Handle::get().get(), data.method_onDone);
+    ::djinni::jniExceptionCheck(jniEnv);
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "ObjectPlatformUncached.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeObjectPlatformUncached final : ::djinni::JniInterface<::snapchat::djinni::benchmark::ObjectPlatformUncached, NativeObjectPlatformUncached> {
+public:
+    using CppType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectPlatformUncached>;
+    using CppOptType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectPlatformUncached>;
+    using JniType = jobject;
+
+    using Boxed = NativeObjectPlatformUncached;
+
+    static constexpr bool kUsesProxyCache = false;
+
+    ~NativeObjectPlatformUncached();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeObjectPlatformUncached>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeObjectPlatformUncached>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeObjectPlatformUncached();
+    friend ::djinni::JniClass<NativeObjectPlatformUncached>;
+    friend ::djinni::JniInterface<::snapchat::djinni::benchmark::ObjectPlatformUncached, NativeObjectPlatformUncached>;
+
+    class JavaProxy final : ::djinni::JavaProxyHandle<JavaProxy>, public ::snapchat::djinni::benchmark::ObjectPlatformUncached
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void onDone() override;
+
+    private:
+        friend ::djinni::JniInterface<::snapchat::djinni::benchmark::ObjectPlatformUncached, ::djinni_generated::NativeObjectPlatformUncached>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/snapchat/djinni/benchmark/ObjectPlatformUncached") };
+    const jmethodID method_onDone { ::djinni::jniGetMethodID(clazz.get(), "onDone", "()V") };
+};
+
+} // namespace djinni_generated
@@ -35,4 +35,36 @@ auto NativeRecordSixInt::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
             ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI6))};
 }
 
+void NativeRecordSixInt::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::I64::pack(c.i1);
+    out[1] = ::djinni::I64::pack(c.i2);
+    out[2] = ::djinni::I64::pack(c.i3);
+    out[3] = ::djinni::I64::pack(c.i4);
+    out[4] = ::djinni::I64::pack(c.i5);
+    out[5] = ::djinni::I64::pack(c.i6);
+}
+
+auto NativeRecordSixInt::unpack(const jlong* in) -> CppType {
+    return {::djinni::I64::unpack(in[0]),
+            ::djinni::I64::unpack(in[1]),
+            ::djinni::I64::unpack(in[2]),
+            ::djinni::I64::unpack(in[3]),
+            ::djinni::I64::unpack(in[4]),
+            ::djinni::I64::unpack(in[5])};
+}
+
+auto NativeRecordSixInt::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixInt>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeRecordSixInt::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixInt>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
 } // namespace djinni_generated
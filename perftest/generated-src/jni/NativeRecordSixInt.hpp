@@ -20,12 +20,21 @@ public:
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
 
+    // Lists of this record cross JNI as a long[] with one slot per field (see ::djinni::List)
+    static constexpr size_t kPackedFields = 6;
+    static void pack(const CppType& c, jlong* out);
+    static CppType unpack(const jlong* in);
+    static ::djinni::LocalRef<jlongArray> packList(JNIEnv* jniEnv, jobject list);
+    static ::djinni::LocalRef<jobject> unpackList(JNIEnv* jniEnv, jlongArray packed);
+
 private:
     NativeRecordSixInt();
     friend ::djinni::JniClass<NativeRecordSixInt>;
 
     const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/snapchat/djinni/benchmark/RecordSixInt") };
     const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(JJJJJJ)V") };
+    const jmethodID jpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "packList", "(Ljava/util/ArrayList;)[J") };
+    const jmethodID junpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "unpackList", "([J)Ljava/util/ArrayList;") };
     const jfieldID field_mI1 { ::djinni::jniGetFieldID(clazz.get(), "mI1", "J") };
     const jfieldID field_mI2 { ::djinni::jniGetFieldID(clazz.get(), "mI2", "J") };
     const jfieldID field_mI3 { ::djinni::jniGetFieldID(clazz.get(), "mI3", "J") };
@@ -0,0 +1,110 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeRecordSixteenInt.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeRecordSixteenInt::NativeRecordSixteenInt() = default;
+
+NativeRecordSixteenInt::~NativeRecordSixteenInt() = default;
+
+auto NativeRecordSixteenInt::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixteenInt>::get();
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i1)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i2)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i3)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i4)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i5)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i6)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i7)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i8)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i9)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i10)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i11)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i12)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i13)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i14)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i15)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i16)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeRecordSixteenInt::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, 17);
+    assert(j != nullptr);
+    const auto& data = ::djinni::JniClass<NativeRecordSixteenInt>::get();
+    return {::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI1)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI2)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI3)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI4)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI5)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI6)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI7)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI8)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI9)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI10)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI11)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI12)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI13)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI14)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI15)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI16))};
+}
+
+void NativeRecordSixteenInt::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::I64::pack(c.i1);
+    out[1] = ::djinni::I64::pack(c.i2);
+    out[2] = ::djinni::I64::pack(c.i3);
+    out[3] = ::djinni::I64::pack(c.i4);
+    out[4] = ::djinni::I64::pack(c.i5);
+    out[5] = ::djinni::I64::pack(c.i6);
+    out[6] = ::djinni::I64::pack(c.i7);
+    out[7] = ::djinni::I64::pack(c.i8);
+    out[8] = ::djinni::I64::pack(c.i9);
+    out[9] = ::djinni::I64::pack(c.i10);
+    out[10] = ::djinni::I64::pack(c.i11);
+    out[11] = ::djinni::I64::pack(c.i12);
+    out[12] = ::djinni::I64::pack(c.i13);
+    out[13] = ::djinni::I64::pack(c.i14);
+    out[14] = ::djinni::I64::pack(c.i15);
+    out[15] = ::djinni::I64::pack(c.i16);
+}
+
+auto NativeRecordSixteenInt::unpack(const jlong* in) -> CppType {
+    return {::djinni::I64::unpack(in[0]),
+            ::djinni::I64::unpack(in[1]),
+            ::djinni::I64::unpack(in[2]),
+            ::djinni::I64::unpack(in[3]),
+            ::djinni::I64::unpack(in[4]),
+            ::djinni::I64::unpack(in[5]),
+            ::djinni::I64::unpack(in[6]),
+            ::djinni::I64::unpack(in[7]),
+            ::djinni::I64::unpack(in[8]),
+            ::djinni::I64::unpack(in[9]),
+            ::djinni::I64::unpack(in[10]),
+            ::djinni::I64::unpack(in[11]),
+            ::djinni::I64::unpack(in[12]),
+            ::djinni::I64::unpack(in[13]),
+            ::djinni::I64::unpack(in[14]),
+            ::djinni::I64::unpack(in[15])};
+}
+
+auto NativeRecordSixteenInt::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixteenInt>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeRecordSixteenInt::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixteenInt>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,56 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "RecordSixteenInt.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeRecordSixteenInt final {
+public:
+    using CppType = ::snapchat::djinni::benchmark::RecordSixteenInt;
+    using JniType = jobject;
+
+    using Boxed = NativeRecordSixteenInt;
+
+    ~NativeRecordSixteenInt();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+
+    // Lists of this record cross JNI as a long[] with one slot per field (see ::djinni::List)
+    static constexpr size_t kPackedFields = 16;
+    static void pack(const CppType& c, jlong* out);
+    static CppType unpack(const jlong* in);
+    static ::djinni::LocalRef<jlongArray> packList(JNIEnv* jniEnv, jobject list);
+    static ::djinni::LocalRef<jobject> unpackList(JNIEnv* jniEnv, jlongArray packed);
+
+private:
+    NativeRecordSixteenInt();
+    friend ::djinni::JniClass<NativeRecordSixteenInt>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/snapchat/djinni/benchmark/RecordSixteenInt") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(JJJJJJJJJJJJJJJJ)V") };
+    const jmethodID jpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "packList", "(Ljava/util/ArrayList;)[J") };
+    const jmethodID junpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "unpackList", "([J)Ljava/util/ArrayList;") };
+    const jfieldID field_mI1 { ::djinni::jniGetFieldID(clazz.get(), "mI1", "J") };
+    const jfieldID field_mI2 { ::djinni::jniGetFieldID(clazz.get(), "mI2", "J") };
+    const jfieldID field_mI3 { ::djinni::jniGetFieldID(clazz.get(), "mI3", "J") };
+    const jfieldID field_mI4 { ::djinni::jniGetFieldID(clazz.get(), "mI4", "J") };
+    const jfieldID field_mI5 { ::djinni::jniGetFieldID(clazz.get(), "mI5", "J") };
+    const jfieldID field_mI6 { ::djinni::jniGetFieldID(clazz.get(), "mI6", "J") };
+    const jfieldID field_mI7 { ::djinni::jniGetFieldID(clazz.get(), "mI7", "J") };
+    const jfieldID field_mI8 { ::djinni::jniGetFieldID(clazz.get(), "mI8", "J") };
+    const jfieldID field_mI9 { ::djinni::jniGetFieldID(clazz.get(), "mI9", "J") };
+    const jfieldID field_mI10 { ::djinni::jniGetFieldID(clazz.get(), "mI10", "J") };
+    const jfieldID field_mI11 { ::djinni::jniGetFieldID(clazz.get(), "mI11", "J") };
+    const jfieldID field_mI12 { ::djinni::jniGetFieldID(clazz.get(), "mI12", "J") };
+    const jfieldID field_mI13 { ::djinni::jniGetFieldID(clazz.get(), "mI13", "J") };
+    const jfieldID field_mI14 { ::djinni::jniGetFieldID(clazz.get(), "mI14", "J") };
+    const jfieldID field_mI15 { ::djinni::jniGetFieldID(clazz.get(), "mI15", "J") };
+    const jfieldID field_mI16 { ::djinni::jniGetFieldID(clazz.get(), "mI16", "J") };
+};
+
+} // namespace djinni_generated
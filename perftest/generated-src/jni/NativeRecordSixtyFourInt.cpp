@@ -0,0 +1,302 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeRecordSixtyFourInt.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeRecordSixtyFourInt::NativeRecordSixtyFourInt() = default;
+
+NativeRecordSixtyFourInt::~NativeRecordSixtyFourInt() = default;
+
+auto NativeRecordSixtyFourInt::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixtyFourInt>::get();
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i1)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i2)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i3)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i4)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i5)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i6)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i7)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i8)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i9)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i10)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i11)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i12)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i13)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i14)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i15)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i16)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i17)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i18)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i19)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i20)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i21)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i22)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i23)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i24)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i25)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i26)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i27)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i28)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i29)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i30)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i31)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i32)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i33)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i34)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i35)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i36)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i37)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i38)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i39)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i40)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i41)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i42)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i43)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i44)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i45)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i46)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i47)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i48)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i49)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i50)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i51)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i52)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i53)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i54)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i55)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i56)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i57)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i58)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i59)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i60)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i61)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i62)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i63)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.i64)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeRecordSixtyFourInt::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, 65);
+    assert(j != nullptr);
+    const auto& data = ::djinni::JniClass<NativeRecordSixtyFourInt>::get();
+    return {::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI1)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI2)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI3)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI4)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI5)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI6)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI7)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI8)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI9)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI10)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI11)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI12)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI13)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI14)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI15)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI16)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI17)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI18)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI19)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI20)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI21)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI22)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI23)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI24)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI25)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI26)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI27)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI28)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI29)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI30)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI31)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI32)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI33)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI34)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI35)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI36)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI37)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI38)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI39)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI40)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI41)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI42)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI43)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI44)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI45)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI46)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI47)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI48)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI49)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI50)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI51)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI52)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI53)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI54)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI55)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI56)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI57)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI58)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI59)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI60)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI61)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI62)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI63)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mI64))};
+}
+
+void NativeRecordSixtyFourInt::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::I64::pack(c.i1);
+    out[1] = ::djinni::I64::pack(c.i2);
+    out[2] = ::djinni::I64::pack(c.i3);
+    out[3] = ::djinni::I64::pack(c.i4);
+    out[4] = ::djinni::I64::pack(c.i5);
+    out[5] = ::djinni::I64::pack(c.i6);
+    out[6] = ::djinni::I64::pack(c.i7);
+    out[7] = ::djinni::I64::pack(c.i8);
+    out[8] = ::djinni::I64::pack(c.i9);
+    out[9] = ::djinni::I64::pack(c.i10);
+    out[10] = ::djinni::I64::pack(c.i11);
+    out[11] = ::djinni::I64::pack(c.i12);
+    out[12] = ::djinni::I64::pack(c.i13);
+    out[13] = ::djinni::I64::pack(c.i14);
+    out[14] = ::djinni::I64::pack(c.i15);
+    out[15] = ::djinni::I64::pack(c.i16);
+    out[16] = ::djinni::I64::pack(c.i17);
+    out[17] = ::djinni::I64::pack(c.i18);
+    out[18] = ::djinni::I64::pack(c.i19);
+    out[19] = ::djinni::I64::pack(c.i20);
+    out[20] = ::djinni::I64::pack(c.i21);
+    out[21] = ::djinni::I64::pack(c.i22);
+    out[22] = ::djinni::I64::pack(c.i23);
+    out[23] = ::djinni::I64::pack(c.i24);
+    out[24] = ::djinni::I64::pack(c.i25);
+    out[25] = ::djinni::I64::pack(c.i26);
+    out[26] = ::djinni::I64::pack(c.i27);
+    out[27] = ::djinni::I64::pack(c.i28);
+    out[28] = ::djinni::I64::pack(c.i29);
+    out[29] = ::djinni::I64::pack(c.i30);
+    out[30] = ::djinni::I64::pack(c.i31);
+    out[31] = ::djinni::I64::pack(c.i32);
+    out[32] = ::djinni::I64::pack(c.i33);
+    out[33] = ::djinni::I64::pack(c.i34);
+    out[34] = ::djinni::I64::pack(c.i35);
+    out[35] = ::djinni::I64::pack(c.i36);
+    out[36] = ::djinni::I64::pack(c.i37);
+    out[37] = ::djinni::I64::pack(c.i38);
+    out[38] = ::djinni::I64::pack(c.i39);
+    out[39] = ::djinni::I64::pack(c.i40);
+    out[40] = ::djinni::I64::pack(c.i41);
+    out[41] = ::djinni::I64::pack(c.i42);
+    out[42] = ::djinni::I64::pack(c.i43);
+    out[43] = ::djinni::I64::pack(c.i44);
+    out[44] = ::djinni::I64::pack(c.i45);
+    out[45] = ::djinni::I64::pack(c.i46);
+    out[46] = ::djinni::I64::pack(c.i47);
+    out[47] = ::djinni::I64::pack(c.i48);
+    out[48] = ::djinni::I64::pack(c.i49);
+    out[49] = ::djinni::I64::pack(c.i50);
+    out[50] = ::djinni::I64::pack(c.i51);
+    out[51] = ::djinni::I64::pack(c.i52);
+    out[52] = ::djinni::I64::pack(c.i53);
+    out[53] = ::djinni::I64::pack(c.i54);
+    out[54] = ::djinni::I64::pack(c.i55);
+    out[55] = ::djinni::I64::pack(c.i56);
+    out[56] = ::djinni::I64::pack(c.i57);
+    out[57] = ::djinni::I64::pack(c.i58);
+    out[58] = ::djinni::I64::pack(c.i59);
+    out[59] = ::djinni::I64::pack(c.i60);
+    out[60] = ::djinni::I64::pack(c.i61);
+    out[61] = ::djinni::I64::pack(c.i62);
+    out[62] = ::djinni::I64::pack(c.i63);
+    out[63] = ::djinni::I64::pack(c.i64);
+}
+
+auto NativeRecordSixtyFourInt::unpack(const jlong* in) -> CppType {
+    return {::djinni::I64::unpack(in[0]),
+            ::djinni::I64::unpack(in[1]),
+            ::djinni::I64::unpack(in[2]),
+            ::djinni::I64::unpack(in[3]),
+            ::djinni::I64::unpack(in[4]),
+            ::djinni::I64::unpack(in[5]),
+            ::djinni::I64::unpack(in[6]),
+            ::djinni::I64::unpack(in[7]),
+            ::djinni::I64::unpack(in[8]),
+            ::djinni::I64::unpack(in[9]),
+            ::djinni::I64::unpack(in[10]),
+            ::djinni::I64::unpack(in[11]),
+            ::djinni::I64::unpack(in[12]),
+            ::djinni::I64::unpack(in[13]),
+            ::djinni::I64::unpack(in[14]),
+            ::djinni::I64::unpack(in[15]),
+            ::djinni::I64::unpack(in[16]),
+            ::djinni::I64::unpack(in[17]),
+            ::djinni::I64::unpack(in[18]),
+            ::djinni::I64::unpack(in[19]),
+            ::djinni::I64::unpack(in[20]),
+            ::djinni::I64::unpack(in[21]),
+            ::djinni::I64::unpack(in[22]),
+            ::djinni::I64::unpack(in[23]),
+            ::djinni::I64::unpack(in[24]),
+            ::djinni::I64::unpack(in[25]),
+            ::djinni::I64::unpack(in[26]),
+            ::djinni::I64::unpack(in[27]),
+            ::djinni::I64::unpack(in[28]),
+            ::djinni::I64::unpack(in[29]),
+            ::djinni::I64::unpack(in[30]),
+            ::djinni::I64::unpack(in[31]),
+            ::djinni::I64::unpack(in[32]),
+            ::djinni::I64::unpack(in[33]),
+            ::djinni::I64::unpack(in[34]),
+            ::djinni::I64::unpack(in[35]),
+            ::djinni::I64::unpack(in[36]),
+            ::djinni::I64::unpack(in[37]),
+            ::djinni::I64::unpack(in[38]),
+            ::djinni::I64::unpack(in[39]),
+            ::djinni::I64::unpack(in[40]),
+            ::djinni::I64::unpack(in[41]),
+            ::djinni::I64::unpack(in[42]),
+            ::djinni::I64::unpack(in[43]),
+            ::djinni::I64::unpack(in[44]),
+            ::djinni::I64::unpack(in[45]),
+            ::djinni::I64::unpack(in[46]),
+            ::djinni::I64::unpack(in[47]),
+            ::djinni::I64::unpack(in[48]),
+            ::djinni::I64::unpack(in[49]),
+            ::djinni::I64::unpack(in[50]),
+            ::djinni::I64::unpack(in[51]),
+            ::djinni::I64::unpack(in[52]),
+            ::djinni::I64::unpack(in[53]),
+            ::djinni::I64::unpack(in[54]),
+            ::djinni::I64::unpack(in[55]),
+            ::djinni::I64::unpack(in[56]),
+            ::djinni::I64::unpack(in[57]),
+            ::djinni::I64::unpack(in[58]),
+            ::djinni::I64::unpack(in[59]),
+            ::djinni::I64::unpack(in[60]),
+            ::djinni::I64::unpack(in[61]),
+            ::djinni::I64::unpack(in[62]),
+            ::djinni::I64::unpack(in[63])};
+}
+
+auto NativeRecordSixtyFourInt::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixtyFourInt>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeRecordSixtyFourInt::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeRecordSixtyFourInt>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,104 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "RecordSixtyFourInt.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeRecordSixtyFourInt final {
+public:
+    using CppType = ::snapchat::djinni::benchmark::RecordSixtyFourInt;
+    using JniType = jobject;
+
+    using Boxed = NativeRecordSixtyFourInt;
+
+    ~NativeRecordSixtyFourInt();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+
+    // Lists of this record cross JNI as a long[] with one slot per field (see ::djinni::List)
+    static constexpr size_t kPackedFields = 64;
+    static void pack(const CppType& c, jlong* out);
+    static CppType unpack(const jlong* in);
+    static ::djinni::LocalRef<jlongArray> packList(JNIEnv* jniEnv, jobject list);
+    static ::djinni::LocalRef<jobject> unpackList(JNIEnv* jniEnv, jlongArray packed);
+
+private:
+    NativeRecordSixtyFourInt();
+    friend ::djinni::JniClass<NativeRecordSixtyFourInt>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/snapchat/djinni/benchmark/RecordSixtyFourInt") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(JJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJJ)V") };
+    const jmethodID jpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "packList", "(Ljava/util/ArrayList;)[J") };
+    const jmethodID junpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "unpackList", "([J)Ljava/util/ArrayList;") };
+    const jfieldID field_mI1 { ::djinni::jniGetFieldID(clazz.get(), "mI1", "J") };
+    const jfieldID field_mI2 { ::djinni::jniGetFieldID(clazz.get(), "mI2", "J") };
+    const jfieldID field_mI3 { ::djinni::jniGetFieldID(clazz.get(), "mI3", "J") };
+    const jfieldID field_mI4 { ::djinni::jniGetFieldID(clazz.get(), "mI4", "J") };
+    const jfieldID field_mI5 { ::djinni::jniGetFieldID(clazz.get(), "mI5", "J") };
+    const jfieldID field_mI6 { ::djinni::jniGetFieldID(clazz.get(), "mI6", "J") };
+    const jfieldID field_mI7 { ::djinni::jniGetFieldID(clazz.get(), "mI7", "J") };
+    const jfieldID field_mI8 { ::djinni::jniGetFieldID(clazz.get(), "mI8", "J") };
+    const jfieldID field_mI9 { ::djinni::jniGetFieldID(clazz.get(), "mI9", "J") };
+    const jfieldID field_mI10 { ::djinni::jniGetFieldID(clazz.get(), "mI10", "J") };
+    const jfieldID field_mI11 { ::djinni::jniGetFieldID(clazz.get(), "mI11", "J") };
+    const jfieldID field_mI12 { ::djinni::jniGetFieldID(clazz.get(), "mI12", "J") };
+    const jfieldID field_mI13 { ::djinni::jniGetFieldID(clazz.get(), "mI13", "J") };
+    const jfieldID field_mI14 { ::djinni::jniGetFieldID(clazz.get(), "mI14", "J") };
+    const jfieldID field_mI15 { ::djinni::jniGetFieldID(clazz.get(), "mI15", "J") };
+    const jfieldID field_mI16 { ::djinni::jniGetFieldID(clazz.get(), "mI16", "J") };
+    const jfieldID field_mI17 { ::djinni::jniGetFieldID(clazz.get(), "mI17", "J") };
+    const jfieldID field_mI18 { ::djinni::jniGetFieldID(clazz.get(), "mI18", "J") };
+    const jfieldID field_mI19 { ::djinni::jniGetFieldID(clazz.get(), "mI19", "J") };
+    const jfieldID field_mI20 { ::djinni::jniGetFieldID(clazz.get(), "mI20", "J") };
+    const jfieldID field_mI21 { ::djinni::jniGetFieldID(clazz.get(), "mI21", "J") };
+    const jfieldID field_mI22 { ::djinni::jniGetFieldID(clazz.get(), "mI22", "J") };
+    const jfieldID field_mI23 { ::djinni::jniGetFieldID(clazz.get(), "mI23", "J") };
+    const jfieldID field_mI24 { ::djinni::jniGetFieldID(clazz.get(), "mI24", "J") };
+    const jfieldID field_mI25 { ::djinni::jniGetFieldID(clazz.get(), "mI25", "J") };
+    const jfieldID field_mI26 { ::djinni::jniGetFieldID(clazz.get(), "mI26", "J") };
+    const jfieldID field_mI27 { ::djinni::jniGetFieldID(clazz.get(), "mI27", "J") };
+    const jfieldID field_mI28 { ::djinni::jniGetFieldID(clazz.get(), "mI28", "J") };
+    const jfieldID field_mI29 { ::djinni::jniGetFieldID(clazz.get(), "mI29", "J") };
+    const jfieldID field_mI30 { ::djinni::jniGetFieldID(clazz.get(), "mI30", "J") };
+    const jfieldID field_mI31 { ::djinni::jniGetFieldID(clazz.get(), "mI31", "J") };
+    const jfieldID field_mI32 { ::djinni::jniGetFieldID(clazz.get(), "mI32", "J") };
+    const jfieldID field_mI33 { ::djinni::jniGetFieldID(clazz.get(), "mI33", "J") };
+    const jfieldID field_mI34 { ::djinni::jniGetFieldID(clazz.get(), "mI34", "J") };
+    const jfieldID field_mI35 { ::djinni::jniGetFieldID(clazz.get(), "mI35", "J") };
+    const jfieldID field_mI36 { ::djinni::jniGetFieldID(clazz.get(), "mI36", "J") };
+    const jfieldID field_mI37 { ::djinni::jniGetFieldID(clazz.get(), "mI37", "J") };
+    const jfieldID field_mI38 { ::djinni::jniGetFieldID(clazz.get(), "mI38", "J") };
+    const jfieldID field_mI39 { ::djinni::jniGetFieldID(clazz.get(), "mI39", "J") };
+    const jfieldID field_mI40 { ::djinni::jniGetFieldID(clazz.get(), "mI40", "J") };
+    const jfieldID field_mI41 { ::djinni::jniGetFieldID(clazz.get(), "mI41", "J") };
+    const jfieldID field_mI42 { ::djinni::jniGetFieldID(clazz.get(), "mI42", "J") };
+    const jfieldID field_mI43 { ::djinni::jniGetFieldID(clazz.get(), "mI43", "J") };
+    const jfieldID field_mI44 { ::djinni::jniGetFieldID(clazz.get(), "mI44", "J") };
+    const jfieldID field_mI45 { ::djinni::jniGetFieldID(clazz.get(), "mI45", "J") };
+    const jfieldID field_mI46 { ::djinni::jniGetFieldID(clazz.get(), "mI46", "J") };
+    const jfieldID field_mI47 { ::djinni::jniGetFieldID(clazz.get(), "mI47", "J") };
+    const jfieldID field_mI48 { ::djinni::jniGetFieldID(clazz.get(), "mI48", "J") };
+    const jfieldID field_mI49 { ::djinni::jniGetFieldID(clazz.get(), "mI49", "J") };
+    const jfieldID field_mI50 { ::djinni::jniGetFieldID(clazz.get(), "mI50", "J") };
+    const jfieldID field_mI51 { ::djinni::jniGetFieldID(clazz.get(), "mI51", "J") };
+    const jfieldID field_mI52 { ::djinni::jniGetFieldID(clazz.get(), "mI52", "J") };
+    const jfieldID field_mI53 { ::djinni::jniGetFieldID(clazz.get(), "mI53", "J") };
+    const jfieldID field_mI54 { ::djinni::jniGetFieldID(clazz.get(), "mI54", "J") };
+    const jfieldID field_mI55 { ::djinni::jniGetFieldID(clazz.get(), "mI55", "J") };
+    const jfieldID field_mI56 { ::djinni::jniGetFieldID(clazz.get(), "mI56", "J") };
+    const jfieldID field_mI57 { ::djinni::jniGetFieldID(clazz.get(), "mI57", "J") };
+    const jfieldID field_mI58 { ::djinni::jniGetFieldID(clazz.get(), "mI58", "J") };
+    const jfieldID field_mI59 { ::djinni::jniGetFieldID(clazz.get(), "mI59", "J") };
+    const jfieldID field_mI60 { ::djinni::jniGetFieldID(clazz.get(), "mI60", "J") };
+    const jfieldID field_mI61 { ::djinni::jniGetFieldID(clazz.get(), "mI61", "J") };
+    const jfieldID field_mI62 { ::djinni::jniGetFieldID(clazz.get(), "mI62", "J") };
+    const jfieldID field_mI63 { ::djinni::jniGetFieldID(clazz.get(), "mI63", "J") };
+    const jfieldID field_mI64 { ::djinni::jniGetFieldID(clazz.get(), "mI64", "J") };
+};
+
+} // namespace djinni_generated
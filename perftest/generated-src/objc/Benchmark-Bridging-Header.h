@@ -13,7 +13,12 @@ FOUNDATION_EXPORT double BenchmarkBridgingHeaderVersionNumber;
 FOUNDATION_EXPORT const unsigned char BenchmarkBridgingHeaderVersionString[];
 
 #import "TXSEnumSixValue.h"
+#import "TXSFlagsThirtyTwoValue.h"
 #import "TXSRecordSixInt.h"
+#import "TXSRecordSixteenInt.h"
+#import "TXSRecordSixtyFourInt.h"
 #import "TXSObjectNative.h"
+#import "TXSObjectNativeUncached.h"
 #import "TXSObjectPlatform.h"
+#import "TXSObjectPlatformUncached.h"
 #import "TXSDjinniPerfBenchmark.h"
@@ -9,9 +9,14 @@
 #import "DataRef_objc.hpp"
 #import "DataView_objc.hpp"
 #import "TXSEnumSixValue+Private.h"
+#import "TXSFlagsThirtyTwoValue+Private.h"
 #import "TXSObjectNative+Private.h"
+#import "TXSObjectNativeUncached+Private.h"
 #import "TXSObjectPlatform+Private.h"
+#import "TXSObjectPlatformUncached+Private.h"
 #import "TXSRecordSixInt+Private.h"
+#import "TXSRecordSixteenInt+Private.h"
+#import "TXSRecordSixtyFourInt+Private.h"
 #include <exception>
 #include <stdexcept>
 #include <utility>
@@ -86,6 +91,12 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (void)argFlagsThirtyTwoValue:(TXSFlagsThirtyTwoValue)f {
+    try {
+        _cppRefHandle.get()->argFlagsThirtyTwoValue(::djinni::Enum<::snapchat::djinni::benchmark::FlagsThirtyTwoValue, TXSFlagsThirtyTwoValue>::toCpp(f));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (void)argRecordSixInt:(nonnull TXSRecordSixInt *)r {
     try {
         _cppRefHandle.get()->argRecordSixInt(::djinni_generated::RecordSixInt::toCpp(r));
@@ -110,6 +121,20 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (void)argObjectUncached:(nullable id<TXSObjectPlatformUncached>)c {
+    try {
+        _cppRefHandle.get()->argObjectUncached(::djinni_generated::ObjectPlatformUncached::toCpp(c));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (void)callObjectFromThread:(nullable id<TXSObjectPlatform>)c
+                       count:(int32_t)count {
+    try {
+        _cppRefHandle.get()->callObjectFromThread(::djinni_generated::ObjectPlatform::toCpp(c),
+                                                  ::djinni::I32::toCpp(count));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (void)argListObject:(nonnull NSArray<id<TXSObjectPlatform>> *)l {
     try {
         _cppRefHandle.get()->argListObject(::djinni::List<::djinni_generated::ObjectPlatform>::toCpp(l));
@@ -122,12 +147,36 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (void)argListRecordSixteenInt:(nonnull NSArray<TXSRecordSixteenInt *> *)l {
+    try {
+        _cppRefHandle.get()->argListRecordSixteenInt(::djinni::List<::djinni_generated::RecordSixteenInt>::toCpp(l));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (void)argListRecordSixtyFourInt:(nonnull NSArray<TXSRecordSixtyFourInt *> *)l {
+    try {
+        _cppRefHandle.get()->argListRecordSixtyFourInt(::djinni::List<::djinni_generated::RecordSixtyFourInt>::toCpp(l));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (void)argArrayRecord:(nonnull NSArray<TXSRecordSixInt *> *)a {
     try {
         _cppRefHandle.get()->argArrayRecord(::djinni::List<::djinni_generated::RecordSixInt>::toCpp(a));
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (void)argMapStringInt:(nonnull NSDictionary<NSString *, NSNumber *> *)m {
+    try {
+        _cppRefHandle.get()->argMapStringInt(::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(m));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (void)argSetString:(nonnull NSSet<NSString *> *)s {
+    try {
+        _cppRefHandle.get()->argSetString(::djinni::Set<::djinni::String>::toCpp(s));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (int64_t)returnInt:(int64_t)i {
     try {
         auto objcpp_result_ = _cppRefHandle.get()->returnInt(::djinni::I64::toCpp(i));
@@ -135,6 +184,20 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (TXSEnumSixValue)returnEnumSixValue {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnEnumSixValue();
+        return ::djinni::Enum<::snapchat::djinni::benchmark::EnumSixValue, TXSEnumSixValue>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (TXSFlagsThirtyTwoValue)returnFlagsThirtyTwoValue:(int32_t)count {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnFlagsThirtyTwoValue(::djinni::I32::toCpp(count));
+        return ::djinni::Enum<::snapchat::djinni::benchmark::FlagsThirtyTwoValue, TXSFlagsThirtyTwoValue>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (nonnull NSString *)returnString:(int32_t)size {
     try {
         auto objcpp_result_ = _cppRefHandle.get()->returnString(::djinni::I32::toCpp(size));
@@ -142,6 +205,20 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (nonnull NSString *)returnShortString:(int32_t)index {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnShortString(::djinni::I32::toCpp(index));
+        return ::djinni::String::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull NSString *)returnInternedString:(int32_t)index {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnInternedString(::djinni::I32::toCpp(index));
+        return ::djinni::String::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (nonnull NSData *)returnBinary:(int32_t)size {
     try {
         auto objcpp_result_ = _cppRefHandle.get()->returnBinary(::djinni::I32::toCpp(size));
@@ -149,6 +226,13 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (nonnull NSData *)returnBinaryBuffer:(int32_t)size {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnBinaryBuffer(::djinni::I32::toCpp(size));
+        return ::djinni::Binary::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (nullable TXSObjectNative *)returnObject {
     try {
         auto objcpp_result_ = _cppRefHandle.get()->returnObject();
@@ -156,6 +240,13 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (nullable TXSObjectNativeUncached *)returnObjectUncached {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnObjectUncached();
+        return ::djinni_generated::ObjectNativeUncached::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (nonnull NSArray<NSNumber *> *)returnListInt:(int32_t)size {
     try {
         auto objcpp_result_ = _cppRefHandle.get()->returnListInt(::djinni::I32::toCpp(size));
@@ -184,6 +275,20 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (nonnull NSArray<TXSRecordSixteenInt *> *)returnListRecordSixteenInt:(int32_t)size {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnListRecordSixteenInt(::djinni::I32::toCpp(size));
+        return ::djinni::List<::djinni_generated::RecordSixteenInt>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull NSArray<TXSRecordSixtyFourInt *> *)returnListRecordSixtyFourInt:(int32_t)size {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnListRecordSixtyFourInt(::djinni::I32::toCpp(size));
+        return ::djinni::List<::djinni_generated::RecordSixtyFourInt>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (nonnull NSArray<TXSRecordSixInt *> *)returnArrayRecord:(int32_t)size {
     try {
         auto objcpp_result_ = _cppRefHandle.get()->returnArrayRecord(::djinni::I32::toCpp(size));
@@ -191,6 +296,20 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
+- (nonnull NSDictionary<NSString *, NSNumber *> *)returnMapStringInt:(int32_t)size {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnMapStringInt(::djinni::I32::toCpp(size));
+        return ::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull NSSet<NSString *> *)returnSetString:(int32_t)size {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->returnSetString(::djinni::I32::toCpp(size));
+        return ::djinni::Set<::djinni::String>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 - (nonnull NSString *)roundTripString:(nonnull NSString *)s {
     try {
         auto objcpp_result_ = _cppRefHandle.get()->roundTripString(::djinni::String::toCpp(s));
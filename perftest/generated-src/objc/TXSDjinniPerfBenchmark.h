@@ -2,11 +2,16 @@
 // This file was generated by Djinni from djinni_perf_benchmark.djinni
 
 #import "TXSEnumSixValue.h"
+#import "TXSFlagsThirtyTwoValue.h"
 #import "TXSRecordSixInt.h"
+#import "TXSRecordSixteenInt.h"
+#import "TXSRecordSixtyFourInt.h"
 #import <Foundation/Foundation.h>
 @class TXSDjinniPerfBenchmark;
 @class TXSObjectNative;
+@class TXSObjectNativeUncached;
 @protocol TXSObjectPlatform;
+@protocol TXSObjectPlatformUncached;
 
 
 /** djinni_perf_benchmark: This interface will be implemented in C++ and can be called from any language. */
@@ -28,6 +33,8 @@
 
 - (void)argEnumSixValue:(TXSEnumSixValue)e;
 
+- (void)argFlagsThirtyTwoValue:(TXSFlagsThirtyTwoValue)f;
+
 - (void)argRecordSixInt:(nonnull TXSRecordSixInt *)r;
 
 - (void)argListInt:(nonnull NSArray<NSNumber *> *)v;
@@ -36,20 +43,45 @@
 
 - (void)argObject:(nullable id<TXSObjectPlatform>)c;
 
+- (void)argObjectUncached:(nullable id<TXSObjectPlatformUncached>)c;
+
+- (void)callObjectFromThread:(nullable id<TXSObjectPlatform>)c
+                       count:(int32_t)count;
+
 - (void)argListObject:(nonnull NSArray<id<TXSObjectPlatform>> *)l;
 
 - (void)argListRecord:(nonnull NSArray<TXSRecordSixInt *> *)l;
 
+- (void)argListRecordSixteenInt:(nonnull NSArray<TXSRecordSixteenInt *> *)l;
+
+- (void)argListRecordSixtyFourInt:(nonnull NSArray<TXSRecordSixtyFourInt *> *)l;
+
 - (void)argArrayRecord:(nonnull NSArray<TXSRecordSixInt *> *)a;
 
+- (void)argMapStringInt:(nonnull NSDictionary<NSString *, NSNumber *> *)m;
+
+- (void)argSetString:(nonnull NSSet<NSString *> *)s;
+
 - (int64_t)returnInt:(int64_t)i;
 
+- (TXSEnumSixValue)returnEnumSixValue;
+
+- (TXSFlagsThirtyTwoValue)returnFlagsThirtyTwoValue:(int32_t)count;
+
 - (nonnull NSString *)returnString:(int32_t)size;
 
+- (nonnull NSString *)returnShortString:(int32_t)index;
+
+- (nonnull NSString *)returnInternedString:(int32_t)index;
+
 - (nonnull NSData *)returnBinary:(int32_t)size;
 
+- (nonnull NSData *)returnBinaryBuffer:(int32_t)size;
+
 - (nullable TXSObjectNative *)returnObject;
 
+- (nullable TXSObjectNativeUncached *)returnObjectUncached;
+
 - (nonnull NSArray<NSNumber *> *)returnListInt:(int32_t)size;
 
 - (nonnull NSArray<NSNumber *> *)returnArrayInt:(int32_t)size;
@@ -58,8 +90,16 @@
 
 - (nonnull NSArray<TXSRecordSixInt *> *)returnListRecord:(int32_t)size;
 
+- (nonnull NSArray<TXSRecordSixteenInt *> *)returnListRecordSixteenInt:(int32_t)size;
+
+- (nonnull NSArray<TXSRecordSixtyFourInt *> *)returnListRecordSixtyFourInt:(int32_t)size;
+
 - (nonnull NSArray<TXSRecordSixInt *> *)returnArrayRecord:(int32_t)size;
 
+- (nonnull NSDictionary<NSString *, NSNumber *> *)returnMapStringInt:(int32_t)size;
+
+- (nonnull NSSet<NSString *> *)returnSetString:(int32_t)size;
+
 - (nonnull NSString *)roundTripString:(nonnull NSString *)s;
 
 @end
@@ -0,0 +1,6 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "FlagsThirtyTwoValue.hpp"
+#import "DJIMarshal+Private.h"
+
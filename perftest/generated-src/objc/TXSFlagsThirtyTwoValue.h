@@ -0,0 +1,40 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import <Foundation/Foundation.h>
+
+typedef NS_OPTIONS(NSInteger, TXSFlagsThirtyTwoValue)
+{
+    TXSFlagsThirtyTwoValueFlag1 = 1 << 0,
+    TXSFlagsThirtyTwoValueFlag2 = 1 << 1,
+    TXSFlagsThirtyTwoValueFlag3 = 1 << 2,
+    TXSFlagsThirtyTwoValueFlag4 = 1 << 3,
+    TXSFlagsThirtyTwoValueFlag5 = 1 << 4,
+    TXSFlagsThirtyTwoValueFlag6 = 1 << 5,
+    TXSFlagsThirtyTwoValueFlag7 = 1 << 6,
+    TXSFlagsThirtyTwoValueFlag8 = 1 << 7,
+    TXSFlagsThirtyTwoValueFlag9 = 1 << 8,
+    TXSFlagsThirtyTwoValueFlag10 = 1 << 9,
+    TXSFlagsThirtyTwoValueFlag11 = 1 << 10,
+    TXSFlagsThirtyTwoValueFlag12 = 1 << 11,
+    TXSFlagsThirtyTwoValueFlag13 = 1 << 12,
+    TXSFlagsThirtyTwoValueFlag14 = 1 << 13,
+    TXSFlagsThirtyTwoValueFlag15 = 1 << 14,
+    TXSFlagsThirtyTwoValueFlag16 = 1 << 15,
+    TXSFlagsThirtyTwoValueFlag17 = 1 << 16,
+    TXSFlagsThirtyTwoValueFlag18 = 1 << 17,
+    TXSFlagsThirtyTwoValueFlag19 = 1 << 18,
+    TXSFlagsThirtyTwoValueFlag20 = 1 << 19,
+    TXSFlagsThirtyTwoValueFlag21 = 1 << 20,
+    TXSFlagsThirtyTwoValueFlag22 = 1 << 21,
+    TXSFlagsThirtyTwoValueFlag23 = 1 << 22,
+    TXSFlagsThirtyTwoValueFlag24 = 1 << 23,
+    TXSFlagsThirtyTwoValueFlag25 = 1 << 24,
+    TXSFlagsThirtyTwoValueFlag26 = 1 << 25,
+    TXSFlagsThirtyTwoValueFlag27 = 1 << 26,
+    TXSFlagsThirtyTwoValueFlag28 = 1 << 27,
+    TXSFlagsThirtyTwoValueFlag29 = 1 << 28,
+    TXSFlagsThirtyTwoValueFlag30 = 1 << 29,
+    TXSFlagsThirtyTwoValueFlag31 = 1 << 30,
+    TXSFlagsThirtyTwoValueFlag32 = 1 << 31,
+};
@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "ObjectNativeUncached.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class TXSObjectNativeUncached;
+
+namespace djinni_generated {
+
+class ObjectNativeUncached
+{
+public:
+    using CppType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>;
+    using CppOptType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>;
+    using ObjcType = TXSObjectNativeUncached*;
+
+    using Boxed = ObjectNativeUncached;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCppOpt(const CppOptType& cpp);
+    static ObjcType fromCpp(const CppType& cpp) { return fromCppOpt(cpp); }
+
+private:
+    class ObjcProxy;
+};
+
+} // namespace djinni_generated
+
@@ -0,0 +1,58 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSObjectNativeUncached+Private.h"
+#import "TXSObjectNativeUncached.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface TXSObjectNativeUncached ()
+
+- (id)initWithCpp:(const std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>&)cppRef;
+
+@end
+
+@implementation TXSObjectNativeUncached {
+    ::djinni::UncachedCppRef<std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (void)baseline {
+    try {
+        _cppRefHandle.get()->baseline();
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto ObjectNativeUncached::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto ObjectNativeUncached::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::new_cpp_proxy<TXSObjectNativeUncached>(cpp);
+}
+
+} // namespace djinni_generated
+
+@end
@@ -0,0 +1,12 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** same as ObjectNative, but without identity caching */
+@interface TXSObjectNativeUncached : NSObject
+
+- (void)baseline;
+
+@end
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSObjectPlatformUncached+Private.h"
+#import "TXSObjectPlatformUncached.h"
+#import "DJIObjcWrapperCache+Private.h"
+#include <stdexcept>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class ObjectPlatformUncached::ObjcProxy final
+: public ::snapchat::djinni::benchmark::ObjectPlatformUncached
+, private ::djinni::ObjcProxyBase<ObjcType>
+{
+    friend class ::djinni_generated::ObjectPlatformUncached;
+public:
+    using ObjcProxyBase::ObjcProxyBase;
+    void onDone() override
+    {
+        @autoreleasepool {
+            [djinni_private_get_proxied_objc_object() onDone];
+        }
+    }
+};
+
+} // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto ObjectPlatformUncached::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::new_objc_proxy<ObjcProxy>(objc);
+}
+
+auto ObjectPlatformUncached::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).djinni_private_get_proxied_objc_object();
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSRecordSixteenInt.h"
+#include "RecordSixteenInt.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class TXSRecordSixteenInt;
+
+namespace djinni_generated {
+
+struct RecordSixteenInt
+{
+    using CppType = ::snapchat::djinni::benchmark::RecordSixteenInt;
+    using ObjcType = TXSRecordSixteenInt*;
+
+    using Boxed = RecordSixteenInt;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+} // namespace djinni_generated
@@ -0,0 +1,51 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSRecordSixteenInt+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto RecordSixteenInt::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I64::toCpp(obj.i1),
+            ::djinni::I64::toCpp(obj.i2),
+            ::djinni::I64::toCpp(obj.i3),
+            ::djinni::I64::toCpp(obj.i4),
+            ::djinni::I64::toCpp(obj.i5),
+            ::djinni::I64::toCpp(obj.i6),
+            ::djinni::I64::toCpp(obj.i7),
+            ::djinni::I64::toCpp(obj.i8),
+            ::djinni::I64::toCpp(obj.i9),
+            ::djinni::I64::toCpp(obj.i10),
+            ::djinni::I64::toCpp(obj.i11),
+            ::djinni::I64::toCpp(obj.i12),
+            ::djinni::I64::toCpp(obj.i13),
+            ::djinni::I64::toCpp(obj.i14),
+            ::djinni::I64::toCpp(obj.i15),
+            ::djinni::I64::toCpp(obj.i16)};
+}
+
+auto RecordSixteenInt::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[TXSRecordSixteenInt alloc] initWithI1:(::djinni::I64::fromCpp(cpp.i1))
+                                                i2:(::djinni::I64::fromCpp(cpp.i2))
+                                                i3:(::djinni::I64::fromCpp(cpp.i3))
+                                                i4:(::djinni::I64::fromCpp(cpp.i4))
+                                                i5:(::djinni::I64::fromCpp(cpp.i5))
+                                                i6:(::djinni::I64::fromCpp(cpp.i6))
+                                                i7:(::djinni::I64::fromCpp(cpp.i7))
+                                                i8:(::djinni::I64::fromCpp(cpp.i8))
+                                                i9:(::djinni::I64::fromCpp(cpp.i9))
+                                               i10:(::djinni::I64::fromCpp(cpp.i10))
+                                               i11:(::djinni::I64::fromCpp(cpp.i11))
+                                               i12:(::djinni::I64::fromCpp(cpp.i12))
+                                               i13:(::djinni::I64::fromCpp(cpp.i13))
+                                               i14:(::djinni::I64::fromCpp(cpp.i14))
+                                               i15:(::djinni::I64::fromCpp(cpp.i15))
+                                               i16:(::djinni::I64::fromCpp(cpp.i16))];
+}
+
+} // namespace djinni_generated
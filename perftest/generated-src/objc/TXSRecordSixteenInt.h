@@ -0,0 +1,74 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import <Foundation/Foundation.h>
+
+@interface TXSRecordSixteenInt : NSObject
+- (nonnull instancetype)init NS_UNAVAILABLE;
++ (nonnull instancetype)new NS_UNAVAILABLE;
+- (nonnull instancetype)initWithI1:(int64_t)i1
+                                i2:(int64_t)i2
+                                i3:(int64_t)i3
+                                i4:(int64_t)i4
+                                i5:(int64_t)i5
+                                i6:(int64_t)i6
+                                i7:(int64_t)i7
+                                i8:(int64_t)i8
+                                i9:(int64_t)i9
+                               i10:(int64_t)i10
+                               i11:(int64_t)i11
+                               i12:(int64_t)i12
+                               i13:(int64_t)i13
+                               i14:(int64_t)i14
+                               i15:(int64_t)i15
+                               i16:(int64_t)i16 NS_DESIGNATED_INITIALIZER;
++ (nonnull instancetype)RecordSixteenIntWithI1:(int64_t)i1
+                                            i2:(int64_t)i2
+                                            i3:(int64_t)i3
+                                            i4:(int64_t)i4
+                                            i5:(int64_t)i5
+                                            i6:(int64_t)i6
+                                            i7:(int64_t)i7
+                                            i8:(int64_t)i8
+                                            i9:(int64_t)i9
+                                           i10:(int64_t)i10
+                                           i11:(int64_t)i11
+                                           i12:(int64_t)i12
+                                           i13:(int64_t)i13
+                                           i14:(int64_t)i14
+                                           i15:(int64_t)i15
+                                           i16:(int64_t)i16;
+
+@property (nonatomic, readonly) int64_t i1;
+
+@property (nonatomic, readonly) int64_t i2;
+
+@property (nonatomic, readonly) int64_t i3;
+
+@property (nonatomic, readonly) int64_t i4;
+
+@property (nonatomic, readonly) int64_t i5;
+
+@property (nonatomic, readonly) int64_t i6;
+
+@property (nonatomic, readonly) int64_t i7;
+
+@property (nonatomic, readonly) int64_t i8;
+
+@property (nonatomic, readonly) int64_t i9;
+
+@property (nonatomic, readonly) int64_t i10;
+
+@property (nonatomic, readonly) int64_t i11;
+
+@property (nonatomic, readonly) int64_t i12;
+
+@property (nonatomic, readonly) int64_t i13;
+
+@property (nonatomic, readonly) int64_t i14;
+
+@property (nonatomic, readonly) int64_t i15;
+
+@property (nonatomic, readonly) int64_t i16;
+
+@end
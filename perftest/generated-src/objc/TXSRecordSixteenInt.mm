@@ -0,0 +1,89 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSRecordSixteenInt.h"
+
+
+@implementation TXSRecordSixteenInt
+
+- (nonnull instancetype)initWithI1:(int64_t)i1
+                                i2:(int64_t)i2
+                                i3:(int64_t)i3
+                                i4:(int64_t)i4
+                                i5:(int64_t)i5
+                                i6:(int64_t)i6
+                                i7:(int64_t)i7
+                                i8:(int64_t)i8
+                                i9:(int64_t)i9
+                               i10:(int64_t)i10
+                               i11:(int64_t)i11
+                               i12:(int64_t)i12
+                               i13:(int64_t)i13
+                               i14:(int64_t)i14
+                               i15:(int64_t)i15
+                               i16:(int64_t)i16
+{
+    if (self = [super init]) {
+        _i1 = i1;
+        _i2 = i2;
+        _i3 = i3;
+        _i4 = i4;
+        _i5 = i5;
+        _i6 = i6;
+        _i7 = i7;
+        _i8 = i8;
+        _i9 = i9;
+        _i10 = i10;
+        _i11 = i11;
+        _i12 = i12;
+        _i13 = i13;
+        _i14 = i14;
+        _i15 = i15;
+        _i16 = i16;
+    }
+    return self;
+}
+
++ (nonnull instancetype)RecordSixteenIntWithI1:(int64_t)i1
+                                            i2:(int64_t)i2
+                                            i3:(int64_t)i3
+                                            i4:(int64_t)i4
+                                            i5:(int64_t)i5
+                                            i6:(int64_t)i6
+                                            i7:(int64_t)i7
+                                            i8:(int64_t)i8
+                                            i9:(int64_t)i9
+                                           i10:(int64_t)i10
+                                           i11:(int64_t)i11
+                                           i12:(int64_t)i12
+                                           i13:(int64_t)i13
+                                           i14:(int64_t)i14
+                                           i15:(int64_t)i15
+                                           i16:(int64_t)i16
+{
+    return [[self alloc] initWithI1:i1
+                                 i2:i2
+                                 i3:i3
+                                 i4:i4
+                                 i5:i5
+                                 i6:i6
+                                 i7:i7
+                                 i8:i8
+                                 i9:i9
+                                i10:i10
+                                i11:i11
+                                i12:i12
+                                i13:i13
+                                i14:i14
+                                i15:i15
+                                i16:i16];
+}
+
+#ifndef DJINNI_DISABLE_DESCRIPTION_METHODS
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %p i1:%@ i2:%@ i3:%@ i4:%@ i5:%@ i6:%@ i7:%@ i8:%@ i9:%@ i10:%@ i11:%@ i12:%@ i13:%@ i14:%@ i15:%@ i16:%@>", self.class, (void *)self, @(self.i1), @(self.i2), @(self.i3), @(self.i4), @(self.i5), @(self.i6), @(self.i7), @(self.i8), @(self.i9), @(self.i10), @(self.i11), @(self.i12), @(self.i13), @(self.i14), @(self.i15), @(self.i16)];
+}
+
+#endif
+@end
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSRecordSixtyFourInt.h"
+#include "RecordSixtyFourInt.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class TXSRecordSixtyFourInt;
+
+namespace djinni_generated {
+
+struct RecordSixtyFourInt
+{
+    using CppType = ::snapchat::djinni::benchmark::RecordSixtyFourInt;
+    using ObjcType = TXSRecordSixtyFourInt*;
+
+    using Boxed = RecordSixtyFourInt;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+} // namespace djinni_generated
@@ -0,0 +1,147 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSRecordSixtyFourInt+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto RecordSixtyFourInt::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I64::toCpp(obj.i1),
+            ::djinni::I64::toCpp(obj.i2),
+            ::djinni::I64::toCpp(obj.i3),
+            ::djinni::I64::toCpp(obj.i4),
+            ::djinni::I64::toCpp(obj.i5),
+            ::djinni::I64::toCpp(obj.i6),
+            ::djinni::I64::toCpp(obj.i7),
+            ::djinni::I64::toCpp(obj.i8),
+            ::djinni::I64::toCpp(obj.i9),
+            ::djinni::I64::toCpp(obj.i10),
+            ::djinni::I64::toCpp(obj.i11),
+            ::djinni::I64::toCpp(obj.i12),
+            ::djinni::I64::toCpp(obj.i13),
+            ::djinni::I64::toCpp(obj.i14),
+            ::djinni::I64::toCpp(obj.i15),
+            ::djinni::I64::toCpp(obj.i16),
+            ::djinni::I64::toCpp(obj.i17),
+            ::djinni::I64::toCpp(obj.i18),
+            ::djinni::I64::toCpp(obj.i19),
+            ::djinni::I64::toCpp(obj.i20),
+            ::djinni::I64::toCpp(obj.i21),
+            ::djinni::I64::toCpp(obj.i22),
+            ::djinni::I64::toCpp(obj.i23),
+            ::djinni::I64::toCpp(obj.i24),
+            ::djinni::I64::toCpp(obj.i25),
+            ::djinni::I64::toCpp(obj.i26),
+            ::djinni::I64::toCpp(obj.i27),
+            ::djinni::I64::toCpp(obj.i28),
+            ::djinni::I64::toCpp(obj.i29),
+            ::djinni::I64::toCpp(obj.i30),
+            ::djinni::I64::toCpp(obj.i31),
+            ::djinni::I64::toCpp(obj.i32),
+            ::djinni::I64::toCpp(obj.i33),
+            ::djinni::I64::toCpp(obj.i34),
+            ::djinni::I64::toCpp(obj.i35),
+            ::djinni::I64::toCpp(obj.i36),
+            ::djinni::I64::toCpp(obj.i37),
+            ::djinni::I64::toCpp(obj.i38),
+            ::djinni::I64::toCpp(obj.i39),
+            ::djinni::I64::toCpp(obj.i40),
+            ::djinni::I64::toCpp(obj.i41),
+            ::djinni::I64::toCpp(obj.i42),
+            ::djinni::I64::toCpp(obj.i43),
+            ::djinni::I64::toCpp(obj.i44),
+            ::djinni::I64::toCpp(obj.i45),
+            ::djinni::I64::toCpp(obj.i46),
+            ::djinni::I64::toCpp(obj.i47),
+            ::djinni::I64::toCpp(obj.i48),
+            ::djinni::I64::toCpp(obj.i49),
+            ::djinni::I64::toCpp(obj.i50),
+            ::djinni::I64::toCpp(obj.i51),
+            ::djinni::I64::toCpp(obj.i52),
+            ::djinni::I64::toCpp(obj.i53),
+            ::djinni::I64::toCpp(obj.i54),
+            ::djinni::I64::toCpp(obj.i55),
+            ::djinni::I64::toCpp(obj.i56),
+            ::djinni::I64::toCpp(obj.i57),
+            ::djinni::I64::toCpp(obj.i58),
+            ::djinni::I64::toCpp(obj.i59),
+            ::djinni::I64::toCpp(obj.i60),
+            ::djinni::I64::toCpp(obj.i61),
+            ::djinni::I64::toCpp(obj.i62),
+            ::djinni::I64::toCpp(obj.i63),
+            ::djinni::I64::toCpp(obj.i64)};
+}
+
+auto RecordSixtyFourInt::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[TXSRecordSixtyFourInt alloc] initWithI1:(::djinni::I64::fromCpp(cpp.i1))
+                                                  i2:(::djinni::I64::fromCpp(cpp.i2))
+                                                  i3:(::djinni::I64::fromCpp(cpp.i3))
+                                                  i4:(::djinni::I64::fromCpp(cpp.i4))
+                                                  i5:(::djinni::I64::fromCpp(cpp.i5))
+                                                  i6:(::djinni::I64::fromCpp(cpp.i6))
+                                                  i7:(::djinni::I64::fromCpp(cpp.i7))
+                                                  i8:(::djinni::I64::fromCpp(cpp.i8))
+                                                  i9:(::djinni::I64::fromCpp(cpp.i9))
+                                                 i10:(::djinni::I64::fromCpp(cpp.i10))
+                                                 i11:(::djinni::I64::fromCpp(cpp.i11))
+                                                 i12:(::djinni::I64::fromCpp(cpp.i12))
+                                                 i13:(::djinni::I64::fromCpp(cpp.i13))
+                                                 i14:(::djinni::I64::fromCpp(cpp.i14))
+                                                 i15:(::djinni::I64::fromCpp(cpp.i15))
+                                                 i16:(::djinni::I64::fromCpp(cpp.i16))
+                                                 i17:(::djinni::I64::fromCpp(cpp.i17))
+                                                 i18:(::djinni::I64::fromCpp(cpp.i18))
+                                                 i19:(::djinni::I64::fromCpp(cpp.i19))
+                                                 i20:(::djinni::I64::fromCpp(cpp.i20))
+                                                 i21:(::djinni::I64::fromCpp(cpp.i21))
+                                                 i22:(::djinni::I64::fromCpp(cpp.i22))
+                                                 i23:(::djinni::I64::fromCpp(cpp.i23))
+                                                 i24:(::djinni::I64::fromCpp(cpp.i24))
+                                                 i25:(::djinni::I64::fromCpp(cpp.i25))
+                                                 i26:(::djinni::I64::fromCpp(cpp.i26))
+                                                 i27:(::djinni::I64::fromCpp(cpp.i27))
+                                                 i28:(::djinni::I64::fromCpp(cpp.i28))
+                                                 i29:(::djinni::I64::fromCpp(cpp.i29))
+                                                 i30:(::djinni::I64::fromCpp(cpp.i30))
+                                                 i31:(::djinni::I64::fromCpp(cpp.i31))
+                                                 i32:(::djinni::I64::fromCpp(cpp.i32))
+                                                 i33:(::djinni::I64::fromCpp(cpp.i33))
+                                                 i34:(::djinni::I64::fromCpp(cpp.i34))
+                                                 i35:(::djinni::I64::fromCpp(cpp.i35))
+                                                 i36:(::djinni::I64::fromCpp(cpp.i36))
+                                                 i37:(::djinni::I64::fromCpp(cpp.i37))
+                                                 i38:(::djinni::I64::fromCpp(cpp.i38))
+                                                 i39:(::djinni::I64::fromCpp(cpp.i39))
+                                                 i40:(::djinni::I64::fromCpp(cpp.i40))
+                                                 i41:(::djinni::I64::fromCpp(cpp.i41))
+                                                 i42:(::djinni::I64::fromCpp(cpp.i42))
+                                                 i43:(::djinni::I64::fromCpp(cpp.i43))
+                                                 i44:(::djinni::I64::fromCpp(cpp.i44))
+                                                 i45:(::djinni::I64::fromCpp(cpp.i45))
+                                                 i46:(::djinni::I64::fromCpp(cpp.i46))
+                                                 i47:(::djinni::I64::fromCpp(cpp.i47))
+                                                 i48:(::djinni::I64::fromCpp(cpp.i48))
+                                                 i49:(::djinni::I64::fromCpp(cpp.i49))
+                                                 i50:(::djinni::I64::fromCpp(cpp.i50))
+                                                 i51:(::djinni::I64::fromCpp(cpp.i51))
+                                                 i52:(::djinni::I64::fromCpp(cpp.i52))
+                                                 i53:(::djinni::I64::fromCpp(cpp.i53))
+                                                 i54:(::djinni::I64::fromCpp(cpp.i54))
+                                                 i55:(::djinni::I64::fromCpp(cpp.i55))
+                                                 i56:(::djinni::I64::fromCpp(cpp.i56))
+                                                 i57:(::djinni::I64::fromCpp(cpp.i57))
+                                                 i58:(::djinni::I64::fromCpp(cpp.i58))
+                                                 i59:(::djinni::I64::fromCpp(cpp.i59))
+                                                 i60:(::djinni::I64::fromCpp(cpp.i60))
+                                                 i61:(::djinni::I64::fromCpp(cpp.i61))
+                                                 i62:(::djinni::I64::fromCpp(cpp.i62))
+                                                 i63:(::djinni::I64::fromCpp(cpp.i63))
+                                                 i64:(::djinni::I64::fromCpp(cpp.i64))];
+}
+
+} // namespace djinni_generated
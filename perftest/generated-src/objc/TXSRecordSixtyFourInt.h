@@ -0,0 +1,266 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import <Foundation/Foundation.h>
+
+@interface TXSRecordSixtyFourInt : NSObject
+- (nonnull instancetype)init NS_UNAVAILABLE;
++ (nonnull instancetype)new NS_UNAVAILABLE;
+- (nonnull instancetype)initWithI1:(int64_t)i1
+                                i2:(int64_t)i2
+                                i3:(int64_t)i3
+                                i4:(int64_t)i4
+                                i5:(int64_t)i5
+                                i6:(int64_t)i6
+                                i7:(int64_t)i7
+                                i8:(int64_t)i8
+                                i9:(int64_t)i9
+                               i10:(int64_t)i10
+                               i11:(int64_t)i11
+                               i12:(int64_t)i12
+                               i13:(int64_t)i13
+                               i14:(int64_t)i14
+                               i15:(int64_t)i15
+                               i16:(int64_t)i16
+                               i17:(int64_t)i17
+                               i18:(int64_t)i18
+                               i19:(int64_t)i19
+                               i20:(int64_t)i20
+                               i21:(int64_t)i21
+                               i22:(int64_t)i22
+                               i23:(int64_t)i23
+                               i24:(int64_t)i24
+                               i25:(int64_t)i25
+                               i26:(int64_t)i26
+                               i27:(int64_t)i27
+                               i28:(int64_t)i28
+                               i29:(int64_t)i29
+                               i30:(int64_t)i30
+                               i31:(int64_t)i31
+                               i32:(int64_t)i32
+                               i33:(int64_t)i33
+                               i34:(int64_t)i34
+                               i35:(int64_t)i35
+                               i36:(int64_t)i36
+                               i37:(int64_t)i37
+                               i38:(int64_t)i38
+                               i39:(int64_t)i39
+                               i40:(int64_t)i40
+                               i41:(int64_t)i41
+                               i42:(int64_t)i42
+                               i43:(int64_t)i43
+                               i44:(int64_t)i44
+                               i45:(int64_t)i45
+                               i46:(int64_t)i46
+                               i47:(int64_t)i47
+                               i48:(int64_t)i48
+                               i49:(int64_t)i49
+                               i50:(int64_t)i50
+                               i51:(int64_t)i51
+                               i52:(int64_t)i52
+                               i53:(int64_t)i53
+                               i54:(int64_t)i54
+                               i55:(int64_t)i55
+                               i56:(int64_t)i56
+                               i57:(int64_t)i57
+                               i58:(int64_t)i58
+                               i59:(int64_t)i59
+                               i60:(int64_t)i60
+                               i61:(int64_t)i61
+                               i62:(int64_t)i62
+                               i63:(int64_t)i63
+                               i64:(int64_t)i64 NS_DESIGNATED_INITIALIZER;
++ (nonnull instancetype)RecordSixtyFourIntWithI1:(int64_t)i1
+                                              i2:(int64_t)i2
+                                              i3:(int64_t)i3
+                                              i4:(int64_t)i4
+                                              i5:(int64_t)i5
+                                              i6:(int64_t)i6
+                                              i7:(int64_t)i7
+                                              i8:(int64_t)i8
+                                              i9:(int64_t)i9
+                                             i10:(int64_t)i10
+                                             i11:(int64_t)i11
+                                             i12:(int64_t)i12
+                                             i13:(int64_t)i13
+                                             i14:(int64_t)i14
+                                             i15:(int64_t)i15
+                                             i16:(int64_t)i16
+                                             i17:(int64_t)i17
+                                             i18:(int64_t)i18
+                                             i19:(int64_t)i19
+                                             i20:(int64_t)i20
+                                             i21:(int64_t)i21
+                                             i22:(int64_t)i22
+                                             i23:(int64_t)i23
+                                             i24:(int64_t)i24
+                                             i25:(int64_t)i25
+                                             i26:(int64_t)i26
+                                             i27:(int64_t)i27
+                                             i28:(int64_t)i28
+                                             i29:(int64_t)i29
+                                             i30:(int64_t)i30
+                                             i31:(int64_t)i31
+                                             i32:(int64_t)i32
+                                             i33:(int64_t)i33
+                                             i34:(int64_t)i34
+                                             i35:(int64_t)i35
+                                             i36:(int64_t)i36
+                                             i37:(int64_t)i37
+                                             i38:(int64_t)i38
+                                             i39:(int64_t)i39
+                                             i40:(int64_t)i40
+                                             i41:(int64_t)i41
+                                             i42:(int64_t)i42
+                                             i43:(int64_t)i43
+                                             i44:(int64_t)i44
+                                             i45:(int64_t)i45
+                                             i46:(int64_t)i46
+                                             i47:(int64_t)i47
+                                             i48:(int64_t)i48
+                                             i49:(int64_t)i49
+                                             i50:(int64_t)i50
+                                             i51:(int64_t)i51
+                                             i52:(int64_t)i52
+                                             i53:(int64_t)i53
+                                             i54:(int64_t)i54
+                                             i55:(int64_t)i55
+                                             i56:(int64_t)i56
+                                             i57:(int64_t)i57
+                                             i58:(int64_t)i58
+                                             i59:(int64_t)i59
+                                             i60:(int64_t)i60
+                                             i61:(int64_t)i61
+                                             i62:(int64_t)i62
+                                             i63:(int64_t)i63
+                                             i64:(int64_t)i64;
+
+@property (nonatomic, readonly) int64_t i1;
+
+@property (nonatomic, readonly) int64_t i2;
+
+@property (nonatomic, readonly) int64_t i3;
+
+@property (nonatomic, readonly) int64_t i4;
+
+@property (nonatomic, readonly) int64_t i5;
+
+@property (nonatomic, readonly) int64_t i6;
+
+@property (nonatomic, readonly) int64_t i7;
+
+@property (nonatomic, readonly) int64_t i8;
+
+@property (nonatomic, readonly) int64_t i9;
+
+@property (nonatomic, readonly) int64_t i10;
+
+@property (nonatomic, readonly) int64_t i11;
+
+@property (nonatomic, readonly) int64_t i12;
+
+@property (nonatomic, readonly) int64_t i13;
+
+@property (nonatomic, readonly) int64_t i14;
+
+@property (nonatomic, readonly) int64_t i15;
+
+@property (nonatomic, readonly) int64_t i16;
+
+@property (nonatomic, readonly) int64_t i17;
+
+@property (nonatomic, readonly) int64_t i18;
+
+@property (nonatomic, readonly) int64_t i19;
+
+@property (nonatomic, readonly) int64_t i20;
+
+@property (nonatomic, readonly) int64_t i21;
+
+@property (nonatomic, readonly) int64_t i22;
+
+@property (nonatomic, readonly) int64_t i23;
+
+@property (nonatomic, readonly) int64_t i24;
+
+@property (nonatomic, readonly) int64_t i25;
+
+@property (nonatomic, readonly) int64_t i26;
+
+@property (nonatomic, readonly) int64_t i27;
+
+@property (nonatomic, readonly) int64_t i28;
+
+@property (nonatomic, readonly) int64_t i29;
+
+@property (nonatomic, readonly) int64_t i30;
+
+@property (nonatomic, readonly) int64_t i31;
+
+@property (nonatomic, readonly) int64_t i32;
+
+@property (nonatomic, readonly) int64_t i33;
+
+@property (nonatomic, readonly) int64_t i34;
+
+@property (nonatomic, readonly) int64_t i35;
+
+@property (nonatomic, readonly) int64_t i36;
+
+@property (nonatomic, readonly) int64_t i37;
+
+@property (nonatomic, readonly) int64_t i38;
+
+@property (nonatomic, readonly) int64_t i39;
+
+@property (nonatomic, readonly) int64_t i40;
+
+@property (nonatomic, readonly) int64_t i41;
+
+@property (nonatomic, readonly) int64_t i42;
+
+@property (nonatomic, readonly) int64_t i43;
+
+@property (nonatomic, readonly) int64_t i44;
+
+@property (nonatomic, readonly) int64_t i45;
+
+@property (nonatomic, readonly) int64_t i46;
+
+@property (nonatomic, readonly) int64_t i47;
+
+@property (nonatomic, readonly) int64_t i48;
+
+@property (nonatomic, readonly) int64_t i49;
+
+@property (nonatomic, readonly) int64_t i50;
+
+@property (nonatomic, readonly) int64_t i51;
+
+@property (nonatomic, readonly) int64_t i52;
+
+@property (nonatomic, readonly) int64_t i53;
+
+@property (nonatomic, readonly) int64_t i54;
+
+@property (nonatomic, readonly) int64_t i55;
+
+@property (nonatomic, readonly) int64_t i56;
+
+@property (nonatomic, readonly) int64_t i57;
+
+@property (nonatomic, readonly) int64_t i58;
+
+@property (nonatomic, readonly) int64_t i59;
+
+@property (nonatomic, readonly) int64_t i60;
+
+@property (nonatomic, readonly) int64_t i61;
+
+@property (nonatomic, readonly) int64_t i62;
+
+@property (nonatomic, readonly) int64_t i63;
+
+@property (nonatomic, readonly) int64_t i64;
+
+@end
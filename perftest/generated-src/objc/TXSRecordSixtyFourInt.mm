@@ -0,0 +1,281 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#import "TXSRecordSixtyFourInt.h"
+
+
+@implementation TXSRecordSixtyFourInt
+
+- (nonnull instancetype)initWithI1:(int64_t)i1
+                                i2:(int64_t)i2
+                                i3:(int64_t)i3
+                                i4:(int64_t)i4
+                                i5:(int64_t)i5
+                                i6:(int64_t)i6
+                                i7:(int64_t)i7
+                                i8:(int64_t)i8
+                                i9:(int64_t)i9
+                               i10:(int64_t)i10
+                               i11:(int64_t)i11
+                               i12:(int64_t)i12
+                               i13:(int64_t)i13
+                               i14:(int64_t)i14
+                               i15:(int64_t)i15
+                               i16:(int64_t)i16
+                               i17:(int64_t)i17
+                               i18:(int64_t)i18
+                               i19:(int64_t)i19
+                               i20:(int64_t)i20
+                               i21:(int64_t)i21
+                               i22:(int64_t)i22
+                               i23:(int64_t)i23
+                               i24:(int64_t)i24
+                               i25:(int64_t)i25
+                               i26:(int64_t)i26
+                               i27:(int64_t)i27
+                               i28:(int64_t)i28
+                               i29:(int64_t)i29
+                               i30:(int64_t)i30
+                               i31:(int64_t)i31
+                               i32:(int64_t)i32
+                               i33:(int64_t)i33
+                               i34:(int64_t)i34
+                               i35:(int64_t)i35
+                               i36:(int64_t)i36
+                               i37:(int64_t)i37
+                               i38:(int64_t)i38
+                               i39:(int64_t)i39
+                               i40:(int64_t)i40
+                               i41:(int64_t)i41
+                               i42:(int64_t)i42
+                               i43:(int64_t)i43
+                               i44:(int64_t)i44
+                               i45:(int64_t)i45
+                               i46:(int64_t)i46
+                               i47:(int64_t)i47
+                               i48:(int64_t)i48
+                               i49:(int64_t)i49
+                               i50:(int64_t)i50
+                               i51:(int64_t)i51
+                               i52:(int64_t)i52
+                               i53:(int64_t)i53
+                               i54:(int64_t)i54
+                               i55:(int64_t)i55
+                               i56:(int64_t)i56
+                               i57:(int64_t)i57
+                               i58:(int64_t)i58
+                               i59:(int64_t)i59
+                               i60:(int64_t)i60
+                               i61:(int64_t)i61
+                               i62:(int64_t)i62
+                               i63:(int64_t)i63
+                               i64:(int64_t)i64
+{
+    if (self = [super init]) {
+        _i1 = i1;
+        _i2 = i2;
+        _i3 = i3;
+        _i4 = i4;
+        _i5 = i5;
+        _i6 = i6;
+        _i7 = i7;
+        _i8 = i8;
+        _i9 = i9;
+        _i10 = i10;
+        _i11 = i11;
+        _i12 = i12;
+        _i13 = i13;
+        _i14 = i14;
+        _i15 = i15;
+        _i16 = i16;
+        _i17 = i17;
+        _i18 = i18;
+        _i19 = i19;
+        _i20 = i20;
+        _i21 = i21;
+        _i22 = i22;
+        _i23 = i23;
+        _i24 = i24;
+        _i25 = i25;
+        _i26 = i26;
+        _i27 = i27;
+        _i28 = i28;
+        _i29 = i29;
+        _i30 = i30;
+        _i31 = i31;
+        _i32 = i32;
+        _i33 = i33;
+        _i34 = i34;
+        _i35 = i35;
+        _i36 = i36;
+        _i37 = i37;
+        _i38 = i38;
+        _i39 = i39;
+        _i40 = i40;
+        _i41 = i41;
+        _i42 = i42;
+        _i43 = i43;
+        _i44 = i44;
+        _i45 = i45;
+        _i46 = i46;
+        _i47 = i47;
+        _i48 = i48;
+        _i49 = i49;
+        _i50 = i50;
+        _i51 = i51;
+        _i52 = i52;
+        _i53 = i53;
+        _i54 = i54;
+        _i55 = i55;
+        _i56 = i56;
+        _i57 = i57;
+        _i58 = i58;
+        _i59 = i59;
+        _i60 = i60;
+        _i61 = i61;
+        _i62 = i62;
+        _i63 = i63;
+        _i64 = i64;
+    }
+    return self;
+}
+
++ (nonnull instancetype)RecordSixtyFourIntWithI1:(int64_t)i1
+                                              i2:(int64_t)i2
+                                              i3:(int64_t)i3
+                                              i4:(int64_t)i4
+                                              i5:(int64_t)i5
+                                              i6:(int64_t)i6
+                                              i7:(int64_t)i7
+                                              i8:(int64_t)i8
+                                              i9:(int64_t)i9
+                                             i10:(int64_t)i10
+                                             i11:(int64_t)i11
+                                             i12:(int64_t)i12
+                                             i13:(int64_t)i13
+                                             i14:(int64_t)i14
+                                             i15:(int64_t)i15
+                                             i16:(int64_t)i16
+                                             i17:(int64_t)i17
+                                             i18:(int64_t)i18
+                                             i19:(int64_t)i19
+                                             i20:(int64_t)i20
+                                             i21:(int64_t)i21
+                                             i22:(int64_t)i22
+                                             i23:(int64_t)i23
+                                             i24:(int64_t)i24
+                                             i25:(int64_t)i25
+                                             i26:(int64_t)i26
+                                             i27:(int64_t)i27
+                                             i28:(int64_t)i28
+                                             i29:(int64_t)i29
+                                             i30:(int64_t)i30
+                                             i31:(int64_t)i31
+                                             i32:(int64_t)i32
+                                             i33:(int64_t)i33
+                                             i34:(int64_t)i34
+                                             i35:(int64_t)i35
+                                             i36:(int64_t)i36
+                                             i37:(int64_t)i37
+                                             i38:(int64_t)i38
+                                             i39:(int64_t)i39
+                                             i40:(int64_t)i40
+                                             i41:(int64_t)i41
+                                             i42:(int64_t)i42
+                                             i43:(int64_t)i43
+                                             i44:(int64_t)i44
+                                             i45:(int64_t)i45
+                                             i46:(int64_t)i46
+                                             i47:(int64_t)i47
+                                             i48:(int64_t)i48
+                                             i49:(int64_t)i49
+                                             i50:(int64_t)i50
+                                             i51:(int64_t)i51
+                                             i52:(int64_t)i52
+                                             i53:(int64_t)i53
+                                             i54:(int64_t)i54
+                                             i55:(int64_t)i55
+                                             i56:(int64_t)i56
+                                             i57:(int64_t)i57
+                                             i58:(int64_t)i58
+                                             i59:(int64_t)i59
+                                             i60:(int64_t)i60
+                                             i61:(int64_t)i61
+                                             i62:(int64_t)i62
+                                             i63:(int64_t)i63
+                                             i64:(int64_t)i64
+{
+    return [[self alloc] initWithI1:i1
+                                 i2:i2
+                                 i3:i3
+                                 i4:i4
+                                 i5:i5
+                                 i6:i6
+                                 i7:i7
+                                 i8:i8
+                                 i9:i9
+                                i10:i10
+                                i11:i11
+                                i12:i12
+                                i13:i13
+                                i14:i14
+                                i15:i15
+                                i16:i16
+                                i17:i17
+                                i18:i18
+                                i19:i19
+                                i20:i20
+                                i21:i21
+                                i22:i22
+                                i23:i23
+                                i24:i24
+                                i25:i25
+                                i26:i26
+                                i27:i27
+                                i28:i28
+                                i29:i29
+                                i30:i30
+                                i31:i31
+                                i32:i32
+                                i33:i33
+                                i34:i34
+                                i35:i35
+                                i36:i36
+                                i37:i37
+                                i38:i38
+                                i39:i39
+                                i40:i40
+                                i41:i41
+                                i42:i42
+                                i43:i43
+                                i44:i44
+                                i45:i45
+                                i46:i46
+                                i47:i47
+                                i48:i48
+                                i49:i49
+                                i50:i50
+                                i51:i51
+                                i52:i52
+                                i53:i53
+                                i54:i54
+                                i55:i55
+                                i56:i56
+                                i57:i57
+                                i58:i58
+                                i59:i59
+                                i60:i60
+                                i61:i61
+                                i62:i62
+                                i63:i63
+                                i64:i64];
+}
+
+#ifndef DJINNI_DISABLE_DESCRIPTION_METHODS
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %p i1:%@ i2:%@ i3:%@ i4:%@ i5:%@ i6:%@ i7:%@ i8:%@ i9:%@ i10:%@ i11:%@ i12:%@ i13:%@ i14:%@ i15:%@ i16:%@ i17:%@ i18:%@ i19:%@ i20:%@ i21:%@ i22:%@ i23:%@ i24:%@ i25:%@ i26:%@ i27:%@ i28:%@ i29:%@ i30:%@ i31:%@ i32:%@ i33:%@ i34:%@ i35:%@ i36:%@ i37:%@ i38:%@ i39:%@ i40:%@ i41:%@ i42:%@ i43:%@ i44:%@ i45:%@ i46:%@ i47:%@ i48:%@ i49:%@ i50:%@ i51:%@ i52:%@ i53:%@ i54:%@ i55:%@ i56:%@ i57:%@ i58:%@ i59:%@ i60:%@ i61:%@ i62:%@ i63:%@ i64:%@>", self.class, (void *)self, @(self.i1), @(self.i2), @(self.i3), @(self.i4), @(self.i5), @(self.i6), @(self.i7), @(self.i8), @(self.i9), @(self.i10), @(self.i11), @(self.i12), @(self.i13), @(self.i14), @(self.i15), @(self.i16), @(self.i17), @(self.i18), @(self.i19), @(self.i20), @(self.i21), @(self.i22), @(self.i23), @(self.i24), @(self.i25), @(self.i26), @(self.i27), @(self.i28), @(self.i29), @(self.i30), @(self.i31), @(self.i32), @(self.i33), @(self.i34), @(self.i35), @(self.i36), @(self.i37), @(self.i38), @(self.i39), @(self.i40), @(self.i41), @(self.i42), @(self.i43), @(self.i44), @(self.i45), @(self.i46), @(self.i47), @(self.i48), @(self.i49), @(self.i50), @(self.i51), @(self.i52), @(self.i53), @(self.i54), @(self.i55), @(self.i56), @(self.i57), @(self.i58), @(self.i59), @(self.i60), @(self.i61), @(self.i62), @(self.i63), @(self.i64)];
+}
+
+#endif
+@end
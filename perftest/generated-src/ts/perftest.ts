@@ -11,6 +11,41 @@ export enum EnumSixValue {
     SIXTH = 5,
 }
 
+export enum FlagsThirtyTwoValue {
+    FLAG1 = 1 << 0,
+    FLAG2 = 1 << 1,
+    FLAG3 = 1 << 2,
+    FLAG4 = 1 << 3,
+    FLAG5 = 1 << 4,
+    FLAG6 = 1 << 5,
+    FLAG7 = 1 << 6,
+    FLAG8 = 1 << 7,
+    FLAG9 = 1 << 8,
+    FLAG10 = 1 << 9,
+    FLAG11 = 1 << 10,
+    FLAG12 = 1 << 11,
+    FLAG13 = 1 << 12,
+    FLAG14 = 1 << 13,
+    FLAG15 = 1 << 14,
+    FLAG16 = 1 << 15,
+    FLAG17 = 1 << 16,
+    FLAG18 = 1 << 17,
+    FLAG19 = 1 << 18,
+    FLAG20 = 1 << 19,
+    FLAG21 = 1 << 20,
+    FLAG22 = 1 << 21,
+    FLAG23 = 1 << 22,
+    FLAG24 = 1 << 23,
+    FLAG25 = 1 << 24,
+    FLAG26 = 1 << 25,
+    FLAG27 = 1 << 26,
+    FLAG28 = 1 << 27,
+    FLAG29 = 1 << 28,
+    FLAG30 = 1 << 29,
+    FLAG31 = 1 << 30,
+    FLAG32 = 1 << 31,
+}
+
 export interface /*record*/ RecordSixInt {
     i1: bigint;
     i2: bigint;
@@ -20,16 +55,112 @@ export interface /*record*/ RecordSixInt {
     i6: bigint;
 }
 
+export interface /*record*/ RecordSixteenInt {
+    i1: bigint;
+    i2: bigint;
+    i3: bigint;
+    i4: bigint;
+    i5: bigint;
+    i6: bigint;
+    i7: bigint;
+    i8: bigint;
+    i9: bigint;
+    i10: bigint;
+    i11: bigint;
+    i12: bigint;
+    i13: bigint;
+    i14: bigint;
+    i15: bigint;
+    i16: bigint;
+}
+
+export interface /*record*/ RecordSixtyFourInt {
+    i1: bigint;
+    i2: bigint;
+    i3: bigint;
+    i4: bigint;
+    i5: bigint;
+    i6: bigint;
+    i7: bigint;
+    i8: bigint;
+    i9: bigint;
+    i10: bigint;
+    i11: bigint;
+    i12: bigint;
+    i13: bigint;
+    i14: bigint;
+    i15: bigint;
+    i16: bigint;
+    i17: bigint;
+    i18: bigint;
+    i19: bigint;
+    i20: bigint;
+    i21: bigint;
+    i22: bigint;
+    i23: bigint;
+    i24: bigint;
+    i25: bigint;
+    i26: bigint;
+    i27: bigint;
+    i28: bigint;
+    i29: bigint;
+    i30: bigint;
+    i31: bigint;
+    i32: bigint;
+    i33: bigint;
+    i34: bigint;
+    i35: bigint;
+    i36: bigint;
+    i37: bigint;
+    i38: bigint;
+    i39: bigint;
+    i40: bigint;
+    i41: bigint;
+    i42: bigint;
+    i43: bigint;
+    i44: bigint;
+    i45: bigint;
+    i46: bigint;
+    i47: bigint;
+    i48: bigint;
+    i49: bigint;
+    i50: bigint;
+    i51: bigint;
+    i52: bigint;
+    i53: bigint;
+    i54: bigint;
+    i55: bigint;
+    i56: bigint;
+    i57: bigint;
+    i58: bigint;
+    i59: bigint;
+    i60: bigint;
+    i61: bigint;
+    i62: bigint;
+    i63: bigint;
+    i64: bigint;
+}
+
 /** interfaces for native C++ objects, to be returned from C++ */
 export interface ObjectNative {
     baseline(): void;
 }
 
+/** same as ObjectNative, but without identity caching */
+export interface ObjectNativeUncached {
+    baseline(): void;
+}
+
 /** interfaces for platform Java or Objective-C objects, to be passed to C++ */
 export interface ObjectPlatform {
     onDone(): void;
 }
 
+/** same as ObjectPlatform, but without identity caching */
+export interface ObjectPlatformUncached {
+    onDone(): void;
+}
+
 /** djinni_perf_benchmark: This interface will be implemented in C++ and can be called from any language. */
 export interface DjinniPerfBenchmark {
     cppTests(): bigint;
@@ -39,22 +170,39 @@ export interface DjinniPerfBenchmark {
     argDataRef(r: Uint8Array): void;
     argDataView(d: Uint8Array): void;
     argEnumSixValue(e: EnumSixValue): void;
+    argFlagsThirtyTwoValue(f: FlagsThirtyTwoValue): void;
     argRecordSixInt(r: RecordSixInt): void;
     argListInt(v: Array<bigint>): void;
     argArrayInt(v: BigInt64Array): void;
     argObject(c: ObjectPlatform): void;
+    argObjectUncached(c: ObjectPlatformUncached): void;
+    callObjectFromThread(c: ObjectPlatform, count: number): void;
     argListObject(l: Array<ObjectPlatform>): void;
     argListRecord(l: Array<RecordSixInt>): void;
+    argListRecordSixteenInt(l: Array<RecordSixteenInt>): void;
+    argListRecordSixtyFourInt(l: Array<RecordSixtyFourInt>): void;
     argArrayRecord(a: Array<RecordSixInt>): void;
+    argMapStringInt(m: Map<string, bigint>): void;
+    argSetString(s: Set<string>): void;
     returnInt(i: bigint): bigint;
+    returnEnumSixValue(): EnumSixValue;
+    returnFlagsThirtyTwoValue(count: number): FlagsThirtyTwoValue;
     returnString(size: number): string;
+    returnShortString(index: number): string;
+    returnInternedString(index: number): string;
     returnBinary(size: number): Uint8Array;
+    returnBinaryBuffer(size: number): Uint8Array;
     returnObject(): ObjectNative;
+    returnObjectUncached(): ObjectNativeUncached;
     returnListInt(size: number): Array<bigint>;
     returnArrayInt(size: number): BigInt64Array;
     returnListObject(size: number): Array<ObjectNative>;
     returnListRecord(size: number): Array<RecordSixInt>;
+    returnListRecordSixteenInt(size: number): Array<RecordSixteenInt>;
+    returnListRecordSixtyFourInt(size: number): Array<RecordSixtyFourInt>;
     returnArrayRecord(size: number): Array<RecordSixInt>;
+    returnMapStringInt(size: number): Map<string, bigint>;
+    returnSetString(size: number): Set<string>;
     roundTripString(s: string): string;
 }
 export interface DjinniPerfBenchmark_statics {
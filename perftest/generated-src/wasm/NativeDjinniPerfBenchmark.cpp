@@ -5,9 +5,14 @@
 #include "DataRef_wasm.hpp"
 #include "DataView_wasm.hpp"
 #include "NativeEnumSixValue.hpp"
+#include "NativeFlagsThirtyTwoValue.hpp"
 #include "NativeObjectNative.hpp"
+#include "NativeObjectNativeUncached.hpp"
 #include "NativeObjectPlatform.hpp"
+#include "NativeObjectPlatformUncached.hpp"
 #include "NativeRecordSixInt.hpp"
+#include "NativeRecordSixteenInt.hpp"
+#include "NativeRecordSixtyFourInt.hpp"
 
 namespace djinni_generated {
 
@@ -20,22 +25,39 @@ em::val NativeDjinniPerfBenchmark::cppProxyMethods() {
         "argDataRef",
         "argDataView",
         "argEnumSixValue",
+        "argFlagsThirtyTwoValue",
         "argRecordSixInt",
         "argListInt",
         "argArrayInt",
         "argObject",
+        "argObjectUncached",
+        "callObjectFromThread",
         "argListObject",
         "argListRecord",
+        "argListRecordSixteenInt",
+        "argListRecordSixtyFourInt",
         "argArrayRecord",
+        "argMapStringInt",
+        "argSetString",
         "returnInt",
+        "returnEnumSixValue",
+        "returnFlagsThirtyTwoValue",
         "returnString",
+        "returnShortString",
+        "returnInternedString",
         "returnBinary",
+        "returnBinaryBuffer",
         "returnObject",
+        "returnObjectUncached",
         "returnListInt",
         "returnArrayInt",
         "returnListObject",
         "returnListRecord",
+        "returnListRecordSixteenInt",
+        "returnListRecordSixtyFourInt",
         "returnArrayRecord",
+        "returnMapStringInt",
+        "returnSetString",
         "roundTripString",
     });
     return methods;
@@ -107,6 +129,14 @@ void NativeDjinniPerfBenchmark::argEnumSixValue(const CppType& self, int32_t w_e
         return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
     }
 }
+void NativeDjinniPerfBenchmark::argFlagsThirtyTwoValue(const CppType& self, int32_t w_f) {
+    try {
+        self->argFlagsThirtyTwoValue(::djinni_generated::NativeFlagsThirtyTwoValue::toCpp(w_f));
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
 void NativeDjinniPerfBenchmark::argRecordSixInt(const CppType& self, const em::val& w_r) {
     try {
         self->argRecordSixInt(::djinni_generated::NativeRecordSixInt::toCpp(w_r));
@@ -139,6 +169,23 @@ void NativeDjinniPerfBenchmark::argObject(const CppType& self, const em::val& w_
         return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
     }
 }
+void NativeDjinniPerfBenchmark::argObjectUncached(const CppType& self, const em::val& w_c) {
+    try {
+        self->argObjectUncached(::djinni_generated::NativeObjectPlatformUncached::toCpp(w_c));
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
+void NativeDjinniPerfBenchmark::callObjectFromThread(const CppType& self, const em::val& w_c,int32_t w_count) {
+    try {
+        self->callObjectFromThread(::djinni_generated::NativeObjectPlatform::toCpp(w_c),
+                             ::djinni::I32::toCpp(w_count));
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
 void NativeDjinniPerfBenchmark::argListObject(const CppType& self, const em::val& w_l) {
     try {
         self->argListObject(::djinni::List<::djinni_generated::NativeObjectPlatform>::toCpp(w_l));
@@ -155,6 +202,22 @@ void NativeDjinniPerfBenchmark::argListRecord(const CppType& self, const em::val
         return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
     }
 }
+void NativeDjinniPerfBenchmark::argListRecordSixteenInt(const CppType& self, const em::val& w_l) {
+    try {
+        self->argListRecordSixteenInt(::djinni::List<::djinni_generated::NativeRecordSixteenInt>::toCpp(w_l));
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
+void NativeDjinniPerfBenchmark::argListRecordSixtyFourInt(const CppType& self, const em::val& w_l) {
+    try {
+        self->argListRecordSixtyFourInt(::djinni::List<::djinni_generated::NativeRecordSixtyFourInt>::toCpp(w_l));
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
 void NativeDjinniPerfBenchmark::argArrayRecord(const CppType& self, const em::val& w_a) {
     try {
         self->argArrayRecord(::djinni::List<::djinni_generated::NativeRecordSixInt>::toCpp(w_a));
@@ -163,6 +226,22 @@ void NativeDjinniPerfBenchmark::argArrayRecord(const CppType& self, const em::va
         return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
     }
 }
+void NativeDjinniPerfBenchmark::argMapStringInt(const CppType& self, const em::val& w_m) {
+    try {
+        self->argMapStringInt(::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(w_m));
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
+void NativeDjinniPerfBenchmark::argSetString(const CppType& self, const em::val& w_s) {
+    try {
+        self->argSetString(::djinni::Set<::djinni::String>::toCpp(w_s));
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
 int64_t NativeDjinniPerfBenchmark::returnInt(const CppType& self, int64_t w_i) {
     try {
         auto r = self->returnInt(::djinni::I64::toCpp(w_i));
@@ -172,6 +251,24 @@ int64_t NativeDjinniPerfBenchmark::returnInt(const CppType& self, int64_t w_i) {
         return ::djinni::ExceptionHandlingTraits<::djinni::I64>::handleNativeException(e);
     }
 }
+int32_t NativeDjinniPerfBenchmark::returnEnumSixValue(const CppType& self) {
+    try {
+        auto r = self->returnEnumSixValue();
+        return ::djinni_generated::NativeEnumSixValue::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni_generated::NativeEnumSixValue>::handleNativeException(e);
+    }
+}
+int32_t NativeDjinniPerfBenchmark::returnFlagsThirtyTwoValue(const CppType& self, int32_t w_count) {
+    try {
+        auto r = self->returnFlagsThirtyTwoValue(::djinni::I32::toCpp(w_count));
+        return ::djinni_generated::NativeFlagsThirtyTwoValue::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni_generated::NativeFlagsThirtyTwoValue>::handleNativeException(e);
+    }
+}
 std::string NativeDjinniPerfBenchmark::returnString(const CppType& self, int32_t w_size) {
     try {
         auto r = self->returnString(::djinni::I32::toCpp(w_size));
@@ -181,6 +278,24 @@ std::string NativeDjinniPerfBenchmark::returnString(const CppType& self, int32_t
         return ::djinni::ExceptionHandlingTraits<::djinni::String>::handleNativeException(e);
     }
 }
+std::string NativeDjinniPerfBenchmark::returnShortString(const CppType& self, int32_t w_index) {
+    try {
+        auto r = self->returnShortString(::djinni::I32::toCpp(w_index));
+        return ::djinni::String::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::String>::handleNativeException(e);
+    }
+}
+std::string NativeDjinniPerfBenchmark::returnInternedString(const CppType& self, int32_t w_index) {
+    try {
+        auto r = self->returnInternedString(::djinni::I32::toCpp(w_index));
+        return ::djinni::String::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::String>::handleNativeException(e);
+    }
+}
 em::val NativeDjinniPerfBenchmark::returnBinary(const CppType& self, int32_t w_size) {
     try {
         auto r = self->returnBinary(::djinni::I32::toCpp(w_size));
@@ -190,6 +305,15 @@ em::val NativeDjinniPerfBenchmark::returnBinary(const CppType& self, int32_t w_s
         return ::djinni::ExceptionHandlingTraits<::djinni::Binary>::handleNativeException(e);
     }
 }
+em::val NativeDjinniPerfBenchmark::returnBinaryBuffer(const CppType& self, int32_t w_size) {
+    try {
+        auto r = self->returnBinaryBuffer(::djinni::I32::toCpp(w_size));
+        return ::djinni::Binary::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Binary>::handleNativeException(e);
+    }
+}
 em::val NativeDjinniPerfBenchmark::returnObject(const CppType& self) {
     try {
         auto r = self->returnObject();
@@ -199,6 +323,15 @@ em::val NativeDjinniPerfBenchmark::returnObject(const CppType& self) {
         return ::djinni::ExceptionHandlingTraits<::djinni_generated::NativeObjectNative>::handleNativeException(e);
     }
 }
+em::val NativeDjinniPerfBenchmark::returnObjectUncached(const CppType& self) {
+    try {
+        auto r = self->returnObjectUncached();
+        return ::djinni_generated::NativeObjectNativeUncached::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni_generated::NativeObjectNativeUncached>::handleNativeException(e);
+    }
+}
 em::val NativeDjinniPerfBenchmark::returnListInt(const CppType& self, int32_t w_size) {
     try {
         auto r = self->returnListInt(::djinni::I32::toCpp(w_size));
@@ -235,6 +368,24 @@ em::val NativeDjinniPerfBenchmark::returnListRecord(const CppType& self, int32_t
         return ::djinni::ExceptionHandlingTraits<::djinni::List<::djinni_generated::NativeRecordSixInt>>::handleNativeException(e);
     }
 }
+em::val NativeDjinniPerfBenchmark::returnListRecordSixteenInt(const CppType& self, int32_t w_size) {
+    try {
+        auto r = self->returnListRecordSixteenInt(::djinni::I32::toCpp(w_size));
+        return ::djinni::List<::djinni_generated::NativeRecordSixteenInt>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::List<::djinni_generated::NativeRecordSixteenInt>>::handleNativeException(e);
+    }
+}
+em::val NativeDjinniPerfBenchmark::returnListRecordSixtyFourInt(const CppType& self, int32_t w_size) {
+    try {
+        auto r = self->returnListRecordSixtyFourInt(::djinni::I32::toCpp(w_size));
+        return ::djinni::List<::djinni_generated::NativeRecordSixtyFourInt>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::List<::djinni_generated::NativeRecordSixtyFourInt>>::handleNativeException(e);
+    }
+}
 em::val NativeDjinniPerfBenchmark::returnArrayRecord(const CppType& self, int32_t w_size) {
     try {
         auto r = self->returnArrayRecord(::djinni::I32::toCpp(w_size));
@@ -244,6 +395,24 @@ em::val NativeDjinniPerfBenchmark::returnArrayRecord(const CppType& self, int32_
         return ::djinni::ExceptionHandlingTraits<::djinni::List<::djinni_generated::NativeRecordSixInt>>::handleNativeException(e);
     }
 }
+em::val NativeDjinniPerfBenchmark::returnMapStringInt(const CppType& self, int32_t w_size) {
+    try {
+        auto r = self->returnMapStringInt(::djinni::I32::toCpp(w_size));
+        return ::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Map<::djinni::String, ::djinni::I64>>::handleNativeException(e);
+    }
+}
+em::val NativeDjinniPerfBenchmark::returnSetString(const CppType& self, int32_t w_size) {
+    try {
+        auto r = self->returnSetString(::djinni::I32::toCpp(w_size));
+        return ::djinni::Set<::djinni::String>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Set<::djinni::String>>::handleNativeException(e);
+    }
+}
 std::string NativeDjinniPerfBenchmark::roundTripString(const CppType& self, const std::string& w_s) {
     try {
         auto r = self->roundTripString(::djinni::String::toCpp(w_s));
@@ -266,22 +435,39 @@ EMSCRIPTEN_BINDINGS(snapchat_djinni_benchmark_djinni_perf_benchmark) {
         .function("argDataRef", NativeDjinniPerfBenchmark::argDataRef)
         .function("argDataView", NativeDjinniPerfBenchmark::argDataView)
         .function("argEnumSixValue", NativeDjinniPerfBenchmark::argEnumSixValue)
+        .function("argFlagsThirtyTwoValue", NativeDjinniPerfBenchmark::argFlagsThirtyTwoValue)
         .function("argRecordSixInt", NativeDjinniPerfBenchmark::argRecordSixInt)
         .function("argListInt", NativeDjinniPerfBenchmark::argListInt)
         .function("argArrayInt", NativeDjinniPerfBenchmark::argArrayInt)
         .function("argObject", NativeDjinniPerfBenchmark::argObject)
+        .function("argObjectUncached", NativeDjinniPerfBenchmark::argObjectUncached)
+        .function("callObjectFromThread", NativeDjinniPerfBenchmark::callObjectFromThread)
         .function("argListObject", NativeDjinniPerfBenchmark::argListObject)
         .function("argListRecord", NativeDjinniPerfBenchmark::argListRecord)
+        .function("argListRecordSixteenInt", NativeDjinniPerfBenchmark::argListRecordSixteenInt)
+        .function("argListRecordSixtyFourInt", NativeDjinniPerfBenchmark::argListRecordSixtyFourInt)
         .function("argArrayRecord", NativeDjinniPerfBenchmark::argArrayRecord)
+        .function("argMapStringInt", NativeDjinniPerfBenchmark::argMapStringInt)
+        .function("argSetString", NativeDjinniPerfBenchmark::argSetString)
         .function("returnInt", NativeDjinniPerfBenchmark::returnInt)
+        .function("returnEnumSixValue", NativeDjinniPerfBenchmark::returnEnumSixValue)
+        .function("returnFlagsThirtyTwoValue", NativeDjinniPerfBenchmark::returnFlagsThirtyTwoValue)
         .function("returnString", NativeDjinniPerfBenchmark::returnString)
+        .function("returnShortString", NativeDjinniPerfBenchmark::returnShortString)
+        .function("returnInternedString", NativeDjinniPerfBenchmark::returnInternedString)
         .function("returnBinary", NativeDjinniPerfBenchmark::returnBinary)
+        .function("returnBinaryBuffer", NativeDjinniPerfBenchmark::returnBinaryBuffer)
         .function("returnObject", NativeDjinniPerfBenchmark::returnObject)
+        .function("returnObjectUncached", NativeDjinniPerfBenchmark::returnObjectUncached)
         .function("returnListInt", NativeDjinniPerfBenchmark::returnListInt)
         .function("returnArrayInt", NativeDjinniPerfBenchmark::returnArrayInt)
         .function("returnListObject", NativeDjinniPerfBenchmark::returnListObject)
         .function("returnListRecord", NativeDjinniPerfBenchmark::returnListRecord)
+        .function("returnListRecordSixteenInt", NativeDjinniPerfBenchmark::returnListRecordSixteenInt)
+        .function("returnListRecordSixtyFourInt", NativeDjinniPerfBenchmark::returnListRecordSixtyFourInt)
         .function("returnArrayRecord", NativeDjinniPerfBenchmark::returnArrayRecord)
+        .function("returnMapStringInt", NativeDjinniPerfBenchmark::returnMapStringInt)
+        .function("returnSetString", NativeDjinniPerfBenchmark::returnSetString)
         .function("roundTripString", NativeDjinniPerfBenchmark::roundTripString)
         ;
 }
@@ -31,22 +31,39 @@ struct NativeDjinniPerfBenchmark : ::djinni::JsInterface<::snapchat::djinni::ben
     static void argDataRef(const CppType& self, const em::val& w_r);
     static void argDataView(const CppType& self, const em::val& w_d);
     static void argEnumSixValue(const CppType& self, int32_t w_e);
+    static void argFlagsThirtyTwoValue(const CppType& self, int32_t w_f);
     static void argRecordSixInt(const CppType& self, const em::val& w_r);
     static void argListInt(const CppType& self, const em::val& w_v);
     static void argArrayInt(const CppType& self, const em::val& w_v);
     static void argObject(const CppType& self, const em::val& w_c);
+    static void argObjectUncached(const CppType& self, const em::val& w_c);
+    static void callObjectFromThread(const CppType& self, const em::val& w_c,int32_t w_count);
     static void argListObject(const CppType& self, const em::val& w_l);
     static void argListRecord(const CppType& self, const em::val& w_l);
+    static void argListRecordSixteenInt(const CppType& self, const em::val& w_l);
+    static void argListRecordSixtyFourInt(const CppType& self, const em::val& w_l);
     static void argArrayRecord(const CppType& self, const em::val& w_a);
+    static void argMapStringInt(const CppType& self, const em::val& w_m);
+    static void argSetString(const CppType& self, const em::val& w_s);
     static int64_t returnInt(const CppType& self, int64_t w_i);
+    static int32_t returnEnumSixValue(const CppType& self);
+    static int32_t returnFlagsThirtyTwoValue(const CppType& self, int32_t w_count);
     static std::string returnString(const CppType& self, int32_t w_size);
+    static std::string returnShortString(const CppType& self, int32_t w_index);
+    static std::string returnInternedString(const CppType& self, int32_t w_index);
     static em::val returnBinary(const CppType& self, int32_t w_size);
+    static em::val returnBinaryBuffer(const CppType& self, int32_t w_size);
     static em::val returnObject(const CppType& self);
+    static em::val returnObjectUncached(const CppType& self);
     static em::val returnListInt(const CppType& self, int32_t w_size);
     static em::val returnArrayInt(const CppType& self, int32_t w_size);
     static em::val returnListObject(const CppType& self, int32_t w_size);
     static em::val returnListRecord(const CppType& self, int32_t w_size);
+    static em::val returnListRecordSixteenInt(const CppType& self, int32_t w_size);
+    static em::val returnListRecordSixtyFourInt(const CppType& self, int32_t w_size);
     static em::val returnArrayRecord(const CppType& self, int32_t w_size);
+    static em::val returnMapStringInt(const CppType& self, int32_t w_size);
+    static em::val returnSetString(const CppType& self, int32_t w_size);
     static std::string roundTripString(const CppType& self, const std::string& w_s);
 
 };
@@ -0,0 +1,59 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeFlagsThirtyTwoValue.hpp"  // my header
+#include <mutex>
+
+namespace djinni_generated {
+
+namespace {
+    EM_JS(void, djinni_init_snapchat_djinni_benchmark_FlagsThirtyTwoValue_consts, (), {
+        Module.benchmark_FlagsThirtyTwoValue =  {
+            FLAG1 : 1 << 0,
+            FLAG2 : 1 << 1,
+            FLAG3 : 1 << 2,
+            FLAG4 : 1 << 3,
+            FLAG5 : 1 << 4,
+            FLAG6 : 1 << 5,
+            FLAG7 : 1 << 6,
+            FLAG8 : 1 << 7,
+            FLAG9 : 1 << 8,
+            FLAG10 : 1 << 9,
+            FLAG11 : 1 << 10,
+            FLAG12 : 1 << 11,
+            FLAG13 : 1 << 12,
+            FLAG14 : 1 << 13,
+            FLAG15 : 1 << 14,
+            FLAG16 : 1 << 15,
+            FLAG17 : 1 << 16,
+            FLAG18 : 1 << 17,
+            FLAG19 : 1 << 18,
+            FLAG20 : 1 << 19,
+            FLAG21 : 1 << 20,
+            FLAG22 : 1 << 21,
+            FLAG23 : 1 << 22,
+            FLAG24 : 1 << 23,
+            FLAG25 : 1 << 24,
+            FLAG26 : 1 << 25,
+            FLAG27 : 1 << 26,
+            FLAG28 : 1 << 27,
+            FLAG29 : 1 << 28,
+            FLAG30 : 1 << 29,
+            FLAG31 : 1 << 30,
+            FLAG32 : 1 << 31,
+        }
+    })
+}
+
+void NativeFlagsThirtyTwoValue::staticInitializeConstants() {
+    static std::once_flag initOnce;
+    std::call_once(initOnce, [] {
+        djinni_init_snapchat_djinni_benchmark_FlagsThirtyTwoValue_consts();
+    });
+}
+
+EMSCRIPTEN_BINDINGS(snapchat_djinni_benchmark_FlagsThirtyTwoValue) {
+    NativeFlagsThirtyTwoValue::staticInitializeConstants();
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,15 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "FlagsThirtyTwoValue.hpp"
+#include "djinni_wasm.hpp"
+
+namespace djinni_generated {
+
+struct NativeFlagsThirtyTwoValue: ::djinni::WasmEnum<::snapchat::djinni::benchmark::FlagsThirtyTwoValue> {
+    static void staticInitializeConstants();
+};
+
+} // namespace djinni_generated
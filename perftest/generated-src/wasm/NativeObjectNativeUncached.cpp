@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeObjectNativeUncached.hpp"  // my header
+
+namespace djinni_generated {
+
+em::val NativeObjectNativeUncached::cppProxyMethods() {
+    static const em::val methods = em::val::array(std::vector<std::string> {
+        "baseline",
+    });
+    return methods;
+}
+
+void NativeObjectNativeUncached::baseline(const CppType& self) {
+    try {
+        self->baseline();
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<void>::handleNativeException(e);
+    }
+}
+
+EMSCRIPTEN_BINDINGS(snapchat_djinni_benchmark_ObjectNativeUncached) {
+    em::class_<::snapchat::djinni::benchmark::ObjectNativeUncached>("benchmark_ObjectNativeUncached")
+        .smart_ptr<std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>>("benchmark_ObjectNativeUncached")
+        .function("nativeDestroy", &NativeObjectNativeUncached::nativeDestroy)
+        .function("baseline", NativeObjectNativeUncached::baseline)
+        ;
+}
+
+} // namespace djinni_generated
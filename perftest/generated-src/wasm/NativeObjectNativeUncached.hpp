@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "ObjectNativeUncached.hpp"
+#include "djinni_wasm.hpp"
+
+namespace djinni_generated {
+
+struct NativeObjectNativeUncached : ::djinni::JsInterface<::snapchat::djinni::benchmark::ObjectNativeUncached, NativeObjectNativeUncached> {
+    using CppType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>;
+    using CppOptType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectNativeUncached>;
+    using JsType = em::val;
+    using Boxed = NativeObjectNativeUncached;
+    static constexpr bool kUsesProxyCache = false;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeObjectNativeUncached::fromCpp");
+        return fromCppOpt(c);
+    }
+
+    static em::val cppProxyMethods();
+
+    static void baseline(const CppType& self);
+
+};
+
+} // namespace djinni_generated
@@ -0,0 +1,21 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeObjectPlatformUncached.hpp"  // my header
+
+namespace djinni_generated {
+
+
+void NativeObjectPlatformUncached::JsProxy::onDone() {
+    auto ret = callMethod("onDone");
+    checkError(ret);
+}
+
+EMSCRIPTEN_BINDINGS(snapchat_djinni_benchmark_ObjectPlatformUncached) {
+    em::class_<::snapchat::djinni::benchmark::ObjectPlatformUncached>("benchmark_ObjectPlatformUncached")
+        .smart_ptr<std::shared_ptr<::snapchat::djinni::benchmark::ObjectPlatformUncached>>("benchmark_ObjectPlatformUncached")
+        .function("nativeDestroy", &NativeObjectPlatformUncached::nativeDestroy)
+        ;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "ObjectPlatformUncached.hpp"
+#include "djinni_wasm.hpp"
+
+namespace djinni_generated {
+
+struct NativeObjectPlatformUncached : ::djinni::JsInterface<::snapchat::djinni::benchmark::ObjectPlatformUncached, NativeObjectPlatformUncached> {
+    using CppType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectPlatformUncached>;
+    using CppOptType = std::shared_ptr<::snapchat::djinni::benchmark::ObjectPlatformUncached>;
+    using JsType = em::val;
+    using Boxed = NativeObjectPlatformUncached;
+    static constexpr bool kUsesProxyCache = false;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeObjectPlatformUncached::fromCpp");
+        return fromCppOpt(c);
+    }
+
+
+    struct JsProxy: ::djinni::JsProxyBase, ::snapchat::djinni::benchmark::ObjectPlatformUncached, ::djinni::InstanceTracker<JsProxy> {
+        JsProxy(const em::val& v) : JsProxyBase(v, false) {}
+        void onDone() override;
+    };
+};
+
+} // namespace djinni_generated
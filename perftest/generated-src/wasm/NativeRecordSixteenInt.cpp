@@ -0,0 +1,47 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeRecordSixteenInt.hpp"  // my header
+
+namespace djinni_generated {
+
+auto NativeRecordSixteenInt::toCpp(const JsType& j) -> CppType {
+    return {::djinni::I64::Boxed::toCpp(j["i1"]),
+            ::djinni::I64::Boxed::toCpp(j["i2"]),
+            ::djinni::I64::Boxed::toCpp(j["i3"]),
+            ::djinni::I64::Boxed::toCpp(j["i4"]),
+            ::djinni::I64::Boxed::toCpp(j["i5"]),
+            ::djinni::I64::Boxed::toCpp(j["i6"]),
+            ::djinni::I64::Boxed::toCpp(j["i7"]),
+            ::djinni::I64::Boxed::toCpp(j["i8"]),
+            ::djinni::I64::Boxed::toCpp(j["i9"]),
+            ::djinni::I64::Boxed::toCpp(j["i10"]),
+            ::djinni::I64::Boxed::toCpp(j["i11"]),
+            ::djinni::I64::Boxed::toCpp(j["i12"]),
+            ::djinni::I64::Boxed::toCpp(j["i13"]),
+            ::djinni::I64::Boxed::toCpp(j["i14"]),
+            ::djinni::I64::Boxed::toCpp(j["i15"]),
+            ::djinni::I64::Boxed::toCpp(j["i16"])};
+}
+auto NativeRecordSixteenInt::fromCpp(const CppType& c) -> JsType {
+    em::val js = em::val::object();
+    js.set("i1", ::djinni::I64::Boxed::fromCpp(c.i1));
+    js.set("i2", ::djinni::I64::Boxed::fromCpp(c.i2));
+    js.set("i3", ::djinni::I64::Boxed::fromCpp(c.i3));
+    js.set("i4", ::djinni::I64::Boxed::fromCpp(c.i4));
+    js.set("i5", ::djinni::I64::Boxed::fromCpp(c.i5));
+    js.set("i6", ::djinni::I64::Boxed::fromCpp(c.i6));
+    js.set("i7", ::djinni::I64::Boxed::fromCpp(c.i7));
+    js.set("i8", ::djinni::I64::Boxed::fromCpp(c.i8));
+    js.set("i9", ::djinni::I64::Boxed::fromCpp(c.i9));
+    js.set("i10", ::djinni::I64::Boxed::fromCpp(c.i10));
+    js.set("i11", ::djinni::I64::Boxed::fromCpp(c.i11));
+    js.set("i12", ::djinni::I64::Boxed::fromCpp(c.i12));
+    js.set("i13", ::djinni::I64::Boxed::fromCpp(c.i13));
+    js.set("i14", ::djinni::I64::Boxed::fromCpp(c.i14));
+    js.set("i15", ::djinni::I64::Boxed::fromCpp(c.i15));
+    js.set("i16", ::djinni::I64::Boxed::fromCpp(c.i16));
+    return js;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,21 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "RecordSixteenInt.hpp"
+#include "djinni_wasm.hpp"
+
+namespace djinni_generated {
+
+struct NativeRecordSixteenInt
+{
+    using CppType = ::snapchat::djinni::benchmark::RecordSixteenInt;
+    using JsType = em::val;
+    using Boxed = NativeRecordSixteenInt;
+
+    static CppType toCpp(const JsType& j);
+    static JsType fromCpp(const CppType& c);
+};
+
+} // namespace djinni_generated
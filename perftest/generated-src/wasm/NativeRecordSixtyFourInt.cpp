@@ -0,0 +1,143 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#include "NativeRecordSixtyFourInt.hpp"  // my header
+
+namespace djinni_generated {
+
+auto NativeRecordSixtyFourInt::toCpp(const JsType& j) -> CppType {
+    return {::djinni::I64::Boxed::toCpp(j["i1"]),
+            ::djinni::I64::Boxed::toCpp(j["i2"]),
+            ::djinni::I64::Boxed::toCpp(j["i3"]),
+            ::djinni::I64::Boxed::toCpp(j["i4"]),
+            ::djinni::I64::Boxed::toCpp(j["i5"]),
+            ::djinni::I64::Boxed::toCpp(j["i6"]),
+            ::djinni::I64::Boxed::toCpp(j["i7"]),
+            ::djinni::I64::Boxed::toCpp(j["i8"]),
+            ::djinni::I64::Boxed::toCpp(j["i9"]),
+            ::djinni::I64::Boxed::toCpp(j["i10"]),
+            ::djinni::I64::Boxed::toCpp(j["i11"]),
+            ::djinni::I64::Boxed::toCpp(j["i12"]),
+            ::djinni::I64::Boxed::toCpp(j["i13"]),
+            ::djinni::I64::Boxed::toCpp(j["i14"]),
+            ::djinni::I64::Boxed::toCpp(j["i15"]),
+            ::djinni::I64::Boxed::toCpp(j["i16"]),
+            ::djinni::I64::Boxed::toCpp(j["i17"]),
+            ::djinni::I64::Boxed::toCpp(j["i18"]),
+            ::djinni::I64::Boxed::toCpp(j["i19"]),
+            ::djinni::I64::Boxed::toCpp(j["i20"]),
+            ::djinni::I64::Boxed::toCpp(j["i21"]),
+            ::djinni::I64::Boxed::toCpp(j["i22"]),
+            ::djinni::I64::Boxed::toCpp(j["i23"]),
+            ::djinni::I64::Boxed::toCpp(j["i24"]),
+            ::djinni::I64::Boxed::toCpp(j["i25"]),
+            ::djinni::I64::Boxed::toCpp(j["i26"]),
+            ::djinni::I64::Boxed::toCpp(j["i27"]),
+            ::djinni::I64::Boxed::toCpp(j["i28"]),
+            ::djinni::I64::Boxed::toCpp(j["i29"]),
+            ::djinni::I64::Boxed::toCpp(j["i30"]),
+            ::djinni::I64::Boxed::toCpp(j["i31"]),
+            ::djinni::I64::Boxed::toCpp(j["i32"]),
+            ::djinni::I64::Boxed::toCpp(j["i33"]),
+            ::djinni::I64::Boxed::toCpp(j["i34"]),
+            ::djinni::I64::Boxed::toCpp(j["i35"]),
+            ::djinni::I64::Boxed::toCpp(j["i36"]),
+            ::djinni::I64::Boxed::toCpp(j["i37"]),
+            ::djinni::I64::Boxed::toCpp(j["i38"]),
+            ::djinni::I64::Boxed::toCpp(j["i39"]),
+            ::djinni::I64::Boxed::toCpp(j["i40"]),
+            ::djinni::I64::Boxed::toCpp(j["i41"]),
+            ::djinni::I64::Boxed::toCpp(j["i42"]),
+            ::djinni::I64::Boxed::toCpp(j["i43"]),
+            ::djinni::I64::Boxed::toCpp(j["i44"]),
+            ::djinni::I64::Boxed::toCpp(j["i45"]),
+            ::djinni::I64::Boxed::toCpp(j["i46"]),
+            ::djinni::I64::Boxed::toCpp(j["i47"]),
+            ::djinni::I64::Boxed::toCpp(j["i48"]),
+            ::djinni::I64::Boxed::toCpp(j["i49"]),
+            ::djinni::I64::Boxed::toCpp(j["i50"]),
+            ::djinni::I64::Boxed::toCpp(j["i51"]),
+            ::djinni::I64::Boxed::toCpp(j["i52"]),
+            ::djinni::I64::Boxed::toCpp(j["i53"]),
+            ::djinni::I64::Boxed::toCpp(j["i54"]),
+            ::djinni::I64::Boxed::toCpp(j["i55"]),
+            ::djinni::I64::Boxed::toCpp(j["i56"]),
+            ::djinni::I64::Boxed::toCpp(j["i57"]),
+            ::djinni::I64::Boxed::toCpp(j["i58"]),
+            ::djinni::I64::Boxed::toCpp(j["i59"]),
+            ::djinni::I64::Boxed::toCpp(j["i60"]),
+            ::djinni::I64::Boxed::toCpp(j["i61"]),
+            ::djinni::I64::Boxed::toCpp(j["i62"]),
+            ::djinni::I64::Boxed::toCpp(j["i63"]),
+            ::djinni::I64::Boxed::toCpp(j["i64"])};
+}
+auto NativeRecordSixtyFourInt::fromCpp(const CppType& c) -> JsType {
+    em::val js = em::val::object();
+    js.set("i1", ::djinni::I64::Boxed::fromCpp(c.i1));
+    js.set("i2", ::djinni::I64::Boxed::fromCpp(c.i2));
+    js.set("i3", ::djinni::I64::Boxed::fromCpp(c.i3));
+    js.set("i4", ::djinni::I64::Boxed::fromCpp(c.i4));
+    js.set("i5", ::djinni::I64::Boxed::fromCpp(c.i5));
+    js.set("i6", ::djinni::I64::Boxed::fromCpp(c.i6));
+    js.set("i7", ::djinni::I64::Boxed::fromCpp(c.i7));
+    js.set("i8", ::djinni::I64::Boxed::fromCpp(c.i8));
+    js.set("i9", ::djinni::I64::Boxed::fromCpp(c.i9));
+    js.set("i10", ::djinni::I64::Boxed::fromCpp(c.i10));
+    js.set("i11", ::djinni::I64::Boxed::fromCpp(c.i11));
+    js.set("i12", ::djinni::I64::Boxed::fromCpp(c.i12));
+    js.set("i13", ::djinni::I64::Boxed::fromCpp(c.i13));
+    js.set("i14", ::djinni::I64::Boxed::fromCpp(c.i14));
+    js.set("i15", ::djinni::I64::Boxed::fromCpp(c.i15));
+    js.set("i16", ::djinni::I64::Boxed::fromCpp(c.i16));
+    js.set("i17", ::djinni::I64::Boxed::fromCpp(c.i17));
+    js.set("i18", ::djinni::I64::Boxed::fromCpp(c.i18));
+    js.set("i19", ::djinni::I64::Boxed::fromCpp(c.i19));
+    js.set("i20", ::djinni::I64::Boxed::fromCpp(c.i20));
+    js.set("i21", ::djinni::I64::Boxed::fromCpp(c.i21));
+    js.set("i22", ::djinni::I64::Boxed::fromCpp(c.i22));
+    js.set("i23", ::djinni::I64::Boxed::fromCpp(c.i23));
+    js.set("i24", ::djinni::I64::Boxed::fromCpp(c.i24));
+    js.set("i25", ::djinni::I64::Boxed::fromCpp(c.i25));
+    js.set("i26", ::djinni::I64::Boxed::fromCpp(c.i26));
+    js.set("i27", ::djinni::I64::Boxed::fromCpp(c.i27));
+    js.set("i28", ::djinni::I64::Boxed::fromCpp(c.i28));
+    js.set("i29", ::djinni::I64::Boxed::fromCpp(c.i29));
+    js.set("i30", ::djinni::I64::Boxed::fromCpp(c.i30));
+    js.set("i31", ::djinni::I64::Boxed::fromCpp(c.i31));
+    js.set("i32", ::djinni::I64::Boxed::fromCpp(c.i32));
+    js.set("i33", ::djinni::I64::Boxed::fromCpp(c.i33));
+    js.set("i34", ::djinni::I64::Boxed::fromCpp(c.i34));
+    js.set("i35", ::djinni::I64::Boxed::fromCpp(c.i35));
+    js.set("i36", ::djinni::I64::Boxed::fromCpp(c.i36));
+    js.set("i37", ::djinni::I64::Boxed::fromCpp(c.i37));
+    js.set("i38", ::djinni::I64::Boxed::fromCpp(c.i38));
+    js.set("i39", ::djinni::I64::Boxed::fromCpp(c.i39));
+    js.set("i40", ::djinni::I64::Boxed::fromCpp(c.i40));
+    js.set("i41", ::djinni::I64::Boxed::fromCpp(c.i41));
+    js.set("i42", ::djinni::I64::Boxed::fromCpp(c.i42));
+    js.set("i43", ::djinni::I64::Boxed::fromCpp(c.i43));
+    js.set("i44", ::djinni::I64::Boxed::fromCpp(c.i44));
+    js.set("i45", ::djinni::I64::Boxed::fromCpp(c.i45));
+    js.set("i46", ::djinni::I64::Boxed::fromCpp(c.i46));
+    js.set("i47", ::djinni::I64::Boxed::fromCpp(c.i47));
+    js.set("i48", ::djinni::I64::Boxed::fromCpp(c.i48));
+    js.set("i49", ::djinni::I64::Boxed::fromCpp(c.i49));
+    js.set("i50", ::djinni::I64::Boxed::fromCpp(c.i50));
+    js.set("i51", ::djinni::I64::Boxed::fromCpp(c.i51));
+    js.set("i52", ::djinni::I64::Boxed::fromCpp(c.i52));
+    js.set("i53", ::djinni::I64::Boxed::fromCpp(c.i53));
+    js.set("i54", ::djinni::I64::Boxed::fromCpp(c.i54));
+    js.set("i55", ::djinni::I64::Boxed::fromCpp(c.i55));
+    js.set("i56", ::djinni::I64::Boxed::fromCpp(c.i56));
+    js.set("i57", ::djinni::I64::Boxed::fromCpp(c.i57));
+    js.set("i58", ::djinni::I64::Boxed::fromCpp(c.i58));
+    js.set("i59", ::djinni::I64::Boxed::fromCpp(c.i59));
+    js.set("i60", ::djinni::I64::Boxed::fromCpp(c.i60));
+    js.set("i61", ::djinni::I64::Boxed::fromCpp(c.i61));
+    js.set("i62", ::djinni::I64::Boxed::fromCpp(c.i62));
+    js.set("i63", ::djinni::I64::Boxed::fromCpp(c.i63));
+    js.set("i64", ::djinni::I64::Boxed::fromCpp(c.i64));
+    return js;
+}
+
+} // namespace djinni_generated
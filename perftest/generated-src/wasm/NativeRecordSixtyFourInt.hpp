@@ -0,0 +1,21 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from djinni_perf_benchmark.djinni
+
+#pragma once
+
+#include "RecordSixtyFourInt.hpp"
+#include "djinni_wasm.hpp"
+
+namespace djinni_generated {
+
+struct NativeRecordSixtyFourInt
+{
+    using CppType = ::snapchat::djinni::benchmark::RecordSixtyFourInt;
+    using JsType = em::val;
+    using Boxed = NativeRecordSixtyFourInt;
+
+    static CppType toCpp(const JsType& j);
+    static JsType fromCpp(const CppType& c);
+};
+
+} // namespace djinni_generated
@@ -2,11 +2,46 @@
 #include "ObjectNativeImpl.hpp"
 
 #include <chrono>
+#include <exception>
 #include <string>
 #include <thread>
+#include <utility>
 
 namespace snapchat::djinni::benchmark {
 
+namespace {
+
+// Builds a record of N i64 fields holding 1, 2, ... N.
+template <typename Record, size_t... I>
+Record makeCountingRecord(std::index_sequence<I...>) {
+    return Record{static_cast<int64_t>(I + 1)...};
+}
+
+template <typename Record, size_t N>
+const std::vector<Record>& cachedRecords(int32_t size) {
+    static int32_t cachedReturnValueSize;
+    static std::vector<Record> cachedReturnValue;
+    if (size != cachedReturnValueSize) {
+        cachedReturnValue.assign(size, makeCountingRecord<Record>(std::make_index_sequence<N>()));
+        cachedReturnValueSize = size;
+    }
+    return cachedReturnValue;
+}
+
+// 32 distinct status-code-like strings, for the string interning benchmarks.
+const std::string& shortString(int32_t index) {
+    static const std::vector<std::string> strings = [] {
+        std::vector<std::string> s;
+        for (int i = 0; i < 32; ++i) {
+            s.push_back("STATUS_" + std::to_string(i));
+        }
+        return s;
+    }();
+    return strings[static_cast<uint32_t>(index) % strings.size()];
+}
+
+} // namespace
+
 std::shared_ptr<DjinniPerfBenchmark> DjinniPerfBenchmark::getInstance() {
     return std::make_shared<DjinniPerfBenchmarkImpl>();
 }
@@ -34,6 +69,8 @@ void DjinniPerfBenchmarkImpl::argDataView(const ::djinni::DataView& /* d */) {}
 
 void DjinniPerfBenchmarkImpl::argEnumSixValue(EnumSixValue /* e */) {}
 
+void DjinniPerfBenchmarkImpl::argFlagsThirtyTwoValue(FlagsThirtyTwoValue /* f */) {}
+
 void DjinniPerfBenchmarkImpl::argRecordSixInt(const RecordSixInt& /* r */) {}
 
 void DjinniPerfBenchmarkImpl::argListInt(const std::vector<int64_t>& /* v */) {}
@@ -42,16 +79,54 @@ void DjinniPerfBenchmarkImpl::argArrayInt(const std::vector<int64_t>& /* v */) {
 
 void DjinniPerfBenchmarkImpl::argObject(const std::shared_ptr<ObjectPlatform>& /* c */) {}
 
+void DjinniPerfBenchmarkImpl::argObjectUncached(const std::shared_ptr<ObjectPlatformUncached>& /* c */) {}
+
+// Calls back into the platform `count` times from a fresh C++ thread, which has to be attached
+// to the VM on the first call and is detached again when it exits.
+void DjinniPerfBenchmarkImpl::callObjectFromThread(const std::shared_ptr<ObjectPlatform>& c, int32_t count) {
+    std::exception_ptr error;
+    std::thread([&] {
+        try {
+            for (int32_t i = 0; i < count; ++i) {
+                c->onDone();
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }).join();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 void DjinniPerfBenchmarkImpl::argListObject(const std::vector<std::shared_ptr<ObjectPlatform>>& /* l */) {}
 
 void DjinniPerfBenchmarkImpl::argListRecord(const std::vector<RecordSixInt>& /* l */) {}
 
+void DjinniPerfBenchmarkImpl::argListRecordSixteenInt(const std::vector<RecordSixteenInt>& /* l */) {}
+
+void DjinniPerfBenchmarkImpl::argListRecordSixtyFourInt(const std::vector<RecordSixtyFourInt>& /* l */) {}
+
 void DjinniPerfBenchmarkImpl::argArrayRecord(const std::vector<RecordSixInt>& /* a */) {}
 
+void DjinniPerfBenchmarkImpl::argMapStringInt(const std::unordered_map<std::string, int64_t>& /* m */) {}
+
+void DjinniPerfBenchmarkImpl::argSetString(const std::unordered_set<std::string>& /* s */) {}
+
 int64_t DjinniPerfBenchmarkImpl::returnInt(int64_t value) {
     return value;
 }
 
+EnumSixValue DjinniPerfBenchmarkImpl::returnEnumSixValue() {
+    return EnumSixValue::SIXTH;
+}
+
+// Returns a set holding the first `count` flags.
+FlagsThirtyTwoValue DjinniPerfBenchmarkImpl::returnFlagsThirtyTwoValue(int32_t count) {
+    const uint32_t bits = count >= 32 ? ~0u : (1u << count) - 1;
+    return static_cast<FlagsThirtyTwoValue>(static_cast<int32_t>(bits));
+}
+
 // Each test is run 1000 times. We cache return values,
 // so that the construction cost is only paid by the first run.
 
@@ -65,6 +140,14 @@ std::string DjinniPerfBenchmarkImpl::returnString(int32_t size) {
     return cachedReturnValue;
 }
 
+std::string DjinniPerfBenchmarkImpl::returnShortString(int32_t index) {
+    return shortString(index);
+}
+
+std::string DjinniPerfBenchmarkImpl::returnInternedString(int32_t index) {
+    return shortString(index);
+}
+
 std::vector<uint8_t> DjinniPerfBenchmarkImpl::returnBinary(int32_t size) {
     static int32_t cachedReturnValueSize;
     static std::vector<uint8_t> cachedReturnValue;
@@ -78,11 +161,20 @@ std::vector<uint8_t> DjinniPerfBenchmarkImpl::returnBinary(int32_t size) {
     return cachedReturnValue;
 }
 
+std::vector<uint8_t> DjinniPerfBenchmarkImpl::returnBinaryBuffer(int32_t size) {
+    return returnBinary(size);
+}
+
 std::shared_ptr<ObjectNative> DjinniPerfBenchmarkImpl::returnObject() {
     static auto cachedReturnValue = std::make_shared<ObjectNativeImpl>();
     return cachedReturnValue;
 }
 
+std::shared_ptr<ObjectNativeUncached> DjinniPerfBenchmarkImpl::returnObjectUncached() {
+    static auto cachedReturnValue = std::make_shared<ObjectNativeUncachedImpl>();
+    return cachedReturnValue;
+}
+
 std::vector<int64_t> DjinniPerfBenchmarkImpl::returnListInt(int32_t size) {
     static int32_t cachedReturnValueSize;
     static std::vector<int64_t> cachedReturnValue;
@@ -128,10 +220,46 @@ std::vector<RecordSixInt> DjinniPerfBenchmarkImpl::returnListRecord(int32_t size
     return cachedReturnValue;
 }
 
+std::vector<RecordSixteenInt> DjinniPerfBenchmarkImpl::returnListRecordSixteenInt(int32_t size) {
+    return cachedRecords<RecordSixteenInt, 16>(size);
+}
+
+std::vector<RecordSixtyFourInt> DjinniPerfBenchmarkImpl::returnListRecordSixtyFourInt(int32_t size) {
+    return cachedRecords<RecordSixtyFourInt, 64>(size);
+}
+
 std::vector<RecordSixInt> DjinniPerfBenchmarkImpl::returnArrayRecord(int32_t size) {
     return returnListRecord(size);
 }
 
+// Returns a map from "key0", "key1", ... to 0, 1, ...
+std::unordered_map<std::string, int64_t> DjinniPerfBenchmarkImpl::returnMapStringInt(int32_t size) {
+    static int32_t cachedReturnValueSize;
+    static std::unordered_map<std::string, int64_t> cachedReturnValue;
+    if (size != cachedReturnValueSize) {
+        cachedReturnValue.clear();
+        for (int32_t i = 0; i < size; i++) {
+            cachedReturnValue.emplace("key" + std::to_string(i), i);
+        }
+        cachedReturnValueSize = size;
+    }
+    return cachedReturnValue;
+}
+
+// Returns a set of "key0", "key1", ...
+std::unordered_set<std::string> DjinniPerfBenchmarkImpl::returnSetString(int32_t size) {
+    static int32_t cachedReturnValueSize;
+    static std::unordered_set<std::string> cachedReturnValue;
+    if (size != cachedReturnValueSize) {
+        cachedReturnValue.clear();
+        for (int32_t i = 0; i < size; i++) {
+            cachedReturnValue.insert("key" + std::to_string(i));
+        }
+        cachedReturnValueSize = size;
+    }
+    return cachedReturnValue;
+}
+
 std::string DjinniPerfBenchmarkImpl::roundTripString(const std::string& s) {
     return s;
 }
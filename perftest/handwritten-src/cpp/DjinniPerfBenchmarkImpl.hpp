@@ -1,9 +1,14 @@
 #pragma once
 
 #include "EnumSixValue.hpp"
+#include "FlagsThirtyTwoValue.hpp"
 #include "ObjectNative.hpp"
+#include "ObjectNativeUncached.hpp"
 #include "ObjectPlatform.hpp"
+#include "ObjectPlatformUncached.hpp"
 #include "RecordSixInt.hpp"
+#include "RecordSixteenInt.hpp"
+#include "RecordSixtyFourInt.hpp"
 #include "djinni_perf_benchmark.hpp"
 #include <string>
 
@@ -30,22 +35,39 @@ public:
     void argDataRef(const ::djinni::DataRef& r) override;
     void argDataView(const ::djinni::DataView& d) override;
     void argEnumSixValue(EnumSixValue e) override;
+    void argFlagsThirtyTwoValue(FlagsThirtyTwoValue f) override;
     void argRecordSixInt(const RecordSixInt& r) override;
     void argListInt(const std::vector<int64_t>& v) override;
     void argArrayInt(const std::vector<int64_t>& v) override;
     void argObject(const std::shared_ptr<ObjectPlatform>& c) override;
+    void argObjectUncached(const std::shared_ptr<ObjectPlatformUncached>& c) override;
+    void callObjectFromThread(const std::shared_ptr<ObjectPlatform>& c, int32_t count) override;
     void argListObject(const std::vector<std::shared_ptr<ObjectPlatform>>& l) override;
     void argListRecord(const std::vector<RecordSixInt>& l) override;
+    void argListRecordSixteenInt(const std::vector<RecordSixteenInt>& l) override;
+    void argListRecordSixtyFourInt(const std::vector<RecordSixtyFourInt>& l) override;
     void argArrayRecord(const std::vector<RecordSixInt>& a) override;
+    void argMapStringInt(const std::unordered_map<std::string, int64_t>& m) override;
+    void argSetString(const std::unordered_set<std::string>& s) override;
     int64_t returnInt(int64_t value) override;
+    EnumSixValue returnEnumSixValue() override;
+    FlagsThirtyTwoValue returnFlagsThirtyTwoValue(int32_t count) override;
     std::string returnString(int32_t size) override;
+    std::string returnShortString(int32_t index) override;
+    std::string returnInternedString(int32_t index) override;
     std::vector<uint8_t> returnBinary(int32_t size) override;
+    std::vector<uint8_t> returnBinaryBuffer(int32_t size) override;
     std::shared_ptr<ObjectNative> returnObject() override;
+    std::shared_ptr<ObjectNativeUncached> returnObjectUncached() override;
     std::vector<int64_t> returnListInt(int32_t size) override;
     std::vector<int64_t> returnArrayInt(int32_t size) override;
     std::vector<std::shared_ptr<ObjectNative>> returnListObject(int32_t size) override;
     std::vector<RecordSixInt> returnListRecord(int32_t size) override;
+    std::vector<RecordSixteenInt> returnListRecordSixteenInt(int32_t size) override;
+    std::vector<RecordSixtyFourInt> returnListRecordSixtyFourInt(int32_t size) override;
     std::vector<RecordSixInt> returnArrayRecord(int32_t size) override;
+    std::unordered_map<std::string, int64_t> returnMapStringInt(int32_t size) override;
+    std::unordered_set<std::string> returnSetString(int32_t size) override;
     std::string roundTripString(const std::string& s) override;
 };
 
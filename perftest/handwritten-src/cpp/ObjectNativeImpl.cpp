@@ -4,4 +4,6 @@ namespace snapchat::djinni::benchmark {
 
 void ObjectNativeImpl::baseline() {}
 
+void ObjectNativeUncachedImpl::baseline() {}
+
 } // namespace snap::djinni_perf_benchmark
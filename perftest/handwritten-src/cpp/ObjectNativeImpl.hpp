@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ObjectNative.hpp"
+#include "ObjectNativeUncached.hpp"
 
 namespace snapchat::djinni::benchmark {
 
@@ -9,4 +10,9 @@ public:
     void baseline() override;
 };
 
+class ObjectNativeUncachedImpl : public ObjectNativeUncached {
+public:
+    void baseline() override;
+};
+
 } // namespace snap::djinni_perf_benchmark
@@ -0,0 +1,122 @@
+// Checks how many heap allocations a djinni::Future continuation costs, by
+// counting calls to a replaced operator new. A then() handler whose lambda
+// captures up to 48 bytes (40 with an executor) is stored inline, so a hop may
+// allocate once, for the next shared state. Built with
+// DJINNI_FUTURE_SHARED_STATE_POOL_SIZE, warmed-up short chains must not
+// allocate at all. Bigger handlers cost one more allocation, and every block
+// must be freed again once the chain is done.
+
+#include "CountingAllocator.hpp"
+#include "Future.hpp"
+#include "TestCheck.hpp"
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+using test_check::check;
+
+constexpr size_t kHops = 16;
+constexpr double kMaxAllocationsPerHop = DJINNI_FUTURE_SHARED_STATE_POOL_SIZE > 0 ? 0 : 1;
+// The largest captures that still fit in ValueHandlerBase::kInlineSize, next
+// to the next promise (and the executor reference).
+constexpr size_t kMaxInlineCapture = 48;
+constexpr size_t kMaxInlineCaptureWithExecutor = 40;
+
+template <size_t CaptureSize>
+struct Capture {
+    std::array<char, CaptureSize> bytes{};
+};
+template <>
+struct Capture<0> {};
+
+template <size_t CaptureSize>
+auto makeHandler() {
+    return [capture = Capture<CaptureSize>()] (djinni::Future<int> f) {
+        (void)capture;
+        return f.get() + 1;
+    };
+}
+
+// Attaches every continuation before the chain's promise is set.
+template <size_t CaptureSize>
+void thenBeforeSet() {
+    djinni::Promise<int> promise;
+    auto future = promise.getFuture();
+    for (size_t i = 0; i < kHops; ++i) {
+        future = future.then(makeHandler<CaptureSize>());
+    }
+    promise.setValue(0);
+    if (future.get() != static_cast<int>(kHops)) {
+        std::abort();
+    }
+}
+
+// Attaches every continuation to a future that is already ready.
+template <size_t CaptureSize>
+void thenOnReady() {
+    auto future = djinni::Promise<int>::resolve(0);
+    for (size_t i = 0; i < kHops; ++i) {
+        future = future.then(makeHandler<CaptureSize>());
+    }
+    if (future.get() != static_cast<int>(kHops)) {
+        std::abort();
+    }
+}
+
+// Same as thenBeforeSet(), through then(executor, handler).
+template <size_t CaptureSize>
+void thenOnExecutor() {
+    djinni::Promise<int> promise;
+    auto future = promise.getFuture();
+    for (size_t i = 0; i < kHops; ++i) {
+        future = future.then(djinni::inlineExecutor(), makeHandler<CaptureSize>());
+    }
+    promise.setValue(0);
+    if (future.get() != static_cast<int>(kHops)) {
+        std::abort();
+    }
+}
+
+template <typename Chain>
+void checkChain(const char* name, size_t captureSize, bool inlineHandler, Chain&& chain) {
+    // The first round fills the shared state pool, if there is one.
+    chain();
+    auto before = counting_allocator::allocations.load(std::memory_order_relaxed);
+    auto liveBefore = counting_allocator::liveBlocks.load(std::memory_order_relaxed);
+    // The chain's own promise and future account for one more shared state.
+    chain();
+    auto allocations = counting_allocator::allocations.load(std::memory_order_relaxed) - before;
+    // A handler on the heap must be freed when the shared state destroys it.
+    bool leaked = counting_allocator::liveBlocks.load(std::memory_order_relaxed) != liveBefore;
+    double perHop = static_cast<double>(allocations) / (kHops + 1);
+    double maxPerHop = kMaxAllocationsPerHop + (inlineHandler ? 0 : 1);
+    char what[128];
+    std::snprintf(what, sizeof(what), "%-18s capture %2zu bytes: %.2f allocations per hop, handler %s%s",
+                  name, captureSize, perHop, inlineHandler ? "inline" : "on the heap",
+                  leaked ? ", leaked" : "");
+    check(perHop <= maxPerHop && !leaked, what);
+}
+
+template <size_t CaptureSize>
+void checkCaptureSize() {
+    checkChain("then before set", CaptureSize, CaptureSize <= kMaxInlineCapture, thenBeforeSet<CaptureSize>);
+    // A handler attached to a ready future runs right away and is never stored.
+    checkChain("then on ready", CaptureSize, true, thenOnReady<CaptureSize>);
+    checkChain("then on executor", CaptureSize, CaptureSize <= kMaxInlineCaptureWithExecutor, thenOnExecutor<CaptureSize>);
+}
+
+} // namespace
+
+int main() {
+    checkCaptureSize<0>();
+    checkCaptureSize<8>();
+    checkCaptureSize<32>();
+    checkCaptureSize<40>();
+    checkCaptureSize<48>();
+    // Bigger than kInlineSize by itself, so the handler always goes to the heap.
+    checkCaptureSize<djinni::detail::ValueHandlerBase<int>::kInlineSize + 8>();
+    return test_check::exitCode();
+}
@@ -0,0 +1,275 @@
+// Micro benchmarks for djinni::Future and djinni::Promise. They run in plain
+// C++, without any language boundary, and report the time and the number of
+// heap allocations per continuation ("hop").
+
+#include "CountingAllocator.hpp"
+#include "Future.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Sample {
+    double nanoseconds;
+    size_t allocations;
+};
+
+void report(const char* name, size_t hops, std::vector<Sample>& samples) {
+    std::sort(samples.begin(), samples.end(), [] (const Sample& a, const Sample& b) {
+        return a.nanoseconds < b.nanoseconds;
+    });
+    std::printf("%-28s, %8.1f, %8.1f, %6.2f\n", name,
+                samples.front().nanoseconds / hops,
+                samples[samples.size() / 2].nanoseconds / hops,
+                static_cast<double>(samples.back().allocations) / hops);
+}
+
+// Runs `body` `reps` times and prints the fastest and median time per hop, and
+// the allocations per hop of the last run. `body` returns the allocation count
+// of its measured section.
+template <typename Body>
+void measure(const char* name, size_t hops, size_t reps, Body&& body) {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < reps; ++i) {
+        auto start = Clock::now();
+        size_t allocations = body();
+        auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+        samples.push_back({elapsed.count(), allocations});
+    }
+    report(name, hops, samples);
+}
+
+// Same as above, but only times `body`: `setup` prepares its input, outside of
+// the measured section.
+template <typename Setup, typename Body>
+void measure(const char* name, size_t hops, size_t reps, Setup&& setup, Body&& body) {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < reps; ++i) {
+        auto input = setup();
+        auto start = Clock::now();
+        size_t allocations = body(input);
+        auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+        samples.push_back({elapsed.count(), allocations});
+    }
+    report(name, hops, samples);
+}
+
+size_t allocationsSince(size_t start) {
+    return counting_allocator::allocations.load(std::memory_order_relaxed) - start;
+}
+
+// then() on a pending future, `hops` times, then one setValue() that runs the
+// whole chain inline on the same thread.
+size_t chainThenBeforeSet(size_t hops) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    djinni::Promise<int> promise;
+    auto future = promise.getFuture();
+    for (size_t i = 0; i < hops; ++i) {
+        future = future.then([] (djinni::Future<int> f) { return f.get() + 1; });
+    }
+    promise.setValue(0);
+    if (future.get() != static_cast<int>(hops)) {
+        std::abort();
+    }
+    return allocationsSince(start);
+}
+
+// then() on a future that is already ready, so each handler runs inside then().
+size_t chainReady(size_t hops) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    auto future = djinni::Promise<int>::resolve(0);
+    for (size_t i = 0; i < hops; ++i) {
+        future = future.then([] (djinni::Future<int> f) { return f.get() + 1; });
+    }
+    if (future.get() != static_cast<int>(hops)) {
+        std::abort();
+    }
+    return allocationsSince(start);
+}
+
+// A second thread completes `hops` promises in order while this thread attaches
+// a continuation to each of their futures, so then() and setValue() race. This
+// thread then blocks in get() on the future of the last continuation.
+size_t crossThread(size_t hops) {
+    std::vector<djinni::Promise<int>> promises(hops);
+    std::vector<djinni::Future<int>> futures;
+    futures.reserve(hops);
+    for (auto& p: promises) {
+        futures.push_back(p.getFuture());
+    }
+    std::atomic<bool> go{false};
+    std::thread producer([&] {
+        while (!go.load(std::memory_order_acquire)) {}
+        for (auto& p: promises) {
+            p.setValue(1);
+        }
+    });
+    std::atomic<int> sum{0};
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    go.store(true, std::memory_order_release);
+    djinni::Future<void> last = djinni::Promise<void>::resolve(true);
+    for (auto& f: futures) {
+        last = f.then([&sum] (djinni::Future<int> f) { sum += f.get(); });
+    }
+    last.get();
+    auto allocations = allocationsSince(start);
+    producer.join();
+    return allocations;
+}
+
+// Submits `tasks` tiny tasks to the pool from this thread, through the global
+// queue. The last one to finish completes a promise that this thread waits on.
+size_t poolFanOut(djinni::ThreadPool& pool, size_t tasks) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    std::atomic<size_t> remaining{tasks};
+    djinni::Promise<void> done;
+    auto future = done.getFuture();
+    for (size_t i = 0; i < tasks; ++i) {
+        pool.execute([&remaining, &done] {
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                done.setValue();
+            }
+        });
+    }
+    future.get();
+    return allocationsSince(start);
+}
+
+// Same as poolFanOut(), but the tasks are submitted by a task running on the
+// pool. They land on that worker's deque and the other workers steal them.
+size_t poolFanOutFromWorker(djinni::ThreadPool& pool, size_t tasks) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    std::atomic<size_t> remaining{tasks};
+    djinni::Promise<void> done;
+    auto future = done.getFuture();
+    pool.execute([&pool, &remaining, &done, tasks] {
+        for (size_t i = 0; i < tasks; ++i) {
+            pool.execute([&remaining, &done] {
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    done.setValue();
+                }
+            });
+        }
+    });
+    future.get();
+    return allocationsSince(start);
+}
+
+// Runs `tasks` tiny functions with djinni::async() and waits for all of the
+// returned futures with whenAll().
+size_t poolAsyncWhenAll(djinni::ThreadPool& pool, size_t tasks) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    std::vector<djinni::Future<size_t>> futures;
+    futures.reserve(tasks);
+    for (size_t i = 0; i < tasks; ++i) {
+        futures.push_back(djinni::async(pool, [i] { return i; }));
+    }
+    djinni::whenAll(futures).get();
+    return allocationsSince(start);
+}
+
+struct FanInInput {
+    std::vector<djinni::Promise<int>> promises;
+    std::vector<djinni::Future<int>> futures;
+};
+
+FanInInput makeFanInInput(size_t count) {
+    FanInInput input;
+    input.promises.resize(count);
+    input.futures.reserve(count);
+    for (auto& p: input.promises) {
+        input.futures.push_back(p.getFuture());
+    }
+    return input;
+}
+
+// whenAll() over pending futures, which are then completed one by one.
+size_t fanInWhenAll(FanInInput& input) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    auto all = djinni::whenAll(input.futures);
+    for (size_t i = 0; i < input.promises.size(); ++i) {
+        input.promises[i].setValue(static_cast<int>(i));
+    }
+    if (all.get().size() != input.promises.size()) {
+        std::abort();
+    }
+    return allocationsSince(start);
+}
+
+// The same fan-in the way it had to be written before whenAll() returned
+// values: every input gets a then() that stores its result in a side vector
+// under a mutex, and whenAll() only waits for those continuations.
+size_t fanInSideVector(FanInInput& input) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    std::mutex mutex;
+    std::vector<int> results(input.futures.size());
+    std::vector<djinni::Future<void>> done;
+    done.reserve(input.futures.size());
+    for (size_t i = 0; i < input.futures.size(); ++i) {
+        done.push_back(input.futures[i].then([&mutex, &results, i] (djinni::Future<int> f) {
+            auto value = f.get();
+            std::lock_guard lk(mutex);
+            results[i] = value;
+        }));
+    }
+    auto all = djinni::whenAll(done);
+    for (size_t i = 0; i < input.promises.size(); ++i) {
+        input.promises[i].setValue(static_cast<int>(i));
+    }
+    all.get();
+    return allocationsSince(start);
+}
+
+// whenAny() over pending futures. The first one completed wins, and the
+// handlers attached to the others are removed.
+size_t fanInWhenAny(FanInInput& input) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    auto any = djinni::whenAny(input.futures);
+    input.promises.back().setValue(1);
+    if (any.get().first != input.promises.size() - 1) {
+        std::abort();
+    }
+    return allocationsSince(start);
+}
+
+} // namespace
+
+int main() {
+    constexpr size_t hops = 10000;
+    std::printf("%-28s, %8s, %8s, %6s\n", "name", "min ns", "p50 ns", "allocs");
+    std::printf("%-28s, %8s, %8s, %6s\n", "", "per hop", "per hop", "per hop");
+    measure("then before setValue", hops, 50, [] { return chainThenBeforeSet(hops); });
+    measure("then on ready future", hops, 50, [] { return chainReady(hops); });
+    measure("cross-thread then/setValue", hops, 50, [] { return crossThread(hops); });
+
+    constexpr size_t tasks = 1000000;
+    djinni::ThreadPool pool;
+    std::printf("\n%-28s, %8s, %8s, %6s\n", "name", "min ns", "p50 ns", "allocs");
+    std::printf("%-28s, %8s, %8s, %6s\n", "", "per task", "per task", "/task");
+    measure("pool fan-out", tasks, 10, [&pool] { return poolFanOut(pool, tasks); });
+    measure("pool fan-out from worker", tasks, 10, [&pool] { return poolFanOutFromWorker(pool, tasks); });
+    measure("pool async + whenAll", tasks, 10, [&pool] { return poolAsyncWhenAll(pool, tasks); });
+
+    std::printf("\n%-28s, %8s, %8s, %6s\n", "name", "min ns", "p50 ns", "allocs");
+    std::printf("%-28s, %8s, %8s, %6s\n", "", "/input", "/input", "/input");
+    for (size_t inputs: {size_t(10), size_t(1000), size_t(100000)}) {
+        size_t reps = inputs >= 100000 ? 10 : 1000;
+        auto setup = [inputs] { return makeFanInInput(inputs); };
+        std::string suffix = " " + std::to_string(inputs);
+        measure(("whenAll" + suffix).c_str(), inputs, reps, setup, fanInWhenAll);
+        measure(("then + side vector" + suffix).c_str(), inputs, reps, setup, fanInSideVector);
+        measure(("whenAny" + suffix).c_str(), inputs, reps, setup, fanInWhenAny);
+    }
+    return 0;
+}
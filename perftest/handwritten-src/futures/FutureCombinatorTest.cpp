@@ -0,0 +1,206 @@
+// Checks the results of djinni::whenAll() and djinni::whenAny(): whenAll()
+// keeps the order of its inputs whatever order they complete in, handles bool
+// and types without a default constructor, fails with the first exception and
+// has a tuple form; whenAny() reports the first input to complete, even one
+// that is ready before the call, and lets go of the others. Heap blocks are
+// counted through a replaced operator new, to see that whenAny() frees its
+// state without waiting for the losers.
+
+#include "CountingAllocator.hpp"
+#include "Future.hpp"
+#include "TestCheck.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using test_check::check;
+
+struct NoDefault {
+    explicit NoDefault(int v) : value(v) {}
+    int value;
+};
+
+template <typename T>
+std::vector<djinni::Promise<T>> makePromises(size_t count) {
+    return std::vector<djinni::Promise<T>>(count);
+}
+
+template <typename T>
+std::vector<djinni::Future<T>> futuresOf(std::vector<djinni::Promise<T>>& promises) {
+    std::vector<djinni::Future<T>> futures;
+    for (auto& promise: promises) {
+        futures.push_back(promise.getFuture());
+    }
+    return futures;
+}
+
+// Returns the message of the exception that `f` holds, or "" if it holds a value.
+template <typename T>
+std::string exceptionMessage(djinni::Future<T> f) {
+    try {
+        f.get();
+    } catch (const std::exception& e) {
+        return e.what();
+    }
+    return "";
+}
+
+void whenAllKeepsOrder() {
+    constexpr int kInputs = 8;
+    auto promises = makePromises<int>(kInputs);
+    auto all = djinni::whenAll(futuresOf(promises));
+    for (int i = kInputs - 1; i >= 0; --i) {
+        promises[i].setValue(i * 10);
+    }
+    auto results = all.get();
+    bool ordered = results.size() == kInputs;
+    for (int i = 0; ordered && i < kInputs; ++i) {
+        ordered = results[i] == i * 10;
+    }
+    check(ordered, "whenAll keeps the order of its inputs");
+}
+
+// Every input is set from a thread of its own, so neighbouring bools are
+// written at the same time.
+void whenAllOfBool() {
+    constexpr size_t kInputs = 64;
+    auto promises = makePromises<bool>(kInputs);
+    auto all = djinni::whenAll(futuresOf(promises));
+    std::vector<std::thread> setters;
+    for (size_t i = 0; i < kInputs; ++i) {
+        setters.emplace_back([&, i] { promises[i].setValue(i % 3 == 0); });
+    }
+    for (auto& setter: setters) {
+        setter.join();
+    }
+    auto results = all.get();
+    bool ok = results.size() == kInputs;
+    for (size_t i = 0; ok && i < kInputs; ++i) {
+        ok = results[i] == (i % 3 == 0);
+    }
+    check(ok, "whenAll of bool keeps every value");
+}
+
+void whenAllOfNoDefault() {
+    auto promises = makePromises<NoDefault>(3);
+    auto all = djinni::whenAll(futuresOf(promises));
+    promises[2].setValue(NoDefault(2));
+    promises[0].setValue(NoDefault(0));
+    promises[1].setValue(NoDefault(1));
+    auto results = all.get();
+    check(results.size() == 3 && results[0].value == 0 && results[1].value == 1 && results[2].value == 2,
+          "whenAll of a type without default constructor");
+}
+
+void whenAllFirstExceptionWins() {
+    auto promises = makePromises<int>(3);
+    auto all = djinni::whenAll(futuresOf(promises));
+    promises[1].setException(std::runtime_error("first"));
+    check(all.isReady(), "whenAll fails without waiting for the other inputs");
+    promises[2].setException(std::runtime_error("second"));
+    promises[0].setValue(0);
+    check(exceptionMessage(std::move(all)) == "first", "whenAll fails with the first exception");
+
+    auto voidPromises = makePromises<void>(2);
+    auto allVoid = djinni::whenAll(futuresOf(voidPromises));
+    voidPromises[0].setException(std::runtime_error("first"));
+    voidPromises[1].setException(std::runtime_error("second"));
+    check(exceptionMessage(std::move(allVoid)) == "first", "whenAll of void fails with the first exception");
+}
+
+void whenAllTuple() {
+    djinni::Promise<int> a;
+    djinni::Promise<std::string> b;
+    djinni::Promise<NoDefault> c;
+    auto all = djinni::whenAll(a.getFuture(), b.getFuture(), c.getFuture());
+    c.setValue(NoDefault(3));
+    a.setValue(1);
+    b.setValue("two");
+    auto [first, second, third] = all.get();
+    check(first == 1 && second == "two" && third.value == 3, "whenAll of several futures returns a tuple");
+
+    djinni::Promise<int> d;
+    djinni::Promise<std::string> e;
+    auto failed = djinni::whenAll(d.getFuture(), e.getFuture());
+    e.setException(std::runtime_error("tuple"));
+    check(exceptionMessage(std::move(failed)) == "tuple", "whenAll of several futures fails with the exception");
+    d.setValue(4);
+}
+
+void emptyInputs() {
+    auto all = djinni::whenAll(std::vector<djinni::Future<int>>());
+    check(all.isReady() && all.get().empty(), "whenAll of no futures is an empty vector");
+    auto allVoid = djinni::whenAll(std::vector<djinni::Future<void>>());
+    check(allVoid.isReady(), "whenAll of no void futures is ready");
+    bool invalid = false;
+    try {
+        djinni::whenAny(std::vector<djinni::Future<int>>()).get();
+    } catch (const std::invalid_argument&) {
+        invalid = true;
+    }
+    check(invalid, "whenAny of no futures fails with invalid_argument");
+}
+
+void whenAnyWithReadyInput() {
+    auto promises = makePromises<int>(3);
+    promises[1].setValue(7);
+    auto any = djinni::whenAny(futuresOf(promises));
+    check(any.isReady(), "whenAny with a ready input is ready at once");
+    promises[0].setValue(5);
+    promises[2].setValue(9);
+    auto [index, value] = any.get();
+    check(index == 1 && value == 7, "whenAny reports the input that was ready");
+
+    auto voidPromises = makePromises<void>(2);
+    auto anyVoid = djinni::whenAny(futuresOf(voidPromises));
+    voidPromises[1].setValue();
+    voidPromises[0].setValue();
+    check(anyVoid.get() == 1, "whenAny of void reports the first input set");
+
+    auto failing = makePromises<int>(2);
+    auto anyFailed = djinni::whenAny(futuresOf(failing));
+    failing[0].setException(std::runtime_error("any"));
+    failing[1].setValue(1);
+    check(exceptionMessage(std::move(anyFailed)) == "any", "whenAny fails with the exception of the first input");
+}
+
+// Once the winner is known and its result taken, everything whenAny()
+// allocated must be gone even though the other inputs are still pending: the
+// handlers it attached to them held the only other references to its state.
+void whenAnyDetachesLosers() {
+    constexpr size_t kInputs = 16;
+    auto promises = makePromises<int>(kInputs);
+    auto futures = futuresOf(promises);
+    auto before = counting_allocator::liveBlocks.load(std::memory_order_relaxed);
+    {
+        auto any = djinni::whenAny(futures);
+        promises[3].setValue(3);
+        any.get();
+    }
+    check(counting_allocator::liveBlocks.load(std::memory_order_relaxed) == before, "whenAny frees its state before the losers are set");
+    for (size_t i = 0; i < kInputs; ++i) {
+        if (i != 3) {
+            promises[i].setValue(static_cast<int>(i));
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    whenAllKeepsOrder();
+    whenAllOfBool();
+    whenAllOfNoDefault();
+    whenAllFirstExceptionWins();
+    whenAllTuple();
+    emptyInputs();
+    whenAnyWithReadyInput();
+    whenAnyDetachesLosers();
+    return test_check::exitCode();
+}
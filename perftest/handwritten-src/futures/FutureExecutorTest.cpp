@@ -0,0 +1,146 @@
+// Checks that then(executor, handler) and co_await resumeOn(executor) run the
+// continuation on the executor's thread, rather than on the thread that sets
+// the future or the one that attaches the continuation, and that exceptions
+// still reach the next future. Each executor is a ThreadPool with a single
+// worker, so its thread is known.
+//
+// The coroutine cases only run when Future.hpp detects coroutine support (see
+// future-executor-test-coroutines in perftest/BUILD).
+
+#include "Future.hpp"
+#include "TestCheck.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+using test_check::check;
+using ThreadId = std::thread::id;
+
+// A pool with one worker, and the id of that worker's thread.
+struct SingleThreadExecutor {
+    djinni::ThreadPool pool{djinni::ThreadPool::Options{1}};
+    const ThreadId thread = djinni::async(pool, [] { return std::this_thread::get_id(); }).get();
+};
+
+ThreadId currentThread(djinni::Future<int> f) {
+    f.get();
+    return std::this_thread::get_id();
+}
+
+// Returns the message of the exception that `f` holds, or "" if it holds a value.
+template <typename T>
+std::string exceptionMessage(djinni::Future<T> f) {
+    try {
+        f.get();
+    } catch (const std::runtime_error& e) {
+        return e.what();
+    }
+    return "";
+}
+
+// The continuation is attached before another thread sets the future.
+void thenBeforeSet(SingleThreadExecutor& executor) {
+    djinni::Promise<int> promise;
+    auto future = promise.getFuture().then(executor.pool, currentThread);
+    ThreadId setter;
+    std::thread([&] {
+        setter = std::this_thread::get_id();
+        promise.setValue(1);
+    }).join();
+    auto thread = future.get();
+    check(thread == executor.thread, "then before set runs on the executor");
+    check(thread != setter, "then before set does not run on the setter");
+    check(thread != std::this_thread::get_id(), "then before set does not run on the attacher");
+}
+
+// The future is ready when the continuation is attached.
+void thenOnReady(SingleThreadExecutor& executor) {
+    auto thread = djinni::Promise<int>::resolve(1).then(executor.pool, currentThread).get();
+    check(thread == executor.thread, "then on ready runs on the executor");
+    check(thread != std::this_thread::get_id(), "then on ready does not run on the attacher");
+}
+
+// Every hop runs on the executor given to its own then().
+void thenAcrossExecutors(SingleThreadExecutor& first, SingleThreadExecutor& second) {
+    djinni::Promise<int> promise;
+    auto future = promise.getFuture()
+        .then(first.pool, currentThread)
+        .then(second.pool, [&] (djinni::Future<ThreadId> f) {
+            return f.get() == first.thread && std::this_thread::get_id() == second.thread;
+        });
+    promise.setValue(1);
+    check(future.get(), "each hop runs on its own executor");
+}
+
+void thenPropagatesExceptions(SingleThreadExecutor& executor) {
+    auto thrown = djinni::Promise<int>::resolve(1).then(executor.pool, [] (djinni::Future<int>) -> int {
+        throw std::runtime_error("handler");
+    });
+    check(exceptionMessage(std::move(thrown)) == "handler", "exception thrown by the handler reaches the next future");
+
+    djinni::Promise<int> promise;
+    auto forwarded = promise.getFuture()
+        .then(executor.pool, [] (djinni::Future<int> f) { return f.get(); })
+        .then(executor.pool, [] (djinni::Future<int> f) { return f.get(); });
+    promise.setException(std::runtime_error("input"));
+    check(exceptionMessage(std::move(forwarded)) == "input", "exception of the input passes through two hops");
+}
+
+#if defined(DJINNI_FUTURE_HAS_COROUTINE_SUPPORT)
+
+djinni::Future<ThreadId> resumeThread(djinni::Future<int> f, SingleThreadExecutor& executor) {
+    co_await std::move(f).resumeOn(executor.pool);
+    co_return std::this_thread::get_id();
+}
+
+void resumeOnBeforeSet(SingleThreadExecutor& executor) {
+    djinni::Promise<int> promise;
+    auto future = resumeThread(promise.getFuture(), executor);
+    ThreadId setter;
+    std::thread([&] {
+        setter = std::this_thread::get_id();
+        promise.setValue(1);
+    }).join();
+    auto thread = future.get();
+    check(thread == executor.thread, "resumeOn before set resumes on the executor");
+    check(thread != setter, "resumeOn before set does not resume on the setter");
+}
+
+void resumeOnReady(SingleThreadExecutor& executor) {
+    auto thread = resumeThread(djinni::Promise<int>::resolve(1), executor).get();
+    check(thread == executor.thread, "resumeOn on ready resumes on the executor");
+    check(thread != std::this_thread::get_id(), "resumeOn on ready does not resume on the awaiter");
+}
+
+void resumeOnPropagatesExceptions(SingleThreadExecutor& executor) {
+    djinni::Promise<int> promise;
+    auto future = resumeThread(promise.getFuture(), executor);
+    promise.setException(std::runtime_error("input"));
+    check(exceptionMessage(std::move(future)) == "input", "exception of the awaited future leaves the coroutine");
+}
+
+#endif
+
+} // namespace
+
+int main() {
+    SingleThreadExecutor first;
+    SingleThreadExecutor second;
+    thenBeforeSet(first);
+    thenOnReady(first);
+    thenAcrossExecutors(first, second);
+    thenPropagatesExceptions(first);
+#if defined(DJINNI_FUTURE_HAS_COROUTINE_SUPPORT)
+    resumeOnBeforeSet(second);
+    resumeOnReady(second);
+    resumeOnPropagatesExceptions(second);
+#else
+    std::printf("SKIP resumeOn: built without coroutine support\n");
+#endif
+    return test_check::exitCode();
+}
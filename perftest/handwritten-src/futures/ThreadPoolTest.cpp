@@ -0,0 +1,204 @@
+// Checks djinni::ThreadPool: every submitted task runs exactly once, whether it
+// comes from other threads, from a worker whose deque has to grow, or is
+// stolen by another worker; the destructor runs whatever is still queued;
+// async() delivers exceptions; and the worker initializer runs once on every
+// worker before its first task.
+
+#include "Future.hpp"
+#include "TestCheck.hpp"
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using test_check::check;
+
+// One counter per task, so that a task that runs twice shows up as well as
+// one that never runs.
+class RunCounts {
+public:
+    explicit RunCounts(size_t tasks) : _counts(new std::atomic<int>[tasks]), _size(tasks) {
+        for (size_t i = 0; i < tasks; ++i) {
+            _counts[i] = 0;
+        }
+    }
+    void ran(size_t task) {
+        _counts[task].fetch_add(1, std::memory_order_relaxed);
+    }
+    bool allRanOnce() const {
+        for (size_t i = 0; i < _size; ++i) {
+            if (_counts[i].load(std::memory_order_relaxed) != 1) {
+                return false;
+            }
+        }
+        return true;
+    }
+private:
+    std::unique_ptr<std::atomic<int>[]> _counts;
+    size_t _size;
+};
+
+djinni::ThreadPool::Options withThreads(size_t threads) {
+    djinni::ThreadPool::Options options;
+    options.threads = threads;
+    return options;
+}
+
+// Several threads that are not workers submit at once, through the global
+// queue.
+void externalSubmitters() {
+    constexpr size_t kSubmitters = 8;
+    constexpr size_t kTasksEach = 10000;
+    RunCounts counts(kSubmitters * kTasksEach);
+    {
+        djinni::ThreadPool pool(withThreads(4));
+        std::vector<std::thread> submitters;
+        for (size_t s = 0; s < kSubmitters; ++s) {
+            submitters.emplace_back([&, s] {
+                for (size_t i = 0; i < kTasksEach; ++i) {
+                    pool.execute([&counts, task = s * kTasksEach + i] { counts.ran(task); });
+                }
+            });
+        }
+        for (auto& submitter: submitters) {
+            submitter.join();
+        }
+    }
+    check(counts.allRanOnce(), "tasks from external submitters run exactly once");
+}
+
+// A task spawns a binary tree of tasks from the workers. The first level
+// pushes far more tasks than a deque holds at first (256), so the deques
+// have to grow while other workers steal from them.
+void recursiveSpawn() {
+    constexpr size_t kFanOut = 4096;
+    constexpr int kDepth = 4;
+    constexpr size_t kTasks = kFanOut * ((1 << kDepth) - 1);
+    RunCounts counts(kTasks);
+    std::atomic<size_t> next{0};
+    {
+        djinni::ThreadPool pool(withThreads(4));
+        struct Spawn {
+            djinni::ThreadPool& pool;
+            RunCounts& counts;
+            std::atomic<size_t>& next;
+            void operator()(int depth) const {
+                counts.ran(next.fetch_add(1, std::memory_order_relaxed));
+                if (depth > 1) {
+                    for (int child = 0; child < 2; ++child) {
+                        pool.execute([spawn = *this, depth] { spawn(depth - 1); });
+                    }
+                }
+            }
+        };
+        Spawn spawn{pool, counts, next};
+        pool.execute([spawn] {
+            for (size_t i = 0; i < kFanOut; ++i) {
+                spawn.pool.execute([spawn] { spawn(kDepth); });
+            }
+        });
+    }
+    check(next.load() == kTasks && counts.allRanOnce(), "recursively spawned tasks run exactly once");
+}
+
+// One worker keeps feeding its own deque while the others steal from it, so
+// the owner's pop() and the thieves' steal() race for the last tasks over and
+// over.
+void stealRaces() {
+    constexpr size_t kRounds = 2000;
+    constexpr size_t kTasksPerRound = 8;
+    RunCounts counts(kRounds * kTasksPerRound);
+    {
+        djinni::ThreadPool pool(withThreads(4));
+        pool.execute([&] {
+            for (size_t round = 0; round < kRounds; ++round) {
+                for (size_t i = 0; i < kTasksPerRound; ++i) {
+                    pool.execute([&counts, task = round * kTasksPerRound + i] { counts.ran(task); });
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+    check(counts.allRanOnce(), "tasks raced for by the owner and thieves run exactly once");
+}
+
+// The pool is destroyed right after the tasks are submitted. The destructor
+// must run all of them, including the ones they submit meanwhile.
+void destroyWithQueuedTasks() {
+    constexpr size_t kTasks = 1000;
+    std::atomic<size_t> ran{0};
+    {
+        djinni::ThreadPool pool(withThreads(2));
+        for (size_t i = 0; i < kTasks; ++i) {
+            pool.execute([&] {
+                std::this_thread::yield();
+                ran.fetch_add(1, std::memory_order_relaxed);
+                pool.execute([&] { ran.fetch_add(1, std::memory_order_relaxed); });
+            });
+        }
+    }
+    check(ran.load() == 2 * kTasks, "destructor runs every queued task");
+}
+
+void asyncDeliversResults() {
+    djinni::ThreadPool pool(withThreads(2));
+    check(djinni::async(pool, [] { return 42; }).get() == 42, "async() delivers the result");
+    auto failed = djinni::async(pool, [] () -> int { throw std::runtime_error("task"); });
+    std::string message;
+    try {
+        failed.get();
+    } catch (const std::runtime_error& e) {
+        message = e.what();
+    }
+    check(message == "task", "async() delivers the exception");
+}
+
+thread_local bool t_initialized = false;
+
+void workerInitializerRunsOncePerWorker() {
+    constexpr size_t kWorkers = 4;
+    std::mutex mutex;
+    std::multiset<std::thread::id> initialized;
+    djinni::ThreadPool::setWorkerInitializer([&] {
+        std::lock_guard lk(mutex);
+        initialized.insert(std::this_thread::get_id());
+        t_initialized = true;
+    });
+    std::atomic<bool> uninitializedTask{false};
+    {
+        djinni::ThreadPool pool(withThreads(kWorkers));
+        for (size_t i = 0; i < 1000; ++i) {
+            pool.execute([&] {
+                if (!t_initialized) {
+                    uninitializedTask = true;
+                }
+            });
+        }
+    }
+    djinni::ThreadPool::setWorkerInitializer(nullptr);
+    std::set<std::thread::id> distinct(initialized.begin(), initialized.end());
+    check(initialized.size() == kWorkers && distinct.size() == kWorkers,
+          "worker initializer runs once on every worker");
+    check(!uninitializedTask, "worker initializer runs before the worker's tasks");
+}
+
+} // namespace
+
+int main() {
+    externalSubmitters();
+    recursiveSpawn();
+    stealRaces();
+    destroyWithQueuedTasks();
+    asyncDeliversResults();
+    workerInitializerRunsOncePerWorker();
+    return test_check::exitCode();
+}
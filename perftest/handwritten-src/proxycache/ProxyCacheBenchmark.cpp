@@ -0,0 +1,237 @@
+// Micro benchmarks for djinni::ProxyCache. They run in plain C++, with
+// std::shared_ptr proxies and std::weak_ptr cache entries, so they measure the
+// cache itself without the cost of any language boundary. Every line reports
+// the fastest and the median time per operation, and the heap allocations per
+// operation made by the cache (the proxies' own allocations aren't counted).
+// It also reports how many bytes of heap the cache holds per entry.
+
+#include "CountingAllocator.hpp"
+#include "proxy_cache_impl.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct BenchmarkTraits {
+    using UnowningImplPointer = void*;
+    using OwningImplPointer = std::shared_ptr<void>;
+    using OwningProxyPointer = std::shared_ptr<void>;
+    using WeakProxyPointer = std::weak_ptr<void>;
+    using UnowningImplPointerHash = std::hash<void*>;
+    using UnowningImplPointerEqual = std::equal_to<void*>;
+};
+
+using BenchmarkProxyCache = djinni::ProxyCache<BenchmarkTraits>;
+
+struct Impl {
+    int value = 0;
+};
+
+struct Proxy {
+    BenchmarkProxyCache::Handle<std::shared_ptr<void>, Impl> handle;
+    explicit Proxy(const std::shared_ptr<void>& impl) : handle(impl) {}
+};
+
+std::pair<std::shared_ptr<void>, void*> allocProxy(const std::shared_ptr<void>& impl) {
+    counting_allocator::enabled = false;
+    auto proxy = std::make_shared<Proxy>(impl);
+    counting_allocator::enabled = true;
+    return {std::move(proxy), impl.get()};
+}
+
+std::shared_ptr<void> getProxy(const std::shared_ptr<void>& impl) {
+    return BenchmarkProxyCache::get(typeid(Impl), impl, &allocProxy);
+}
+
+std::vector<std::shared_ptr<void>> makeImpls(size_t count) {
+    std::vector<std::shared_ptr<void>> impls;
+    impls.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        impls.push_back(std::make_shared<Impl>());
+    }
+    return impls;
+}
+
+using Clock = std::chrono::steady_clock;
+
+struct Sample {
+    double nanoseconds;
+    size_t allocations;
+};
+
+// Runs `body` `reps` times and prints the fastest and median time per
+// operation, and the allocations per operation of the last run. `body` returns
+// the allocation count of its measured section.
+template <typename Body>
+void measure(const char* name, size_t ops, size_t reps, Body&& body) {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < reps; ++i) {
+        auto start = Clock::now();
+        size_t allocations = body();
+        auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+        samples.push_back({elapsed.count(), allocations});
+    }
+    auto last = samples.back();
+    std::sort(samples.begin(), samples.end(), [] (const Sample& a, const Sample& b) {
+        return a.nanoseconds < b.nanoseconds;
+    });
+    std::printf("%-28s, %8.1f, %8.1f, %6.2f\n", name,
+                samples.front().nanoseconds / ops,
+                samples[samples.size() / 2].nanoseconds / ops,
+                static_cast<double>(last.allocations) / ops);
+}
+
+// Same as above, but only times `body`: `setup` prepares its input, outside of
+// the measured section.
+template <typename Setup, typename Body>
+void measure(const char* name, size_t ops, size_t reps, Setup&& setup, Body&& body) {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < reps; ++i) {
+        auto input = setup();
+        auto start = Clock::now();
+        size_t allocations = body(input);
+        auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+        samples.push_back({elapsed.count(), allocations});
+    }
+    auto last = samples.back();
+    std::sort(samples.begin(), samples.end(), [] (const Sample& a, const Sample& b) {
+        return a.nanoseconds < b.nanoseconds;
+    });
+    std::printf("%-28s, %8.1f, %8.1f, %6.2f\n", name,
+                samples.front().nanoseconds / ops,
+                samples[samples.size() / 2].nanoseconds / ops,
+                static_cast<double>(last.allocations) / ops);
+}
+
+size_t allocationsSince(size_t start) {
+    return counting_allocator::allocations.load(std::memory_order_relaxed) - start;
+}
+
+// get() for each of `impls` in turn, `ops` times in all. Whether these are hits
+// or misses depends on whether the caller holds on to their proxies: a miss
+// creates a proxy that is dropped right away, which removes it from the cache
+// again.
+size_t getRoundRobin(const std::vector<std::shared_ptr<void>>& impls, size_t ops) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < ops; ++i) {
+        if (!getProxy(impls[i % impls.size()])) {
+            std::abort();
+        }
+    }
+    return allocationsSince(start);
+}
+
+struct Population {
+    std::vector<std::shared_ptr<void>> impls;
+    std::vector<std::shared_ptr<void>> proxies;
+};
+
+// Objects without proxies, and room to hold the proxies that insert() creates.
+Population makeFreshPopulation(size_t count) {
+    Population population{makeImpls(count), {}};
+    population.proxies.reserve(count);
+    return population;
+}
+
+// Objects whose proxies are held, for erase().
+Population makeLivePopulation(size_t count) {
+    auto population = makeFreshPopulation(count);
+    for (auto& impl: population.impls) {
+        population.proxies.push_back(getProxy(impl));
+    }
+    return population;
+}
+
+// Creates and keeps a proxy for every object, so every get() inserts an entry.
+size_t insert(Population& population) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    for (auto& impl: population.impls) {
+        population.proxies.push_back(getProxy(impl));
+    }
+    return allocationsSince(start);
+}
+
+// Drops every proxy, so every proxy's Handle removes its entry.
+size_t erase(Population& population) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    population.proxies.clear();
+    return allocationsSince(start);
+}
+
+// Looks up the proxies for a list of objects one get() at a time, as the JNI
+// list marshallers used to, then drops them.
+size_t getList(const std::vector<std::shared_ptr<void>>& impls) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    std::vector<std::shared_ptr<void>> proxies;
+    proxies.reserve(impls.size());
+    for (auto& impl: impls) {
+        proxies.push_back(getProxy(impl));
+    }
+    return allocationsSince(start);
+}
+
+// Same as getList(), with a single get_batch() call.
+size_t getListBatch(const std::vector<std::shared_ptr<void>>& impls) {
+    auto start = counting_allocator::allocations.load(std::memory_order_relaxed);
+    std::vector<std::shared_ptr<void>> proxies(impls.size());
+    BenchmarkProxyCache::get_batch(typeid(Impl), impls.data(), impls.size(), &allocProxy,
+                                   proxies.data());
+    return allocationsSince(start);
+}
+
+} // namespace
+
+int main() {
+    constexpr size_t ops = 100000;
+    std::printf("%-28s, %8s, %8s, %6s\n", "name", "min ns", "p50 ns", "allocs");
+    std::printf("%-28s, %8s, %8s, %6s\n", "", "per op", "per op", "per op");
+
+    // The same object is passed on every call, as in perftest's returnObject.
+    auto one = makeImpls(1);
+    auto oneProxy = getProxy(one[0]);
+    measure("hit same object", ops, 20, [&] { return getRoundRobin(one, ops); });
+    auto eight = makeImpls(8);
+    std::vector<std::shared_ptr<void>> eightProxies;
+    for (auto& impl: eight) {
+        eightProxies.push_back(getProxy(impl));
+    }
+    measure("hit 8 objects round robin", ops, 20, [&] { return getRoundRobin(eight, ops); });
+    // Nothing keeps the proxy alive, as in perftest's argObject.
+    auto dropped = makeImpls(1);
+    measure("miss + drop", ops, 20, [&] { return getRoundRobin(dropped, ops); });
+
+    constexpr size_t entries = 10000;
+    measure("insert 10000", entries, 20,
+            [] { return makeFreshPopulation(entries); }, insert);
+    measure("erase 10000", entries, 20,
+            [] { return makeLivePopulation(entries); }, erase);
+
+    // A list of 128 objects, as in perftest's argListObject 128. Without anything
+    // else holding them, every proxy is created and then removed again.
+    constexpr size_t listSize = 128;
+    auto list = makeImpls(listSize);
+    measure("list get x128 miss", listSize, 2000, [&] { return getList(list); });
+    measure("list get_batch 128 miss", listSize, 2000, [&] { return getListBatch(list); });
+    std::vector<std::shared_ptr<void>> listProxies;
+    for (auto& impl: list) {
+        listProxies.push_back(getProxy(impl));
+    }
+    measure("list get x128 hit", listSize, 2000, [&] { return getList(list); });
+    measure("list get_batch 128 hit", listSize, 2000, [&] { return getListBatch(list); });
+
+    // Heap held by the cache for its entries, including the table's empty slots.
+    // Measured from an empty cache, after the runs above have shrunk it again.
+    auto population = makeFreshPopulation(entries);
+    auto before = counting_allocator::liveBytes.load(std::memory_order_relaxed);
+    insert(population);
+    auto after = counting_allocator::liveBytes.load(std::memory_order_relaxed);
+    std::printf("\n%-28s, %8.1f\n", "cache bytes per entry",
+                static_cast<double>(after - before) / entries);
+    return 0;
+}
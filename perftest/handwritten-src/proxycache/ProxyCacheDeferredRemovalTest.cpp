@@ -0,0 +1,210 @@
+// Checks that removals deferred by DJINNI_PROXY_CACHE_DEFERRED_REMOVALS never
+// make the cache compare a key that its Handle has already released, and that
+// the strong references the cache takes internally are all released again.
+//
+// The traits below model the JNI caches: a key is a reference that the proxy's
+// Handle deletes when the proxy goes away (a GlobalRef), comparing a deleted
+// reference is an error (IsSameObject on a deleted GlobalRef), and a strong
+// reference to a proxy must be released explicitly (a local reference). Keys
+// for objects of the same parity hash to the same value, so lookups probe past
+// every entry of that parity.
+
+#define DJINNI_PROXY_CACHE_SHARDS 1
+#define DJINNI_PROXY_CACHE_DEFERRED_REMOVALS 1
+
+#include "TestCheck.hpp"
+#include "proxy_cache_impl.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using test_check::check;
+
+std::atomic<int> deletedComparisons{0};
+std::atomic<int> liveLocalRefs{0};
+
+// A reference to object `object`. References are never freed, so that a
+// comparison with a deleted one can be detected rather than crash.
+struct Ref {
+    const int object;
+    std::atomic<bool> deleted{false};
+    explicit Ref(int o) : object(o) {}
+};
+
+Ref* newRef(int object) {
+    static std::mutex mutex;
+    static std::deque<Ref> refs;
+    std::lock_guard<std::mutex> lock(mutex);
+    return &refs.emplace_back(object);
+}
+
+struct RefHash {
+    size_t operator()(Ref* ref) const { return ref->object % 2; }
+};
+
+struct RefEqual {
+    bool operator()(Ref* lhs, Ref* rhs) const {
+        if (lhs->deleted || rhs->deleted) {
+            deletedComparisons.fetch_add(1);
+        }
+        return lhs->object == rhs->object;
+    }
+};
+
+// Owns a reference and deletes it when destroyed, as GlobalRef does.
+class RefOwner {
+public:
+    RefOwner(Ref* ref) : _ref(ref) {}
+    ~RefOwner() { _ref->deleted = true; }
+    Ref* get() const { return _ref; }
+    explicit operator bool() const { return _ref != nullptr; }
+private:
+    Ref* _ref;
+};
+
+struct Proxy;
+
+// A strong reference that isn't released by going out of scope.
+struct LocalRef {
+    std::shared_ptr<Proxy>* strong = nullptr;
+    explicit operator bool() const { return strong != nullptr; }
+};
+
+LocalRef newLocalRef(std::shared_ptr<Proxy> proxy) {
+    liveLocalRefs.fetch_add(1);
+    return LocalRef{new std::shared_ptr<Proxy>(std::move(proxy))};
+}
+
+struct WeakRef {
+    std::weak_ptr<Proxy> weak;
+    explicit WeakRef(const LocalRef& ref) : weak(*ref.strong) {}
+    LocalRef lock() const {
+        auto strong = weak.lock();
+        return strong ? newLocalRef(std::move(strong)) : LocalRef{};
+    }
+    bool expired() const { return weak.expired(); }
+};
+
+struct TestTraits {
+    using UnowningImplPointer = Ref*;
+    using OwningImplPointer = Ref*;
+    using OwningProxyPointer = LocalRef;
+    using WeakProxyPointer = WeakRef;
+    using UnowningImplPointerHash = RefHash;
+    using UnowningImplPointerEqual = RefEqual;
+    static void release_proxy(const LocalRef& ref) {
+        liveLocalRefs.fetch_sub(1);
+        delete ref.strong;
+    }
+};
+
+using TestProxyCache = djinni::ProxyCache<TestTraits>;
+
+struct Proxy {
+    TestProxyCache::Handle<RefOwner, Proxy> handle;
+    explicit Proxy(Ref* ref) : handle(ref) {}
+};
+
+// Called under the shard's mutex, when a proxy for object `hookObject` is created.
+int hookObject = -1;
+std::function<void()> hook;
+
+std::pair<LocalRef, Ref*> allocProxy(Ref* const& impl) {
+    if (impl->object == hookObject) {
+        hook();
+    }
+    // Like a JNI proxy, the proxy holds a reference of its own to the object.
+    auto proxy = std::make_shared<Proxy>(newRef(impl->object));
+    Ref* key = proxy->handle.get().get();
+    return {newLocalRef(std::move(proxy)), key};
+}
+
+LocalRef get(int object) {
+    return TestProxyCache::get(typeid(Proxy), newRef(object), &allocProxy);
+}
+
+djinni::ProxyCacheCounters proxyCounters() {
+    auto counters = TestProxyCache::counters();
+    auto it = counters.find(typeid(Proxy).name());
+    return it == counters.end() ? djinni::ProxyCacheCounters{} : it->second;
+}
+
+// A proxy dies while another thread holds the shard's mutex, so its removal is
+// deferred and its key deleted. The lock holder then looks up a key that
+// collides with it, before applying the removal: get_batch() creates the
+// proxies for objects 2 and 3 under one lock, and object 1 dies while the
+// proxy for object 2 is being created.
+void deferredRemovalRacesWithLookup() {
+    LocalRef first = get(1);
+    hookObject = 2;
+    hook = [&] {
+        std::thread([&] { TestTraits::release_proxy(first); }).join();
+    };
+    Ref* impls[] = {newRef(2), newRef(3)};
+    LocalRef proxies[2];
+    TestProxyCache::get_batch(typeid(Proxy), impls, 2, &allocProxy, proxies);
+    hookObject = -1;
+    check(proxyCounters().deferred_removes == 1, "removal was deferred");
+    check(deletedComparisons == 0, "lookup did not compare the deleted key");
+    check(liveLocalRefs == 2, "only the returned local references are live");
+    for (auto& proxy : proxies) {
+        TestTraits::release_proxy(proxy);
+    }
+    TestProxyCache::drain();
+    check(TestProxyCache::stats().empty(), "every entry was removed");
+}
+
+// Threads keep creating and dropping proxies for a few objects whose keys
+// collide, so that removals are often deferred while lookups probe past them.
+void churn() {
+    constexpr int kThreads = 4;
+    constexpr int kIterations = 20000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t] {
+            unsigned seed = t + 1;
+            LocalRef held[4];
+            for (int i = 0; i < kIterations; ++i) {
+                seed = seed * 1103515245 + 12345;
+                auto& slot = held[(seed >> 16) % 4];
+                if (slot) {
+                    TestTraits::release_proxy(slot);
+                }
+                slot = get(static_cast<int>((seed >> 8) % 16));
+            }
+            for (auto& ref : held) {
+                if (ref) {
+                    TestTraits::release_proxy(ref);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    TestProxyCache::drain();
+    auto counters = proxyCounters();
+    std::printf("     %llu misses, %llu deferred removals\n",
+                static_cast<unsigned long long>(counters.misses),
+                static_cast<unsigned long long>(counters.deferred_removes));
+    check(deletedComparisons == 0, "churn never compared a deleted key");
+    check(liveLocalRefs == 0, "churn released every local reference");
+    check(TestProxyCache::stats().empty() && counters.live() == 0,
+          "churn left no entries behind");
+}
+
+} // namespace
+
+int main() {
+    deferredRemovalRacesWithLookup();
+    churn();
+    return test_check::exitCode();
+}
@@ -0,0 +1,67 @@
+// Replaces the global operator new and delete with versions that count heap
+// blocks, for the benchmarks and tests that check what the code under test
+// allocates. Include it from exactly one source file of a binary: it defines
+// the replacement functions, which the program may only define once.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace counting_allocator {
+
+// Blocks allocated with counting on since the program started.
+inline std::atomic<size_t> allocations{0};
+// Blocks allocated with counting on and not yet freed, and their total size.
+inline std::atomic<size_t> liveBlocks{0};
+inline std::atomic<size_t> liveBytes{0};
+// Blocks a thread allocates while this is false are left out of the counts,
+// when they are allocated and when they are freed.
+inline thread_local bool enabled = true;
+
+// Every block starts with a header that records its size, and whether it was
+// counted, so that freeing it can be accounted for.
+struct alignas(std::max_align_t) BlockHeader {
+    size_t size;
+    bool counted;
+};
+
+inline void* allocate(size_t size) {
+    auto* header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+    if (!header) {
+        throw std::bad_alloc();
+    }
+    header->size = size;
+    header->counted = enabled;
+    if (header->counted) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        liveBlocks.fetch_add(1, std::memory_order_relaxed);
+        liveBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    return header + 1;
+}
+
+inline void deallocate(void* p) noexcept {
+    if (!p) {
+        return;
+    }
+    auto* header = static_cast<BlockHeader*>(p) - 1;
+    if (header->counted) {
+        liveBlocks.fetch_sub(1, std::memory_order_relaxed);
+        liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+    }
+    std::free(header);
+}
+
+} // namespace counting_allocator
+
+// Every form of new and delete goes through allocate() and deallocate(), so
+// that blocks are always freed the way they were allocated.
+void* operator new(size_t size) { return counting_allocator::allocate(size); }
+void* operator new[](size_t size) { return counting_allocator::allocate(size); }
+void operator delete(void* p) noexcept { counting_allocator::deallocate(p); }
+void operator delete[](void* p) noexcept { counting_allocator::deallocate(p); }
+void operator delete(void* p, size_t) noexcept { counting_allocator::deallocate(p); }
+void operator delete[](void* p, size_t) noexcept { counting_allocator::deallocate(p); }
@@ -0,0 +1,24 @@
+// PASS/FAIL reporting shared by the support library tests. Every check()
+// prints one line, and main() returns exitCode(), so that `bazel test` fails
+// if any check did.
+
+#pragma once
+
+#include <cstdio>
+
+namespace test_check {
+
+inline int failures = 0;
+
+inline void check(bool ok, const char* what) {
+    std::printf("%s %s\n", ok ? "PASS" : "FAIL", what);
+    if (!ok) {
+        ++failures;
+    }
+}
+
+inline int exitCode() {
+    return failures == 0 ? 0 : 1;
+}
+
+} // namespace test_check
@@ -55,6 +55,10 @@ class ObjectPlatformImpl {
     onDone() {}
 }
 
+class ObjectPlatformUncachedImpl {
+    onDone() {}
+}
+
 function main (module: perftest.Perftest_statics & DjinniModule) {
     var minCount = 16;
     var lowCount = 128;
@@ -107,6 +111,11 @@ function main (module: perftest.Perftest_statics & DjinniModule) {
     var e = perftest.EnumSixValue.FIRST;
     measure("argEnumSixValue", function() {dpb.argEnumSixValue(e)});
 
+    [1, 8, 32].forEach(function(count) {
+        var f = dpb.returnFlagsThirtyTwoValue(count);
+        measure("argFlagsThirtyTwoValue " + count, function() {dpb.argFlagsThirtyTwoValue(f)});
+    });
+
     var r = i64Array;
     measure("argRecordSixInt", function() {dpb.argRecordSixInt(r)});
 
@@ -117,6 +126,9 @@ function main (module: perftest.Perftest_statics & DjinniModule) {
     var o = new ObjectPlatformImpl();
     measure("argObject", function(){dpb.argObject(o)});
 
+    var ou = new ObjectPlatformUncachedImpl();
+    measure("argObjectUncached", function(){dpb.argObjectUncached(ou)});
+
     var lo: ObjectPlatformImpl[] = []
     for (var i = 0; i < lowCount; ++i) {lo.push(new ObjectPlatformImpl())}
     measure("argListObject " + lowCount, function() {dpb.argListObject(lo)});
@@ -125,11 +137,22 @@ function main (module: perftest.Perftest_statics & DjinniModule) {
     for (var i = 0; i < lowCount; ++i) {lr.push(i64Array)}
     measure("argListRecord " + lowCount, function(){dpb.argListRecord(lr)});
 
+    var lr16 = dpb.returnListRecordSixteenInt(lowCount);
+    measure("argListRecordSixteenInt " + lowCount, function(){dpb.argListRecordSixteenInt(lr16)});
+
+    var lr64 = dpb.returnListRecordSixtyFourInt(lowCount);
+    measure("argListRecordSixtyFourInt " + lowCount, function(){dpb.argListRecordSixtyFourInt(lr64)});
+
     var ar: (typeof i64Array)[] = []
     for (var i = 0; i < lowCount; ++i) {ar.push(i64Array)}
     measure("argArrayRecord " + lowCount, function(){dpb.argArrayRecord(ar)});
 
     measure("returnInt", function() {var ri = dpb.returnInt(BigInt(42))});
+    measure("returnEnumSixValue", function() {var re = dpb.returnEnumSixValue()});
+
+    [1, 8, 32].forEach(function(count) {
+        measure("returnFlagsThirtyTwoValue " + count, function() {var rf = dpb.returnFlagsThirtyTwoValue(count)});
+    });
 
     [1, 10, lowCount].forEach(function(count) {
         measure("returnListInt " + count, function(){ var rli = dpb.returnListInt(count)});
@@ -139,15 +162,29 @@ function main (module: perftest.Perftest_statics & DjinniModule) {
         measure("returnArrayInt " + count, function(){ var rai = dpb.returnArrayInt(count)});
     });
 
+    [16, 1000, 100000].forEach(function(count) {
+        var m = dpb.returnMapStringInt(count);
+        measure("argMapStringInt " + count, function() {dpb.argMapStringInt(m)});
+        measure("returnMapStringInt " + count, function() {var rm = dpb.returnMapStringInt(count)});
+        var s = dpb.returnSetString(count);
+        measure("argSetString " + count, function() {dpb.argSetString(s)});
+        measure("returnSetString " + count, function() {var rs = dpb.returnSetString(count)});
+    });
+
     [minCount, lowCount, highCount, hugeCount].forEach(function(count) {
         measure("returnString " + count, function() { var rs = dpb.returnString(count)});
     });
 
+    var si = 0;
+    measure("returnShortString 32", function() { var rs = dpb.returnShortString(si++)});
+    measure("returnInternedString 32", function() { var rs = dpb.returnInternedString(si++)});
+
     [lowCount, highCount, hugeCount].forEach(function(count) {
         measure("returnBinary " + count, function() { var rb = dpb.returnBinary(count)});
     });
 
     measure("returnObject", function() { var ro = dpb.returnObject()});
+    measure("returnObjectUncached", function() { var rou = dpb.returnObjectUncached()});
 
     [10, 100].forEach(function(count) {
         measure("returnListObject " + count, function(){var rlo = dpb.returnListObject(count)});
@@ -157,6 +194,14 @@ function main (module: perftest.Perftest_statics & DjinniModule) {
         measure("returnListRecord " + count, function(){var rlr = dpb.returnListRecord(count)});
     });
 
+    [1, 10, lowCount].forEach(function(count) {
+        measure("returnListRecordSixteenInt " + count, function(){var rlr = dpb.returnListRecordSixteenInt(count)});
+    });
+
+    [1, 10, lowCount].forEach(function(count) {
+        measure("returnListRecordSixtyFourInt " + count, function(){var rlr = dpb.returnListRecordSixtyFourInt(count)});
+    });
+
     [1, 10, lowCount].forEach(function(count) {
         measure("returnArrayRecord " + count, function(){var rar = dpb.returnArrayRecord(count)});
     });
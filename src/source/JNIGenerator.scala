@@ -102,6 +102,7 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
 
     val jniHelper = jniMarshal.helperClass(ident)
     val cppSelf = cppMarshal.fqTypename(ident, r) + cppTypeArgs(params)
+    val packed = isPackedRecord(params, r)
 
     def writeJniPrototype(w: IndentWriter) {
       writeJniTypeParams(w, params)
@@ -116,6 +117,15 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.wl
         w.wl(s"static CppType toCpp(JNIEnv* jniEnv, JniType j);")
         w.wl(s"static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);")
+        if (packed) {
+          w.wl
+          w.wl("// Lists of this record cross JNI as a long[] with one slot per field (see ::djinni::List)")
+          w.wl(s"static constexpr size_t kPackedFields = ${r.fields.size};")
+          w.wl(s"static void pack(const CppType& c, jlong* out);")
+          w.wl(s"static CppType unpack(const jlong* in);")
+          w.wl(s"static ::djinni::LocalRef<jlongArray> packList(JNIEnv* jniEnv, jobject list);")
+          w.wl(s"static ::djinni::LocalRef<jobject> unpackList(JNIEnv* jniEnv, jlongArray packed);")
+        }
         w.wl
         w.wlOutdent("private:")
         w.wl(s"$jniHelper();")
@@ -125,6 +135,10 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.wl(s"const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass($classLookup) };")
         val constructorSig = q(jniMarshal.javaMethodSignature(r.fields, None))
         w.wl(s"const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), ${q("<init>")}, $constructorSig) };")
+        if (packed) {
+          w.wl(s"const jmethodID jpackList { ::djinni::jniGetStaticMethodID(clazz.get(), ${q("packList")}, ${q("(Ljava/util/ArrayList;)[J")}) };")
+          w.wl(s"const jmethodID junpackList { ::djinni::jniGetStaticMethodID(clazz.get(), ${q("unpackList")}, ${q("([J)Ljava/util/ArrayList;")}) };")
+        }
         for (f <- r.fields) {
           val javaFieldName = idJava.field(f.ident)
           val javaSig = q(jniMarshal.fqTypename(f.ty))
@@ -181,6 +195,42 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         })
         w.wl(";")
       }
+      if (packed) {
+        w.wl
+        w.w(s"void $jniHelper::pack(const CppType& c, jlong* out)").braced {
+          for ((f, i) <- r.fields.zipWithIndex) {
+            val name = idCpp.field(f.ident)
+            val value = f.ty.resolved.base match {
+              case p: MPrimitive => s"${jniMarshal.helperName(f.ty.resolved)}::pack(c.$name)"
+              case _ => s"static_cast<jlong>(c.$name)"
+            }
+            w.wl(s"out[$i] = $value;")
+          }
+        }
+        w.wl
+        w.w(s"auto $jniHelper::unpack(const jlong* in) -> CppType").braced {
+          val fieldIndex = r.fields.zipWithIndex.toMap
+          writeAlignedCall(w, "return {", r.fields, "}", f => f.ty.resolved.base match {
+            case p: MPrimitive => s"${jniMarshal.helperName(f.ty.resolved)}::unpack(in[${fieldIndex(f)}])"
+            case _ => s"static_cast<${cppMarshal.fqTypename(f.ty)}>(in[${fieldIndex(f)}])"
+          })
+          w.wl(";")
+        }
+        w.wl
+        w.w(s"auto $jniHelper::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray>").braced {
+          w.wl(s"const auto& data = ::djinni::JniClass<$jniHelper>::get();")
+          w.wl(s"auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};")
+          w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
+          w.wl(s"return r;")
+        }
+        w.wl
+        w.w(s"auto $jniHelper::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject>").braced {
+          w.wl(s"const auto& data = ::djinni::JniClass<$jniHelper>::get();")
+          w.wl(s"auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};")
+          w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
+          w.wl(s"return r;")
+        }
+      }
     }
     writeJniFiles(origin, params.nonEmpty, ident, refs, writeJniPrototype, writeJniBody)
   }
@@ -198,6 +248,9 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
     i.consts.foreach(c => {
       refs.find(c.ty)
     })
+    if (i.methods.exists(isZeroCopyBinaryResult)) {
+      refs.jniCpp.add("#include " + jniMarshal.zeroCopyBinaryHeader)
+    }
 
     val jniSelf = jniMarshal.helperClass(ident)
     val cppSelf = cppMarshal.fqTypename(ident, i) + cppTypeArgs(typeParams)
@@ -218,6 +271,10 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.wl
         w.wl(s"using Boxed = $jniSelf;")
         w.wl
+        if (i.uncached) {
+          w.wl("static constexpr bool kUsesProxyCache = false;")
+          w.wl
+        }
         w.wl(s"~$jniSelf();")
         w.wl
         if (spec.cppNnType.nonEmpty) {
@@ -256,7 +313,7 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
           w.wl(s"const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass(${q(classLookup)}) };")
           for (m <- i.methods) {
             val javaMethodName = idJava.method(m.ident)
-            val javaMethodSig = q(jniMarshal.javaMethodSignature(m.params, m.ret))
+            val javaMethodSig = q(jniMarshal.javaMethodSignature(m.params, m.ret, isZeroCopyBinaryResult(m)))
             w.wl(s"const jmethodID method_$javaMethodName { ::djinni::jniGetMethodID(clazz.get(), ${q(javaMethodName)}, $javaMethodSig) };")
           }
         }
@@ -283,7 +340,8 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
       w.wl
       if (i.ext.java) {
         writeJniTypeParams(w, typeParams)
-        w.wl(s"$jniSelfWithParams::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }")
+        val bypass = if (i.uncached) "::djinni::ProxyCacheBypass{}, " else ""
+        w.wl(s"$jniSelfWithParams::JavaProxy::JavaProxy(JniType j) : Handle($bypass::djinni::jniGetThreadEnv(), j) { }")
         w.wl
         writeJniTypeParams(w, typeParams)
         w.wl(s"$jniSelfWithParams::JavaProxy::~JavaProxy() = default;")
@@ -299,7 +357,8 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             w.wl(s"auto jniEnv = ::djinni::jniGetThreadEnv();")
             w.wl(s"::djinni::JniLocalScope jscope(jniEnv, 10);")
             w.wl(s"const auto& data = ::djinni::JniClass<${withNs(Some(spec.jniNamespace), jniSelf)}>::get();")
-            val call = m.ret.fold("jniEnv->CallVoidMethod(")(r => "auto jret = " + toJniCall(r, (jt: String) => s"jniEnv->Call${jt}Method("))
+            val zeroCopy = isZeroCopyBinaryResult(m)
+            val call = m.ret.fold("jniEnv->CallVoidMethod(")(r => "auto jret = " + (if (zeroCopy) "jniEnv->CallObjectMethod(" else toJniCall(r, (jt: String) => s"jniEnv->Call${jt}Method(")))
             w.w(call)
             w.w(s"Handle::get().get(), data.method_$javaMethodName")
             if(m.params.nonEmpty){
@@ -326,7 +385,10 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
                 }
                 case _ =>
               }
-              w.wl(s"return ${jniMarshal.toCpp(ty, "jret")};")
+              if (zeroCopy)
+                w.wl(s"return ${jniMarshal.zeroCopyBinaryHelper}::toCpp(jniEnv, jret);")
+              else
+                w.wl(s"return ${jniMarshal.toCpp(ty, "jret")};")
             })
           }
         }
@@ -347,9 +409,9 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             s"${prefix}_00024CppProxy_$methodNameMunged"
         }
 
-        def nativeHook(name: String, static: Boolean, params: Iterable[Field], ret: Option[TypeRef], f: => Unit) = {
+        def nativeHook(name: String, static: Boolean, params: Iterable[Field], ret: Option[TypeRef], zeroCopyResult: Boolean, f: => Unit) = {
           val paramList = params.map(p => jniMarshal.paramType(p.ty) + " j_" + idJava.local(p.ident)).mkString(", ")
-          val jniRetType = jniMarshal.fqReturnType(ret)
+          val jniRetType = if (zeroCopyResult) "jobject" else jniMarshal.fqReturnType(ret)
           w.wl
           val zero = ret.fold("")(s => "0 /* value doesn't matter */")
           // if we use OnLoad for method registration we don't want to export the functions
@@ -372,12 +434,13 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             }
           }
         }
-        nativeHook("nativeDestroy", false, Seq.empty, None, {
+        nativeHook("nativeDestroy", false, Seq.empty, None, false, {
           w.wl(s"delete reinterpret_cast<::djinni::CppProxyHandle<$cppSelf>*>(nativeRef);")
         })
         for (m <- i.methods.filter(m => !m.static || m.lang.java)) {
           val nativeAddon = if (m.static) "" else "native_"
-          nativeHook(nativeAddon + idJava.method(m.ident), m.static, m.params, m.ret, {
+          val zeroCopy = isZeroCopyBinaryResult(m)
+          nativeHook(nativeAddon + idJava.method(m.ident), m.static, m.params, m.ret, zeroCopy, {
             //w.wl(s"::${spec.jniNamespace}::JniLocalScope jscope(jniEnv, 10);")
             if (!m.static) w.wl(s"const auto& ref = ::djinni::objectFromHandleAddress<$cppSelf>(nativeRef);")
             m.params.foreach(p => {
@@ -395,9 +458,12 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             val ret = m.ret.fold("")(r => "auto r = ")
             //FIXME: val call = if (m.static) s"$cppSelf::$methodName(" else s"ref->$methodName("
             val call = s"$cppBinding::$methodName(" + (if (m.static) "" else ("ref" + (if (m.params.isEmpty) "" else ", ")))
-            writeAlignedCall(w, ret + call, m.params, ")", p => jniMarshal.toCpp(p.ty, "j_" + idJava.local(p.ident)))
+            writeAlignedCall(w, ret + call, m.params, ")", p => jniMarshal.toCppParam(p.ty, "j_" + idJava.local(p.ident)))
             w.wl(";")
-            m.ret.fold()(r => w.wl(s"return ::djinni::release(${jniMarshal.fromCpp(r, cppMarshal.maybeMove("r", r))});"))
+            if (zeroCopy)
+              w.wl(s"return ::djinni::release(${jniMarshal.zeroCopyBinaryHelper}::fromCpp(jniEnv, std::move(r)));")
+            else
+              m.ret.fold()(r => w.wl(s"return ::djinni::release(${jniMarshal.fromCpp(r, cppMarshal.maybeMove("r", r))});"))
           })
         }
 
@@ -421,7 +487,7 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
               val javaName = nativeAddon + idJava.method(m.ident)
               val functionName = methodName(javaName, m.static)
               w.bracedEnd(",") {
-                var signature = jniMarshal.javaMethodSignature(m.params, m.ret)
+                var signature = jniMarshal.javaMethodSignature(m.params, m.ret, isZeroCopyBinaryResult(m))
                 // all non-static methods have an implicit long argument for the c++ pointer
                 // that isn't added by javaMethodSignature
                 if (!isStaticRecord) {
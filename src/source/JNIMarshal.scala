@@ -50,6 +50,16 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
     s"${helperClass(tm)}::fromCpp(jniEnv, $expr)"
   }
 
+  // For the parameters of C++ methods called from Java. Arena messages (see usesProtobufArena) are
+  // only parsed on the arena here, where the method takes them by const reference. Anywhere else
+  // (containers, optionals, records, proxy results) they end up in an owned value, so the arena
+  // would only add a copy.
+  def toCppParam(tm: MExpr, expr: String): String = tm.base match {
+    case MProtobuf(_,_,p) if usesProtobufArena(p) => s"::djinni::ArenaProtobuf${helperTemplates(tm)}::toCpp(jniEnv, $expr)"
+    case _ => toCpp(tm, expr)
+  }
+  def toCppParam(ty: TypeRef, expr: String): String = toCppParam(ty.resolved, expr)
+
   // Name for the autogenerated class containing field/method IDs and toJava()/fromJava() methods
   def helperClass(name: String) = spec.jniClassIdentStyle(name)
   private def helperClass(tm: MExpr): String = helperName(tm) + helperTemplates(tm)
@@ -57,7 +67,8 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
   def references(m: Meta, exclude: String = ""): Seq[SymbolReference] = m match {
     case o: MOpaque => List(ImportRef(q(spec.jniBaseLibIncludePrefix + "Marshal.hpp")))
     case p: MProtobuf => {
-      val headers = List(ImportRef(q(spec.jniBaseLibIncludePrefix + "Marshal.hpp")))
+      val marshal = if (usesProtobufArena(p.body)) "ProtobufArena_jni.hpp" else "Marshal.hpp"
+      val headers = List(ImportRef(q(spec.jniBaseLibIncludePrefix + marshal)))
       p.body.java.jniHeader match {
         case Some(serialzerHeader) => ImportRef(serialzerHeader) :: headers
         case _ => headers
@@ -131,10 +142,14 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
     case default => default         // otherwise
   }
 
-  def javaMethodSignature(params: Iterable[Field], ret: Option[TypeRef]) = {
-    params.map(f => typename(f.ty)).mkString("(", "", ")") + ret.fold("V")(typename)
+  def javaMethodSignature(params: Iterable[Field], ret: Option[TypeRef], zeroCopyResult: Boolean = false) = {
+    params.map(f => typename(f.ty)).mkString("(", "", ")") + (if (zeroCopyResult) "Ljava/nio/ByteBuffer;" else ret.fold("V")(typename))
   }
 
+  // Marshaller for binary results returned as a java.nio.ByteBuffer (see isZeroCopyBinaryResult)
+  val zeroCopyBinaryHelper = withNs(Some("djinni"), "BinaryBuffer")
+  def zeroCopyBinaryHeader = q(spec.jniBaseLibIncludePrefix + "DataRef_jni.hpp")
+
   def javaClassNameAsCppType(fqJavaClass: String): String = {
     val classNameChars = fqJavaClass.toList.map(c => s"'$c'")
     s"""::djinni::JavaClassName<${classNameChars.mkString(",")}>"""
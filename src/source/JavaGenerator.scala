@@ -141,6 +141,9 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
     })
   }
 
+  def methodReturnType(m: Interface.Method): String =
+    if (isZeroCopyBinaryResult(m)) "java.nio.ByteBuffer" else marshal.returnType(m.ret)
+
   override def generateInterface(origin: String, ident: Ident, doc: Doc, typeParams: Seq[TypeParam], i: Interface) {
     val refs = new JavaRefs()
 
@@ -191,7 +194,7 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
         for (m <- i.methods if !m.static) {
           skipFirst { w.wl }
           writeMethodDoc(w, m, idJava.local)
-          val ret = marshal.returnType(m.ret)
+          val ret = methodReturnType(m)
           val params = m.params.map(p => {
             val nullityAnnotation = marshal.nullityAnnotation(p.ty).map(_ + " ").getOrElse("")
             nullityAnnotation + marshal.paramType(p.ty) + " " + idJava.local(p.ident)
@@ -210,7 +213,7 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
             w.wl
           }
           writeMethodDoc(w, m, idJava.local)
-          val ret = marshal.returnType(m.ret)
+          val ret = methodReturnType(m)
           val params = m.params.map(p => {
             val nullityAnnotation = marshal.nullityAnnotation(p.ty).map(_ + " ").getOrElse("")
             nullityAnnotation + marshal.paramType(p.ty) + " " + idJava.local(p.ident)
@@ -233,7 +236,7 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
             }
             w.wl("public static native void nativeDestroy(long nativeRef);")
             for (m <- i.methods if !m.static) { // Static methods not in CppProxy
-              val ret = marshal.returnType(m.ret)
+              val ret = methodReturnType(m)
               val returnStmt = m.ret.fold("")(_ => "return ")
               val params = m.params.map(p => marshal.paramType(p.ty) + " " + idJava.local(p.ident)).mkString(", ")
               val args = m.params.map(p => idJava.local(p.ident)).mkString(", ")
@@ -407,6 +410,9 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
         }
         w.wl
 
+        if (isPackedRecord(params, r))
+          writePackedList(w, self, r)
+
         if (spec.javaImplementAndroidOsParcelable && r.derivingTypes.contains(DerivingType.AndroidParcelable))
           writeParcelable(w, self, r);
 
@@ -456,6 +462,61 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
     })
   }
 
+  // Bulk conversion used by the JNI marshaller for lists of all-primitive records: one long per
+  // field, in declaration order, with floats stored as their raw bits and enums as ordinals.
+  def writePackedList(w: IndentWriter, self: String, r: Record) {
+    val n = r.fields.size
+    def valuesName(f: Field) = idJava.local(f.ident.name + "_values")
+    w.w(s"/*package*/ static long[] packList(java.util.ArrayList<$self> list)").braced {
+      w.wl(s"long[] packed = new long[list.size() * $n];")
+      w.wl("int i = 0;")
+      w.w(s"for ($self value : list)").braced {
+        for (f <- r.fields) {
+          val field = "value." + idJava.field(f.ident)
+          val slot = f.ty.resolved.base match {
+            case p: MPrimitive => p.jName match {
+              case "boolean" => s"$field ? 1 : 0"
+              case "float" => s"Float.floatToRawIntBits($field)"
+              case "double" => s"Double.doubleToRawLongBits($field)"
+              case _ => field
+            }
+            case _ => s"$field.ordinal()"
+          }
+          w.wl(s"packed[i++] = $slot;")
+        }
+      }
+      w.wl("return packed;")
+    }
+    w.wl
+    w.w(s"/*package*/ static java.util.ArrayList<$self> unpackList(long[] packed)").braced {
+      for (f <- r.fields) f.ty.resolved.base match {
+        case p: MPrimitive =>
+        case _ => w.wl(s"${marshal.fieldType(f.ty)}[] ${valuesName(f)} = ${marshal.fieldType(f.ty)}.values();")
+      }
+      w.wl(s"java.util.ArrayList<$self> list = new java.util.ArrayList<$self>(packed.length / $n);")
+      w.w(s"for (int i = 0; i < packed.length; i += $n)").braced {
+        val fieldIndex = r.fields.zipWithIndex.toMap
+        writeAlignedCall(w, s"list.add(new $self(", r.fields, "));", f => {
+          val i = fieldIndex(f)
+          val slot = if (i == 0) "packed[i]" else s"packed[i + $i]"
+          f.ty.resolved.base match {
+            case p: MPrimitive => p.jName match {
+              case "boolean" => s"$slot != 0"
+              case "byte" | "short" | "int" => s"(${p.jName}) $slot"
+              case "float" => s"Float.intBitsToFloat((int) $slot)"
+              case "double" => s"Double.longBitsToDouble($slot)"
+              case _ => slot
+            }
+            case _ => s"${valuesName(f)}[(int) $slot]"
+          }
+        })
+        w.wl
+      }
+      w.wl("return list;")
+    }
+    w.wl
+  }
+
   def javaTypeParams(params: Seq[TypeParam]): String =
     if (params.isEmpty) "" else params.map(p => idJava.typeParam(p.ident)).mkString("<", ", ", ">")
 
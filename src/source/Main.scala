@@ -40,6 +40,7 @@ object Main {
     var cppNnType: Option[String] = None
     var cppNnCheckExpression: Option[String] = None
     var cppUseWideStrings: Boolean = false
+    var cppProtobufArena: Boolean = false
     var javaOutFolder: Option[File] = None
     var javaPackage: Option[String] = None
     var javaClassAccessModifier: JavaAccessModifier.Value = JavaAccessModifier.Public
@@ -61,6 +62,7 @@ object Main {
     var jniBaseLibIncludePrefix: String = ""
     var jniUseOnLoad: Boolean = false
     var jniFunctionPrologueFile: Option[String] = None
+    var jniZeroCopyBinaryResults: Boolean = false
     var cppHeaderOutFolderOptional: Option[File] = None
     var cppExt: String = "cpp"
     var cppHeaderExt: String = "hpp"
@@ -172,6 +174,8 @@ object Main {
         .text("The expression to use for building non-nullable pointers")
       opt[Boolean]( "cpp-use-wide-strings").valueName("<true/false>").foreach(x => cppUseWideStrings = x)
         .text("Use wide strings in C++ code (default: false)")
+      opt[Boolean]("cpp-protobuf-arena").valueName("<true/false>").foreach(x => cppProtobufArena = x)
+        .text("Parse protobuf messages coming from Java and JavaScript into a thread-local google::protobuf::Arena, unless their manifest sets cpp.arena (default: false)")
       note("")
       opt[File]("jni-out").valueName("<out-folder>").foreach(x => jniOutFolder = Some(x))
         .text("The folder for the JNI C++ output files (Generator disabled if unspecified).")
@@ -189,6 +193,8 @@ object Main {
         .text("If true, djinni will use RegisterNativeMethods to bind JNI functions, instead of the Java_* style symbol exports")
       opt[String]("jni-function-prologue-file").valueName("<header-file>").foreach(x => jniFunctionPrologueFile = Some(x))
         .text("User header file to include in generated JNI C++ classes.")
+      opt[Boolean]("jni-zero-copy-binary-results").valueName("<true/false>").foreach(x => jniZeroCopyBinaryResults = x)
+        .text("Return every binary result of a C++ method to Java as a java.nio.ByteBuffer, as if it was declared zero_copy (default: false)")
       note("")
       opt[File]("objc-out").valueName("<out-folder>").foreach(x => objcOutFolder = Some(x))
         .text("The output folder for Objective-C files (Generator disabled if unspecified).")
@@ -392,6 +398,7 @@ object Main {
       cppNnType,
       cppNnCheckExpression,
       cppUseWideStrings,
+      cppProtobufArena,
       jniOutFolder,
       jniHeaderOutFolder,
       jniIncludePrefix,
@@ -402,6 +409,7 @@ object Main {
       jniBaseLibIncludePrefix,
       jniUseOnLoad,
       jniFunctionPrologueFile,
+      jniZeroCopyBinaryResults,
       cppExt,
       cppHeaderExt,
       objcOutFolder,
@@ -48,4 +48,8 @@ abstract class Marshal(spec: Spec) {
     }
 
   protected def withCppNs(t: String) = withNs(Some(spec.cppNamespace), t)
+
+  // Protobuf messages that the JNI and Wasm marshallers parse into a thread-local arena instead of
+  // a plain value when they are passed straight to a C++ method (see support-lib/cpp/ProtobufArena.hpp).
+  def usesProtobufArena(p: ProtobufMessage): Boolean = p.cpp.arena.getOrElse(spec.cppProtobufArena)
 }
@@ -164,7 +164,8 @@ class ObjcppGenerator(spec: Spec) extends BaseObjcGenerator(spec) {
         w.wl("@end")
         w.wl
         w.wl(s"@implementation $objcSelf {")
-        w.wl(s"    ::djinni::CppProxyCache::Handle<::djinni::SharedPtr<$cppSelf>> _cppRefHandle;")
+        val handleType = if (i.uncached) "::djinni::UncachedCppRef" else "::djinni::CppProxyCache::Handle"
+        w.wl(s"    $handleType<::djinni::SharedPtr<$cppSelf>> _cppRefHandle;")
         w.wl("}")
         w.wl
         w.wl(s"- (id)initWithCpp:(const ::djinni::SharedPtr<$cppSelf>&)cppRef")
@@ -291,7 +292,8 @@ class ObjcppGenerator(spec: Spec) extends BaseObjcGenerator(spec) {
                 w.wl(s"return ${nnCheck(getProxyExpr)};")
               }
             }
-            val getProxyExpr = s"::djinni::get_objc_proxy<ObjcProxy>(objc)"
+            val getProxy = if (i.uncached) "new_objc_proxy" else "get_objc_proxy"
+            val getProxyExpr = s"::djinni::$getProxy<ObjcProxy>(objc)"
             w.wl(s"return ${nnCheck(getProxyExpr)};")
           } else {
             // Neither ObjC nor C++.  Unusable, but generate compilable code.
@@ -316,7 +318,8 @@ class ObjcppGenerator(spec: Spec) extends BaseObjcGenerator(spec) {
                 w.wl("return cppPtr->djinni_private_get_proxied_objc_object();")
               }
             }
-            w.wl(s"return ::djinni::get_cpp_proxy<$objcSelf>(cpp);")
+            val getProxy = if (i.uncached) "new_cpp_proxy" else "get_cpp_proxy"
+            w.wl(s"return ::djinni::$getProxy<$objcSelf>(cpp);")
           } else {
             // Neither ObjC nor C++.  Unusable, but generate compilable code.
             w.wl("DJINNI_UNIMPLEMENTED(@\"Interface not implementable in any language.\");")
@@ -91,6 +91,12 @@ class WasmGenerator(spec: Spec) extends Generator(spec) {
     }
   }
 
+  // For the parameters of C++ methods called from JavaScript; see JNIMarshal.toCppParam.
+  private def toCppParam(tm: MExpr, expr: String): String = tm.base match {
+    case MProtobuf(_,_,p) if cppMarshal.usesProtobufArena(p) => s"::djinni::ArenaProtobuf${helperTemplates(tm)}::toCpp($expr)"
+    case _ => s"${helperClass(tm)}::toCpp($expr)"
+  }
+
   def wasmType(tm: MExpr): String = tm.base match {
     case p: MPrimitive => p.cName
     case MString => if (spec.cppUseWideStrings) "std::wstring" else "std::string"
@@ -132,6 +138,7 @@ class WasmGenerator(spec: Spec) extends Generator(spec) {
   def references(m: Meta, exclude: String = ""): Seq[SymbolReference] = m match {
     case d: MDef => List(ImportRef(include(d.name)))
     case e: MExtern => List(ImportRef(resolveExtWasmHdr(e.wasm.header)))
+    case p: MProtobuf if cppMarshal.usesProtobufArena(p.body) => List(ImportRef(q(spec.wasmBaseLibIncludePrefix + "ProtobufArena_wasm.hpp")))
     case _ => List()
   }
 
@@ -291,6 +298,9 @@ class WasmGenerator(spec: Spec) extends Generator(spec) {
         w.wl(s"using CppOptType = ::djinni::SharedPtr<$cls>;")
         w.wl("using JsType = em::val;")
         w.wl(s"using Boxed = $helper;")
+        if (i.uncached) {
+          w.wl("static constexpr bool kUsesProxyCache = false;")
+        }
         w.wl
         // mashalling
         w.wl("static CppType toCpp(JsType j) { return _fromJs(j); }")
@@ -322,7 +332,8 @@ class WasmGenerator(spec: Spec) extends Generator(spec) {
         // js proxy
         if (i.ext.js) {
           w.w(s"struct JsProxy: ::djinni::JsProxyBase, $cls, ::djinni::InstanceTracker<JsProxy>").bracedSemi {
-            w.wl("JsProxy(const em::val& v) : JsProxyBase(v) {}")
+            val cached = if (i.uncached) ", false" else ""
+            w.wl(s"JsProxy(const em::val& v) : JsProxyBase(v$cached) {}")
             for (m <- i.methods) {
               if (!m.static) {
                 w.w(s"${cppMarshal.fqReturnType(m.ret)} ${idCpp.method(m.ident)}(")
@@ -370,7 +381,7 @@ class WasmGenerator(spec: Spec) extends Generator(spec) {
               if (!m.ret.isEmpty) w.w("auto r = ")
               if (m.static) w.w(s"$cls::") else w.w("self->")
               writeAlignedCall(w, s"""${idCpp.method(m.ident)}(""", m.params, ")", p => {
-                s"${helperClass(p.ty.resolved)}::toCpp(${stubParamName(p.ident)})"
+                toCppParam(p.ty.resolved, stubParamName(p.ident))
               })
               w.wl(";")
               m.ret.fold()(r => w.wl(s"return ${helperClass(r.resolved)}::fromCpp(${cppMarshal.maybeMove("r", r)});"))
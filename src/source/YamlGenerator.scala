@@ -128,7 +128,7 @@ class YamlGenerator(spec: Spec) extends Generator(spec) {
       }
     }
     td.body match {
-      case i: Interface => "interface" + ext(i.ext)
+      case i: Interface => "interface" + ext(i.ext) + (if (i.uncached) " uncached" else "")
       case r: Record => "record" + ext(r.ext) + deriving(r)
       case p: ProtobufMessage => "protobuf"
       case Enum(_, false) => "enum"
@@ -152,7 +152,7 @@ class YamlGenerator(spec: Spec) extends Generator(spec) {
       // "generic" -> false,
       "hash" -> QuotedString("%s.hash"))
     td.body match {
-      case Interface(_,_,_) =>
+      case Interface(_,_,_,_) =>
         if (spec.objcGenProtocol)
           map + ("protocol" -> spec.objcGenProtocol)
         else
@@ -83,9 +83,9 @@ object Record {
   }
 }
 
-case class Interface(ext: Ext, methods: Seq[Interface.Method], consts: Seq[Const]) extends TypeDef
+case class Interface(ext: Ext, methods: Seq[Interface.Method], consts: Seq[Const], uncached: Boolean) extends TypeDef
 object Interface {
-  case class Method(ident: Ident, params: Seq[Field], ret: Option[TypeRef], doc: Doc, static: Boolean, const: Boolean, lang: Ext)
+  case class Method(ident: Ident, params: Seq[Field], ret: Option[TypeRef], doc: Doc, static: Boolean, const: Boolean, lang: Ext, zeroCopy: Boolean = false)
 }
 
 case class Impl(interface: Option[TypeRef], nativeDelegate: NativeTypeRef, methods: Seq[Impl.Method]) extends TypeDef
@@ -114,7 +114,7 @@ case class Field(ident: Ident, ty: TypeRef, doc: Doc)
 
 case class ProtobufMessage(cpp: ProtobufMessage.Cpp, java: ProtobufMessage.Java, objc: Option[ProtobufMessage.Objc], ts: Option[ProtobufMessage.Ts]) extends TypeDef
 object ProtobufMessage {
-  case class Cpp(header: String, ns: String)
+  case class Cpp(header: String, ns: String, arena: Option[Boolean])
   case class Java(pkg: String, jniClass: Option[String], jniHeader: Option[String])
   case class Objc(header: String, prefix: String)
   case class Ts(module: String, ns: String)
@@ -57,6 +57,7 @@ package object generatorTools {
                    cppNnType: Option[String],
                    cppNnCheckExpression: Option[String],
                    cppUseWideStrings: Boolean,
+                   cppProtobufArena: Boolean,
                    jniOutFolder: Option[File],
                    jniHeaderOutFolder: Option[File],
                    jniIncludePrefix: String,
@@ -67,6 +68,7 @@ package object generatorTools {
                    jniBaseLibIncludePrefix: String,
                    jniUseOnLoad: Boolean,
                    jniFunctionPrologueFile: Option[String],
+                   jniZeroCopyBinaryResults: Boolean,
                    cppExt: String,
                    cppHeaderExt: String,
                    objcOutFolder: Option[File],
@@ -360,7 +362,7 @@ abstract class Generator(spec: Spec)
   protected def implToInterface(l: Impl): Interface = {
     val ext = Ext(false, true, false, false) // Only C++ implementations for now.
     val methods = l.methods.map(m => m.interface)
-    return Interface(ext, methods, Seq.empty[Const])
+    return Interface(ext, methods, Seq.empty[Const], false)
   }
 
   def wrapNamespace(w: IndentWriter, ns: String, f: IndentWriter => Unit) {
@@ -478,6 +480,20 @@ abstract class Generator(spec: Spec)
 
   def normalEnumOptions(e: Enum) = e.options.filter(_.specialFlag == None)
 
+  // Records made only of primitives and non-flags enums, which JNI marshals in bulk as one
+  // jlong per field (see List in support-lib/jni/Marshal.hpp).
+  def isPackedRecord(params: Seq[TypeParam], r: Record): Boolean =
+    params.isEmpty && !r.ext.java && r.fields.nonEmpty && r.fields.forall(f => f.ty.resolved.base match {
+      case p: MPrimitive => true
+      case MDef(_, _, DEnum, Enum(_, false)) => true
+      case _ => false
+    })
+
+  // Methods whose binary result JNI hands to Java as a java.nio.ByteBuffer, which can own the
+  // C++ vector's storage (see BinaryBuffer in support-lib/jni/DataRef_jni.hpp).
+  def isZeroCopyBinaryResult(m: Interface.Method): Boolean =
+    (m.zeroCopy || spec.jniZeroCopyBinaryResults) && m.ret.exists(_.resolved.base == MBinary)
+
   def writeEnumOptionNone(w: IndentWriter, e: Enum, ident: IdentConverter, delim: String = "=") {
     for (o <- e.options.find(_.specialFlag == Some(Enum.SpecialFlag.NoFlags))) {
       writeDoc(w, o.doc)
@@ -164,14 +164,15 @@ private object IdlParser extends RegexParsers {
     case doc~ident~Some("none") => Enum.Option(ident, doc, Some(Enum.SpecialFlag.NoFlags))
   }
 
-  def interfaceHeader = "interface" ~> extInterface
+  def interfaceHeader = "interface" ~> extInterface ~ uncached
   def interface: Parser[Interface] = interfaceHeader ~ bracesList(method | const) ^^ {
-    case ext~items => {
+    case ext~uncached~items => {
       val methods = items collect {case m: Method => m}
       val consts = items collect {case c: Const => c}
-      Interface(ext, methods, consts)
+      Interface(ext, methods, consts, uncached)
     }
   }
+  def uncached: Parser[Boolean] = opt("uncached") ^^ { _.isDefined }
 
   def impl: Parser[Impl] = pos("impl") ~ opt(typeRef <~ "with") ~ opt(nativeTypeRef) ~ (bracesList(implMethod) | success(Seq.empty)) ^^ {
     case (_, loc)~interfaceRef~nativeDelegate~methods => {
@@ -202,7 +203,7 @@ private object IdlParser extends RegexParsers {
   def externEnum: Parser[Enum] = enumHeader ^^ { case _ => Enum(List(), false) }
   def externFlags: Parser[Enum] = flagsHeader ^^ { case _ => Enum(List(), true) }
   def externRecord: Parser[Record] = recordHeader ~ opt(deriving) ^^ { case ext~deriving => Record(ext, List(), List(), deriving.getOrElse(Set[DerivingType]())) }
-  def externInterface: Parser[Interface] = interfaceHeader ^^ { case ext => Interface(ext, List(), List()) }
+  def externInterface: Parser[Interface] = interfaceHeader ^^ { case ext~uncached => Interface(ext, List(), List(), uncached) }
 
   def staticLabel: Parser[Boolean] = ("static ".r | "".r) ^^ {
     case "static " => true
@@ -212,11 +213,15 @@ private object IdlParser extends RegexParsers {
     case "const " => true
     case "" => false
   }
-  def method: Parser[Interface.Method] = doc ~ staticLabel ~ constLabel ~ ident ~ parens(repsepend(field, ",")) ~ opt(ret) ~ supportLang ^^ {
-    case doc~staticLabel~constLabel~ ident~params~ret~ext => {
+  def zeroCopyLabel: Parser[Boolean] = ("zero_copy ".r | "".r) ^^ {
+    case "zero_copy " => true
+    case "" => false
+  }
+  def method: Parser[Interface.Method] = doc ~ staticLabel ~ constLabel ~ zeroCopyLabel ~ ident ~ parens(repsepend(field, ",")) ~ opt(ret) ~ supportLang ^^ {
+    case doc~staticLabel~constLabel~zeroCopyLabel~ ident~params~ret~ext => {
       ret match {
-        case Some(r) if (r.expr.ident.name == "void") => Interface.Method(ident, params, None, doc, staticLabel, constLabel, ext)
-        case _ => Interface.Method(ident, params, ret, doc, staticLabel, constLabel, ext)
+        case Some(r) if (r.expr.ident.name == "void") => Interface.Method(ident, params, None, doc, staticLabel, constLabel, ext, zeroCopyLabel)
+        case _ => Interface.Method(ident, params, ret, doc, staticLabel, constLabel, ext, zeroCopyLabel)
       }
     }
   }
@@ -351,6 +356,7 @@ def parseProtobufManifest(origin: String, in: java.io.Reader): Either[Error, Seq
   // - `cpp` key must be present
   //   - `cpp.header` key must be present
   //   - `cpp.namespace` key must be present
+  //   - `cpp.arena` is optional
   // - `java` key must be present
   //   - `java.class` key must be present
   //   - `jni_class` is optional
@@ -373,7 +379,8 @@ def parseProtobufManifest(origin: String, in: java.io.Reader): Either[Error, Seq
     case None => return Left(Error(Loc(fileStack.top, 1, 1), "'java' properties not found"))
   }
   val proto = ProtobufMessage(
-    ProtobufMessage.Cpp(c("header"), c("namespace")),
+    ProtobufMessage.Cpp(c("header"), c("namespace"),
+      Option(doc.get("cpp").asInstanceOf[JMap[String, Any]].get("arena")).map(_.toString.toBoolean)),
     ProtobufMessage.Java(j("class"), j.get("jni_class"), j.get("jni_header")),
     // ObjC is optional, if it's not present, then ObjC will use C++ protos
     Option(doc.get("objc")) match {
@@ -312,6 +312,10 @@ private def resolveMethod(scope: Scope, m: Interface.Method, ext: Ext) {
     case Some(ty) => resolveRef(scope, ty)
     case _ =>
   }
+
+  // zero_copy only changes how a binary result is returned to Java
+  if (m.zeroCopy && !m.ret.exists(_.resolved.base == MBinary))
+    throw Error(m.ident.loc, "zero_copy is only allowed on methods returning binary").toException
 }
 
 private def resolveImpl(scope: Scope, l: Impl) {
@@ -0,0 +1,47 @@
+/**
+ * Copyright 2021 Snap, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utility>
+
+namespace djinni {
+
+// An executor decides which thread runs a task. Any type with a member
+//
+//     template <typename F> void execute(F&& task);
+//
+// can be passed to `Future::then(executor, handler)` and
+// `Future::resumeOn(executor)`. A task is a nullary, move-only callable, and
+// `execute()` must eventually call it exactly once: the future returned by
+// `then()` is only completed by running it. Executors are taken by reference
+// and must outlive every task handed to them.
+
+// Runs each task immediately on the calling thread. `then()` without an
+// executor behaves like this.
+struct InlineExecutor {
+    template <typename F>
+    void execute(F&& task) const {
+        std::forward<F>(task)();
+    }
+};
+
+inline InlineExecutor& inlineExecutor() {
+    static InlineExecutor executor;
+    return executor;
+}
+
+} // namespace djinni
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "Executor.hpp"
+
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -23,6 +25,14 @@
 #include <condition_variable>
 #include <mutex>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #ifdef __cpp_coroutines
 #if __has_include(<coroutine>)
@@ -42,6 +52,13 @@
 #endif
 #endif
 
+// Number of freed future/promise shared states of each size that every thread
+// keeps for reuse, so that chains of `then()` stop allocating once warmed up.
+// Zero (the default) allocates every shared state with std::make_shared.
+#ifndef DJINNI_FUTURE_SHARED_STATE_POOL_SIZE
+#define DJINNI_FUTURE_SHARED_STATE_POOL_SIZE 0
+#endif
+
 namespace djinni {
 
 template <typename T>
@@ -67,45 +84,273 @@ struct ValueHolder<void> {
 template<typename T>
 struct SharedState;
 
-// A simple type erased function container. It would be nice if std::function<>
-// supports move only lambdas.
+struct Combinators;
+
+// A type erased container for the move-only handler that `then()` attaches
+// to a shared state. It would be nice if std::function<> supported move only
+// lambdas. Handlers of up to `kInlineSize` bytes are constructed in place, so
+// attaching them does not allocate; that covers a `then()` continuation whose
+// lambda captures up to 48 bytes (40 with an executor), next to the promise
+// it completes. Bigger handlers are allocated on the heap.
 template <typename T>
-struct ValueHandlerBase {
-    virtual ~ValueHandlerBase() = default;
-    virtual void call(const std::shared_ptr<SharedState<T>>&) = 0;
-};
-template <typename T, typename F>
-class ValueHandler : public ValueHandlerBase<T> {
+class ValueHandlerBase {
 public:
-    ValueHandler(F&& f) : _f(std::forward<F>(f)) {}
-    ValueHandler(ValueHandler&& other) : _f(std::move(other._f)) {}
-    void call (const std::shared_ptr<SharedState<T>>& s) override {
-        _f(s);
+    static constexpr size_t kInlineSize = 64;
+
+    ValueHandlerBase() = default;
+    ValueHandlerBase(const ValueHandlerBase&) = delete;
+    ValueHandlerBase& operator=(const ValueHandlerBase&) = delete;
+    ~ValueHandlerBase() {
+        reset();
+    }
+
+    template <typename F>
+    void emplace(F&& f) {
+        using Handler = std::decay_t<F>;
+        assert(!_ops);
+        if constexpr (fitsInline<Handler>()) {
+            _target = new (&_storage) Handler(std::forward<F>(f));
+        } else {
+            _target = new Handler(std::forward<F>(f));
+        }
+        _ops = &kOps<Handler>;
+    }
+    void call(const std::shared_ptr<SharedState<T>>& s) {
+        _ops->call(_target, s);
     }
+    // Destroys the handler, releasing whatever it captured.
+    void reset() {
+        if (auto* ops = std::exchange(_ops, nullptr)) {
+            ops->destroy(_target);
+        }
+    }
+
 private:
-    std::decay_t<F> _f;
+    struct Ops {
+        void (*call)(void*, const std::shared_ptr<SharedState<T>>&);
+        void (*destroy)(void*);
+    };
+    template <typename Handler>
+    static constexpr bool fitsInline() {
+        return sizeof(Handler) <= kInlineSize && alignof(Handler) <= alignof(std::max_align_t);
+    }
+    template <typename Handler>
+    static constexpr Ops kOps = {
+        [] (void* f, const std::shared_ptr<SharedState<T>>& s) {
+            (*static_cast<Handler*>(f))(s);
+        },
+        [] (void* f) {
+            if constexpr (fitsInline<Handler>()) {
+                static_cast<Handler*>(f)->~Handler();
+            } else {
+                delete static_cast<Handler*>(f);
+            }
+        },
+    };
+
+    alignas(std::max_align_t) unsigned char _storage[kInlineSize];
+    void* _target = nullptr;
+    const Ops* _ops = nullptr;
 };
-template<typename T, typename FUNC>
-static auto createValueHandler(FUNC&& f) {
-    return std::make_unique<ValueHandler<T, FUNC>>(std::forward<FUNC>(f));
-}
 
-// The shared state object that links the promise and future objects
+// Mutex and condition variable for a thread that blocks on a future. Only
+// created when a thread actually has to wait.
+struct Waiter {
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+// The shared state object that links the promise and future objects.
+//
+// `state` moves through the values below with atomic transitions only:
+//
+//   Empty -> HasContinuation   then() stored `handler` before the result
+//   Empty -> Ready             the result arrived first
+//   HasContinuation -> Ready   the result arrived; the setter calls `handler`
+//   Ready -> Consumed          get() took the result
+//   HasContinuation -> Empty   whenAny() took back the handler of a loser
+//
+// The value or exception is written before the switch to Ready and only read
+// after it, and `handler` is written before the switch to HasContinuation and
+// only read by whoever switches it to Ready, so neither needs a lock.
 template<typename T>
 struct SharedState: ValueHolder<T> {
-    std::condition_variable cv;
-    std::mutex mutex;
+    enum State : uint8_t {Empty, HasContinuation, Ready, Consumed};
+
+    std::atomic<uint8_t> state{Empty};
+    std::atomic<Waiter*> waiter{nullptr};
     std::exception_ptr exception;
-    std::unique_ptr<ValueHandlerBase<T>> handler;
+    ValueHandlerBase<T> handler;
+
+    SharedState() = default;
+    SharedState(const SharedState&) = delete;
+    SharedState& operator=(const SharedState&) = delete;
+    ~SharedState() {
+        delete waiter.load(std::memory_order_relaxed);
+    }
 
     bool isReady() const {
-        return this->value.has_value() || exception != nullptr;
+        return state.load(std::memory_order_acquire) >= Ready;
+    }
+
+    // Called once the value or exception is set. Returns true if then() has
+    // stored a handler, which the caller must now run; otherwise wakes blocked
+    // threads.
+    bool complete() {
+        auto previous = state.exchange(Ready, std::memory_order_seq_cst);
+        assert(previous == Empty || previous == HasContinuation);
+        if (previous == HasContinuation) {
+            return true;
+        }
+        if (auto* w = waiter.load(std::memory_order_seq_cst)) {
+            // Taking the lock orders this notification after the waiter's
+            // last check of `state`.
+            { std::lock_guard lk(w->mutex); }
+            w->cv.notify_all();
+        }
+        return false;
+    }
+
+    // Publishes `handler` to the setter. Returns false if the result arrived
+    // first, in which case the caller has to run `handler` itself.
+    bool publishHandler() {
+        uint8_t expected = Empty;
+        return state.compare_exchange_strong(expected, HasContinuation, std::memory_order_acq_rel, std::memory_order_acquire);
+    }
+
+    // Withdraws a published handler that has not been called yet and destroys
+    // it. Returns false if the result arrived first, in which case the setter
+    // runs (or has run) the handler as usual.
+    bool detachHandler() {
+        uint8_t expected = HasContinuation;
+        if (!state.compare_exchange_strong(expected, Empty, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return false;
+        }
+        handler.reset();
+        return true;
+    }
+
+    void wait() {
+        if (isReady()) {
+            return;
+        }
+#if defined(__EMSCRIPTEN__)
+        assert(false); // in wasm we must not block and wait
+#else
+        auto* w = waiter.load(std::memory_order_acquire);
+        if (!w) {
+            auto* created = new Waiter;
+            if (waiter.compare_exchange_strong(w, created, std::memory_order_seq_cst)) {
+                w = created;
+            } else {
+                delete created;
+            }
+        }
+        std::unique_lock lk(w->mutex);
+        w->cv.wait(lk, [this] {return state.load(std::memory_order_seq_cst) >= Ready;});
+#endif
+    }
+
+    // Marks the result as taken by get(). A consumed state still counts as
+    // ready, as a promise may have handed out more than one future.
+    void consume() {
+        state.store(Consumed, std::memory_order_relaxed);
     }
 };
 
 template<typename T>
 using SharedStatePtr = std::shared_ptr<SharedState<T>>;
 
+// Keeps freed shared states of `Size` bytes in a per-thread free list of up to
+// DJINNI_FUTURE_SHARED_STATE_POOL_SIZE blocks, and hands them out again before
+// asking operator new. A state freed on another thread than the one that
+// allocated it goes to the freeing thread's list.
+template <size_t Size>
+class SharedStateBlockPool {
+public:
+    static void* allocate() {
+        auto& list = t_freeList;
+        if (auto* block = list.head) {
+            list.head = block->next;
+            --list.count;
+            return block;
+        }
+        return ::operator new(Size);
+    }
+    static void deallocate(void* p) {
+        auto& list = t_freeList;
+        if (!list.closed && list.count < DJINNI_FUTURE_SHARED_STATE_POOL_SIZE) {
+            static thread_local Drain drain;    // empties the list when the thread exits
+            (void)drain;
+            auto* block = static_cast<Block*>(p);
+            block->next = list.head;
+            list.head = block;
+            ++list.count;
+        } else {
+            ::operator delete(p);
+        }
+    }
+private:
+    struct Block {
+        Block* next;
+    };
+    // Trivially destructible, so that states freed by other thread_local
+    // destructors during thread exit can still check it.
+    struct FreeList {
+        Block* head;
+        size_t count;
+        bool closed;
+    };
+    struct Drain {
+        ~Drain() {
+            auto& list = t_freeList;
+            list.closed = true;
+            while (auto* block = list.head) {
+                list.head = block->next;
+                ::operator delete(block);
+            }
+            list.count = 0;
+        }
+    };
+    static_assert(Size >= sizeof(Block));
+    static inline thread_local FreeList t_freeList {nullptr, 0, false};
+};
+
+template <typename U>
+struct SharedStateAllocator {
+    static_assert(alignof(U) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    using value_type = U;
+    SharedStateAllocator() = default;
+    template <typename V>
+    SharedStateAllocator(const SharedStateAllocator<V>&) {}
+    U* allocate(size_t n) {
+        if (n == 1) {
+            return static_cast<U*>(SharedStateBlockPool<sizeof(U)>::allocate());
+        }
+        return static_cast<U*>(::operator new(n * sizeof(U)));
+    }
+    void deallocate(U* p, size_t n) {
+        if (n == 1) {
+            SharedStateBlockPool<sizeof(U)>::deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+    template <typename V>
+    bool operator==(const SharedStateAllocator<V>&) const {return true;}
+    template <typename V>
+    bool operator!=(const SharedStateAllocator<V>&) const {return false;}
+};
+
+template<typename T>
+SharedStatePtr<T> makeSharedState() {
+#if DJINNI_FUTURE_SHARED_STATE_POOL_SIZE > 0
+    return std::allocate_shared<SharedState<T>>(SharedStateAllocator<SharedState<T>>());
+#else
+    return std::make_shared<SharedState<T>>();
+#endif
+}
+
 // Common promise base class, shared by both `void` and `T` results.
 template <typename T>
 class PromiseBase {
@@ -156,9 +401,8 @@ public:
     }
 
 protected:
-    // `setValue()` or `setException()` can only be called once. After which the
-    // shared state is set to null and further calls to `setValue()` or
-    // `setException()` will fail.  If at the moment of calling `setValue()` or
+    // `setValue()` or `setException()` can only be called once. Further calls
+    // to `setValue()` or `setException()` will fail.  If at the moment of calling `setValue()` or
     // `setException()`, the `then()` method is already called on the future
     // object, then the handler routine specified by `then()` will immediately
     // be called in the current thread.
@@ -185,26 +429,20 @@ protected:
         });
     }
 private:
-    detail::SharedStatePtr<T> _sharedState = std::make_shared<SharedState<T>>();
-    detail::SharedStatePtr<T> _sharedStateReadOnly = _sharedState; // allow calling getFuture() after setValue()
+    // Kept after `setValue()`, to allow calling getFuture() afterwards.
+    detail::SharedStatePtr<T> _sharedState = detail::makeSharedState<T>();
 
     template <typename UpdateFunc>
     void updateAndCallResultHandler(UpdateFunc&& updater) {
-        detail::SharedStatePtr<T> sharedState;
-        sharedState = std::atomic_exchange(&_sharedState, sharedState);
-        assert(sharedState);    // a second call will trigger assertion
-        std::unique_ptr<ValueHandlerBase<T>> handler;
-        {
-            std::lock_guard lk(sharedState->mutex);
-            updater(sharedState);
-            handler = std::move(sharedState->handler);
-        }
-        if (handler) {
+        // A local reference keeps the state, and the handler stored in it,
+        // alive even if the handler destroys this promise.
+        auto sharedState = _sharedState;
+        assert(sharedState && !sharedState->isReady());    // a second call will trigger assertion
+        updater(sharedState);
+        if (sharedState->complete()) {
             // handler already assigned, call it inline
-            handler->call(sharedState);
-        } else {
-            // otherwise unblock potential waiters
-            sharedState->cv.notify_all();
+            sharedState->handler.call(sharedState);
+            sharedState->handler.reset();
         }
     }
 };
@@ -250,8 +488,9 @@ template<typename T>
 class Future {
     template<typename U>
     friend class detail::PromiseBase;
+    friend struct detail::Combinators;
     // not user constructable
-    Future(detail::SharedStatePtr<T> sharedState) : _sharedState(sharedState) {}
+    Future(detail::SharedStatePtr<T> sharedState) : _sharedState(std::move(sharedState)) {}
 public:
     // moveable
     Future(Future&& other) noexcept = default;
@@ -261,38 +500,25 @@ public:
     Future& operator= (const Future& other) = delete;
     // Future becomes invalid after `then()` is called on it
     bool isValid() const {
-        return std::atomic_load(&_sharedState) != nullptr;
+        return _sharedState != nullptr;
     }
     // returns true if the result can be `get()` without blocking
     bool isReady() const {
-        auto sharedState = std::atomic_load(&_sharedState);
-        assert(sharedState);    // call on invalid future will trigger assertion
-        std::unique_lock lk(sharedState->mutex);
-        return sharedState->isReady();
+        assert(_sharedState);    // call on invalid future will trigger assertion
+        return _sharedState->isReady();
     }
     // wait until future becomes `isReady()`
     void wait() const {
-        auto sharedState = std::atomic_load(&_sharedState);
-        assert(sharedState);    // call on invalid future will trigger assertion
-        std::unique_lock lk(sharedState->mutex);
-#if defined(__EMSCRIPTEN__)
-        assert(sharedState->isReady()); // in wasm we must not block and wait
-#else
-        sharedState->cv.wait(lk, [state = sharedState] {return state->isReady();});
-#endif
+        assert(_sharedState);    // call on invalid future will trigger assertion
+        _sharedState->wait();
     }
     // wait until future becomes `isReady()` and return the result. This can
     // only be called once.
     auto get() {
-        detail::SharedStatePtr<T> sharedState;
-        sharedState = std::atomic_exchange(&_sharedState, sharedState);
+        auto sharedState = std::move(_sharedState);
         assert(sharedState);    // call on invalid future will trigger assertion
-        std::unique_lock lk(sharedState->mutex);
-#if defined(__EMSCRIPTEN__)
-        assert(sharedState->isReady()); // in wasm we must not block and wait
-#else
-        sharedState->cv.wait(lk, [state = sharedState] {return state->isReady();});
-#endif
+        sharedState->wait();
+        sharedState->consume();
         if (!sharedState->exception) {
             return sharedState->getValueUnsafe();
         } else {
@@ -306,38 +532,63 @@ public:
     template<typename FUNC>
     auto then(FUNC&& handler) {
         using HandlerReturnType = std::invoke_result_t<FUNC, Future<T>>;
-        detail::SharedStatePtr<T> sharedState;
-        sharedState = std::atomic_exchange(&_sharedState, sharedState);
-        assert(sharedState);    // a second call will trigger assertion
-        auto nextPromise = std::make_unique<Promise<HandlerReturnType>>();
-        auto nextFuture = nextPromise->getFuture();
-        auto continuation = [handler = std::forward<FUNC>(handler), nextPromise = std::move(nextPromise)] (detail::SharedStatePtr<T> x) mutable {
-            try {
-                if constexpr(std::is_void_v<HandlerReturnType>) {
-                    handler(Future<T>(x));
-                    nextPromise->setValue();
-                } else {
-                    nextPromise->setValue(handler(Future<T>(x)));
-                }
-            } catch (const std::exception& e) {
-                nextPromise->setException(std::current_exception());
-            }
-        };
-        detail::SharedStatePtr<T> sharedStateForReadyFuture;
-        {
-            std::unique_lock lk(sharedState->mutex);
-            if (sharedState->isReady()) {
-                // result already available
-                sharedStateForReadyFuture = std::move(sharedState);
+        Promise<HandlerReturnType> nextPromise;
+        auto nextFuture = nextPromise.getFuture();
+        attachContinuation([handler = std::forward<FUNC>(handler), nextPromise = std::move(nextPromise)] (detail::SharedStatePtr<T> x) mutable {
+            runHandler(handler, nextPromise, std::move(x));
+        });
+        return nextFuture;
+    }
+    // Same as `then(handler)`, except that the handler routine is passed to
+    // `executor.execute()` instead of being called on the thread that completes
+    // this future (or calls `then()`). See Executor.hpp.
+    template<typename EXECUTOR, typename FUNC>
+    auto then(EXECUTOR& executor, FUNC&& handler) {
+        using HandlerReturnType = std::invoke_result_t<FUNC, Future<T>>;
+        Promise<HandlerReturnType> nextPromise;
+        auto nextFuture = nextPromise.getFuture();
+        attachContinuation([&executor, handler = std::forward<FUNC>(handler), nextPromise = std::move(nextPromise)] (detail::SharedStatePtr<T> x) mutable {
+            executor.execute([handler = std::move(handler), nextPromise = std::move(nextPromise), x = std::move(x)] () mutable {
+                runHandler(handler, nextPromise, std::move(x));
+            });
+        });
+        return nextFuture;
+    }
+
+private:
+    template<typename FUNC, typename R>
+    static void runHandler(FUNC& handler, Promise<R>& nextPromise, detail::SharedStatePtr<T> x) {
+        try {
+            if constexpr(std::is_void_v<R>) {
+                handler(Future<T>(std::move(x)));
+                nextPromise.setValue();
             } else {
-                // result not yet available
-                sharedState->handler = detail::createValueHandler<T>(std::move(continuation));
+                nextPromise.setValue(handler(Future<T>(std::move(x))));
             }
+        } catch (const std::exception& e) {
+            nextPromise.setException(std::current_exception());
         }
-        if (sharedStateForReadyFuture) {
-            continuation(sharedStateForReadyFuture);
+    }
+
+    // Calls `continuation` with the shared state once the result is
+    // available: right away if it already is, otherwise from the thread that
+    // sets it.
+    template<typename CONTINUATION>
+    void attachContinuation(CONTINUATION&& continuation) {
+        auto sharedState = std::move(_sharedState);
+        assert(sharedState);    // a second call will trigger assertion
+        if (sharedState->isReady()) {
+            // result already available
+            continuation(std::move(sharedState));
+        } else {
+            // result not yet available
+            sharedState->handler.emplace(std::forward<CONTINUATION>(continuation));
+            if (!sharedState->publishHandler()) {
+                // the result arrived while the handler was being stored
+                sharedState->handler.call(sharedState);
+                sharedState->handler.reset();
+            }
         }
-        return nextFuture;
     }
 
 private:
@@ -351,18 +602,47 @@ public:
     auto await_resume() {
         // after resuming from await, the future should be in an invalid state
         // (_sharedState is null)
-        detail::SharedStatePtr<T> sharedState;
-        sharedState = std::atomic_exchange(&_sharedState, sharedState);
-        return Future<T>(sharedState).get();
+        return Future<T>(std::move(_sharedState)).get();
     }
     bool await_suspend(detail::CoroutineHandle<> h) {
         this->then([h, this] (Future<T> x) mutable {
-            std::atomic_store(&_sharedState, x._sharedState);
+            _sharedState = std::move(x._sharedState);
             h();
         });
         return true;
     }
 
+    // Awaiter that resumes the awaiting coroutine through `executor` rather
+    // than on the thread that completes the future:
+    //   auto value = co_await std::move(future).resumeOn(pool);
+    // The coroutine is handed to the executor even if the future is already
+    // ready.
+    template<typename EXECUTOR>
+    class ExecutorAwaiter {
+    public:
+        ExecutorAwaiter(Future<T>&& future, EXECUTOR& executor) : _future(std::move(future)), _executor(executor) {}
+        bool await_ready() {
+            return false;
+        }
+        auto await_resume() {
+            return _future.get();
+        }
+        bool await_suspend(detail::CoroutineHandle<> h) {
+            _future.then(_executor, [h, this] (Future<T> x) mutable {
+                _future = std::move(x);
+                h();
+            });
+            return true;
+        }
+    private:
+        Future<T> _future;
+        EXECUTOR& _executor;
+    };
+    template<typename EXECUTOR>
+    ExecutorAwaiter<EXECUTOR> resumeOn(EXECUTOR& executor) && {
+        return ExecutorAwaiter<EXECUTOR>(std::move(*this), executor);
+    }
+
     struct PromiseTypeBase {
         Promise<T> _promise;
 
@@ -395,9 +675,34 @@ public:
 
 template <typename T>
 Future<T> detail::PromiseBase<T>::getFuture() {
-    return Future<T>(_sharedStateReadOnly);
+    return Future<T>(_sharedState);
 }
 
+// Passes `func` to `executor.execute()` and returns a future of its result
+// (or of the exception it throws). See Executor.hpp and ThreadPool.hpp.
+//   auto size = djinni::async(djinni::defaultThreadPool(), [] { return computeSize(); });
+template <typename EXECUTOR, typename FUNC>
+auto async(EXECUTOR& executor, FUNC&& func) {
+    using ReturnType = std::invoke_result_t<FUNC>;
+    Promise<ReturnType> promise;
+    auto future = promise.getFuture();
+    executor.execute([promise = std::move(promise), func = std::forward<FUNC>(func)] () mutable {
+        try {
+            if constexpr(std::is_void_v<ReturnType>) {
+                func();
+                promise.setValue();
+            } else {
+                promise.setValue(func());
+            }
+        } catch (const std::exception& e) {
+            promise.setException(std::current_exception());
+        }
+    });
+    return future;
+}
+
+// Completes once `c` of `futures` have completed, without their results.
+// whenAll() and whenAny() below also deliver the results.
 template <typename U>
 Future<void> combine(U&& futures, size_t c) {
     struct Context {
@@ -412,7 +717,7 @@ Future<void> combine(U&& futures, size_t c) {
         return future;
     }
     for (auto& f: futures) {
-        f.then([context] (auto f) {
+        f.then([context] (auto) {
             if (--(context->counter) == 0) {
                 context->promise.setValue();
             }
@@ -421,14 +726,274 @@ Future<void> combine(U&& futures, size_t c) {
     return future;
 }
 
+namespace detail {
+
+template <typename F>
+struct FutureTraits;
+template <typename T>
+struct FutureTraits<Future<T>> {
+    using ValueType = T;
+};
+
+// State shared by all the inputs of one whenAll() over a container: a single
+// allocation, holding the slots that the inputs' results are written into.
+// When `T` is default constructible the slots are the result vector itself,
+// handed over without copying. vector<bool> packs its elements into shared
+// words, which can't be written from several threads, so bools go through
+// optional slots like other types.
+template <typename T>
+struct WhenAllContext {
+    static constexpr bool kDirectSlots = std::is_default_constructible_v<T> && !std::is_same_v<T, bool>;
+    using Slot = std::conditional_t<kDirectSlots, T, std::optional<T>>;
+
+    std::vector<Slot> slots;
+    std::atomic<size_t> remaining;
+    std::atomic<bool> failed{false};
+    Promise<std::vector<T>> promise;
+
+    explicit WhenAllContext(size_t n) : slots(n), remaining(n) {}
+
+    void setValue(size_t index, T&& value) {
+        slots[index] = std::move(value);
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            if constexpr (kDirectSlots) {
+                promise.setValue(std::move(slots));
+            } else {
+                std::vector<T> results;
+                results.reserve(slots.size());
+                for (auto& slot: slots) {
+                    results.push_back(std::move(*slot));
+                }
+                promise.setValue(std::move(results));
+            }
+        }
+    }
+    // A failed input doesn't count down `remaining`, so the first failure is
+    // the only way the result completes from then on.
+    void setException(std::exception_ptr ex) {
+        if (!failed.exchange(true, std::memory_order_acq_rel)) {
+            promise.setException(ex);
+        }
+    }
+};
+template <>
+struct WhenAllContext<void> {
+    std::atomic<size_t> remaining;
+    std::atomic<bool> failed{false};
+    Promise<void> promise;
+
+    explicit WhenAllContext(size_t n) : remaining(n) {}
+
+    void setValue(size_t) {
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            promise.setValue();
+        }
+    }
+    void setException(std::exception_ptr ex) {
+        if (!failed.exchange(true, std::memory_order_acq_rel)) {
+            promise.setException(ex);
+        }
+    }
+};
+
+template <typename... Ts>
+struct WhenAllTupleContext {
+    std::tuple<std::optional<Ts>...> slots;
+    std::atomic<size_t> remaining{sizeof...(Ts)};
+    std::atomic<bool> failed{false};
+    Promise<std::tuple<Ts...>> promise;
+
+    template <size_t I, typename V>
+    void setValue(V&& value) {
+        std::get<I>(slots) = std::forward<V>(value);
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            promise.setValue(std::apply([] (auto&... slot) {
+                return std::tuple<Ts...>(std::move(*slot)...);
+            }, slots));
+        }
+    }
+    void setException(std::exception_ptr ex) {
+        if (!failed.exchange(true, std::memory_order_acq_rel)) {
+            promise.setException(ex);
+        }
+    }
+};
+
+// State shared by all the inputs of one whenAny(). The first input to
+// complete wins and withdraws the handlers still attached to the others, so
+// they no longer hold on to this context. That has to wait until all inputs
+// are attached, so whichever of the winner and the attaching thread comes
+// second does it.
+template <typename T>
+struct WhenAnyContext {
+    using ResultType = std::conditional_t<std::is_void_v<T>, size_t, std::pair<size_t, T>>;
+    enum : uint8_t {Won = 1, Attached = 2};
+
+    std::atomic<uint8_t> flags{0};
+    std::vector<std::weak_ptr<SharedState<T>>> inputs;
+    Promise<ResultType> promise;
+
+    bool decided() const {
+        return flags.load(std::memory_order_acquire) & Won;
+    }
+    void complete(size_t index, Future<T>&& winner) {
+        auto previous = flags.fetch_or(Won, std::memory_order_acq_rel);
+        if (previous & Won) {
+            return;
+        }
+        try {
+            if constexpr (std::is_void_v<T>) {
+                winner.get();
+                promise.setValue(index);
+            } else {
+                promise.setValue(ResultType(index, winner.get()));
+            }
+        } catch (const std::exception& e) {
+            promise.setException(std::current_exception());
+        }
+        if (previous & Attached) {
+            detachLosers();
+        }
+    }
+    void allAttached() {
+        if (flags.fetch_or(Attached, std::memory_order_acq_rel) & Won) {
+            detachLosers();
+        }
+    }
+    void detachLosers() {
+        for (auto& input: inputs) {
+            if (auto sharedState = input.lock()) {
+                sharedState->detachHandler();
+            }
+        }
+        inputs.clear();
+    }
+};
+
+// whenAll() and whenAny() attach their handlers straight to the shared states
+// of their inputs, rather than through then(), so that an input costs no
+// allocation of its own.
+struct Combinators {
+    template <typename T, typename CONTINUATION>
+    static void attach(Future<T>& f, CONTINUATION&& continuation) {
+        f.attachContinuation(std::forward<CONTINUATION>(continuation));
+    }
+    template <typename T>
+    static const SharedStatePtr<T>& sharedState(const Future<T>& f) {
+        return f._sharedState;
+    }
+    template <typename T>
+    static Future<T> makeFuture(SharedStatePtr<T> sharedState) {
+        return Future<T>(std::move(sharedState));
+    }
+
+    template <typename T, typename CONTEXT>
+    static void attachWhenAll(Future<T>& f, const std::shared_ptr<CONTEXT>& context, size_t index) {
+        attach(f, [context, index] (SharedStatePtr<T> x) {
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    makeFuture(std::move(x)).get();
+                    context->setValue(index);
+                } else {
+                    context->setValue(index, makeFuture(std::move(x)).get());
+                }
+            } catch (const std::exception& e) {
+                context->setException(std::current_exception());
+            }
+        });
+    }
+
+    template <typename U>
+    static auto whenAll(U& futures) {
+        using T = typename FutureTraits<std::decay_t<decltype(*std::begin(futures))>>::ValueType;
+        const size_t count = std::size(futures);
+        auto context = std::make_shared<WhenAllContext<T>>(count);
+        auto future = context->promise.getFuture();
+        if (count == 0) {
+            if constexpr (std::is_void_v<T>) {
+                context->promise.setValue();
+            } else {
+                context->promise.setValue({});
+            }
+            return future;
+        }
+        size_t index = 0;
+        for (auto& f: futures) {
+            attachWhenAll(f, context, index++);
+        }
+        return future;
+    }
+
+    template <typename... Ts, size_t... I>
+    static auto whenAllTuple(std::index_sequence<I...>, Future<Ts>&... futures) {
+        static_assert((!std::is_void_v<Ts> && ...), "whenAll() of several futures needs non-void results");
+        auto context = std::make_shared<WhenAllTupleContext<Ts...>>();
+        auto future = context->promise.getFuture();
+        (attach(futures, [context] (SharedStatePtr<Ts> x) {
+            try {
+                context->template setValue<I>(makeFuture(std::move(x)).get());
+            } catch (const std::exception& e) {
+                context->setException(std::current_exception());
+            }
+        }), ...);
+        return future;
+    }
+
+    template <typename U>
+    static auto whenAny(U& futures) {
+        using T = typename FutureTraits<std::decay_t<decltype(*std::begin(futures))>>::ValueType;
+        using ResultType = typename WhenAnyContext<T>::ResultType;
+        const size_t count = std::size(futures);
+        if (count == 0) {
+            return Promise<ResultType>::reject(std::make_exception_ptr(std::invalid_argument("whenAny() called without futures")));
+        }
+        auto context = std::make_shared<WhenAnyContext<T>>();
+        auto future = context->promise.getFuture();
+        context->inputs.reserve(count);
+        size_t index = 0;
+        for (auto& f: futures) {
+            if (context->decided()) {
+                // An earlier input already won; drop the rest unattached.
+                Future<T> loser = std::move(f);
+                continue;
+            }
+            context->inputs.push_back(sharedState(f));
+            attach(f, [context, index] (SharedStatePtr<T> x) {
+                context->complete(index, makeFuture(std::move(x)));
+            });
+            ++index;
+        }
+        context->allAttached();
+        return future;
+    }
+};
+
+} // namespace detail
+
+// Completes with the results of all `futures`, in their order, once every one
+// of them has completed: a `Future<std::vector<T>>`, or a `Future<void>` for
+// void futures. If any of them fails, completes with the first exception
+// without waiting for the others. All futures become invalid.
 template <typename U>
-Future<void> whenAll(U&& futures) {
-    return combine(std::forward<U>(futures), futures.size());
+auto whenAll(U&& futures) {
+    return detail::Combinators::whenAll(futures);
+}
+
+// Completes with a `std::tuple` of the results of two or more futures of
+// possibly different (non-void) types, like whenAll() above.
+template <typename F0, typename F1, typename... Fs>
+auto whenAll(F0&& f0, F1&& f1, Fs&&... fs) {
+    return detail::Combinators::whenAllTuple(std::index_sequence_for<F0, F1, Fs...>(), f0, f1, fs...);
 }
 
+// Completes as soon as the first of `futures` completes, with its position and
+// result as a `Future<std::pair<size_t, T>>` (a `Future<size_t>` for void
+// futures), or with its exception. The handlers attached to the other futures
+// are removed again. All futures become invalid. Fails with
+// std::invalid_argument if `futures` is empty.
 template <typename U>
-Future<void> whenAny(U&& futures) {
-    return combine(std::forward<U>(futures), 1);
+auto whenAny(U&& futures) {
+    return detail::Combinators::whenAny(futures);
 }
 
 } // namespace djinni
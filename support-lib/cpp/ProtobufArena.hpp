@@ -0,0 +1,121 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#pragma once
+
+#include <google/protobuf/arena.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace djinni {
+
+/*
+ * The arena that ArenaProtobuf marshallers parse into, one per thread. Every message parsed on
+ * the thread while another is still alive shares it, and it's reset once the last of them is
+ * released. The arena's first block is native memory owned here; whenever a round needed more
+ * than that, the block is regrown to match (up to kMaxInitialBlock). So a steady stream of calls
+ * settles at no heap allocations at all, for the message or any of its nested fields.
+ */
+class ProtobufArenaScope {
+public:
+    static constexpr size_t kMinInitialBlock = 4 * 1024;
+    static constexpr size_t kMaxInitialBlock = 1024 * 1024;
+
+    static ProtobufArenaScope& forThread() {
+        thread_local ProtobufArenaScope scope;
+        return scope;
+    }
+
+    google::protobuf::Arena& acquire() {
+        if (!_arena) {
+            reset(kMinInitialBlock);
+        }
+        ++_depth;
+        return *_arena;
+    }
+
+    void release() {
+        if (--_depth > 0) {
+            return;
+        }
+        const auto used = static_cast<size_t>(_arena->SpaceAllocated());
+        if (used > _blockSize && _blockSize < kMaxInitialBlock) {
+            reset(std::min(kMaxInitialBlock, std::max(used, 2 * _blockSize)));
+        } else {
+            _arena->Reset();
+        }
+    }
+
+    // Size of the block the arena starts from; the allocation-free high-water mark so far
+    size_t initialBlockSize() const { return _blockSize; }
+
+private:
+    ProtobufArenaScope() = default;
+
+    void reset(size_t blockSize) {
+        _arena.reset();
+        _block.reset(new char[blockSize]);
+        _blockSize = blockSize;
+        google::protobuf::ArenaOptions options;
+        options.initial_block = _block.get();
+        options.initial_block_size = blockSize;
+        _arena = std::make_unique<google::protobuf::Arena>(options);
+    }
+
+    // Declared before _arena, which allocates from it and so must go first
+    std::unique_ptr<char[]> _block;
+    size_t _blockSize = 0;
+    std::unique_ptr<google::protobuf::Arena> _arena;
+    int _depth = 0;
+};
+
+/*
+ * A message allocated on the thread's ProtobufArenaScope, as returned by ArenaProtobuf::toCpp().
+ * It converts to `const CppProto&`, so it can be passed straight to a C++ method taking the
+ * message by reference. It must be destroyed on the thread that created it, and references to it
+ * must not outlive it.
+ */
+template<typename CppProto>
+class ArenaMessage {
+public:
+    ArenaMessage()
+        : _scope(&ProtobufArenaScope::forThread())
+        , _message(google::protobuf::Arena::CreateMessage<CppProto>(&_scope->acquire())) {}
+    ArenaMessage(ArenaMessage&& other) noexcept
+        : _scope(std::exchange(other._scope, nullptr))
+        , _message(other._message) {}
+    ArenaMessage(const ArenaMessage&) = delete;
+    ArenaMessage& operator=(const ArenaMessage&) = delete;
+    ArenaMessage& operator=(ArenaMessage&&) = delete;
+    ~ArenaMessage() {
+        if (_scope) {
+            _scope->release();
+        }
+    }
+
+    CppProto& get() { return *_message; }
+    const CppProto& get() const { return *_message; }
+    operator const CppProto&() const { return *_message; }
+
+private:
+    ProtobufArenaScope* _scope;
+    CppProto* _message;
+};
+
+} // namespace djinni
@@ -0,0 +1,367 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace djinni {
+
+namespace {
+
+using detail::PoolTask;
+
+// The work-stealing deque of Chase and Lev, with the memory orderings of
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al.,
+// PPoPP 2013). Only the owning worker calls push() and pop(); any thread may
+// call steal().
+class WorkStealingDeque {
+public:
+    WorkStealingDeque() {
+        _buffers.push_back(std::make_unique<Buffer>(kInitialCapacity));
+        _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque() {
+        // The pool only joins its workers once every task has run, so this
+        // should find nothing.
+        while (auto* task = pop()) {
+            delete task;
+        }
+    }
+
+    void push(PoolTask* task) {
+        auto b = _bottom.load(std::memory_order_relaxed);
+        auto t = _top.load(std::memory_order_acquire);
+        auto* buffer = _buffer.load(std::memory_order_relaxed);
+        if (b - t > buffer->capacity - 1) {
+            buffer = grow(buffer, t, b);
+        }
+        buffer->put(b, task);
+        _bottom.store(b + 1, std::memory_order_release);
+    }
+
+    PoolTask* pop() {
+        auto b = _bottom.load(std::memory_order_relaxed) - 1;
+        auto* buffer = _buffer.load(std::memory_order_relaxed);
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto t = _top.load(std::memory_order_relaxed);
+        if (t > b) {
+            // empty
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        auto* task = buffer->get(b);
+        if (t == b) {
+            // last task: race the thieves for it
+            if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                task = nullptr;
+            }
+            _bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    // Returns nullptr if the deque is empty or another thread won the race
+    // for its top task.
+    PoolTask* steal() {
+        auto t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto b = _bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        auto* task = _buffer.load(std::memory_order_acquire)->get(t);
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return task;
+    }
+
+    bool empty() const {
+        return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int64_t kInitialCapacity = 256;
+
+    struct Buffer {
+        const int64_t capacity;
+        std::unique_ptr<std::atomic<PoolTask*>[]> slots;
+
+        explicit Buffer(int64_t c) : capacity(c), slots(new std::atomic<PoolTask*>[c]) {}
+        PoolTask* get(int64_t i) const {
+            return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+        void put(int64_t i, PoolTask* task) {
+            slots[i & (capacity - 1)].store(task, std::memory_order_relaxed);
+        }
+    };
+
+    // Thieves may still read from the old buffer, so it is kept until the
+    // deque is destroyed. Capacities double, so this costs at most as much
+    // memory again as the largest buffer.
+    Buffer* grow(Buffer* old, int64_t t, int64_t b) {
+        _buffers.push_back(std::make_unique<Buffer>(old->capacity * 2));
+        auto* buffer = _buffers.back().get();
+        for (auto i = t; i < b; ++i) {
+            buffer->put(i, old->get(i));
+        }
+        _buffer.store(buffer, std::memory_order_release);
+        return buffer;
+    }
+
+    alignas(64) std::atomic<int64_t> _top{0};
+    alignas(64) std::atomic<int64_t> _bottom{0};
+    std::atomic<Buffer*> _buffer;
+    std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+std::mutex& workerInitializerMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::function<void()>& workerInitializer() {
+    static std::function<void()> initializer;
+    return initializer;
+}
+
+} // namespace
+
+struct ThreadPool::Impl {
+    static constexpr size_t kSpinRounds = 64;
+
+    struct Worker {
+        WorkStealingDeque deque;
+        std::thread thread;
+    };
+
+    const Options options;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Guards the global queue and the sleep/wake handshake.
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::deque<PoolTask*> globalQueue;
+    bool stopping = false;
+
+    std::atomic<size_t> sleepers{0};
+    // Tasks submitted and not yet finished.
+    std::atomic<size_t> pending{0};
+
+    // The pool and worker index of the calling thread, if it is a worker.
+    static thread_local Impl* t_pool;
+    static thread_local size_t t_index;
+
+    explicit Impl(Options o) : options(o) {
+        size_t count = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+        workers.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            workers.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < count; ++i) {
+            workers[i]->thread = std::thread([this, i] { run(i); });
+        }
+    }
+
+    ~Impl() {
+        assert(t_pool != this);    // destroying a pool from its own worker would deadlock
+        {
+            std::lock_guard lk(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (auto& w: workers) {
+            w->thread.join();
+        }
+    }
+
+    void submit(PoolTask* task) {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        if (t_pool == this) {
+            workers[t_index]->deque.push(task);
+            // Pairs with the fence in sleep(): either a sleeper sees the task,
+            // or this sees the sleeper.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers.load(std::memory_order_relaxed) > 0) {
+                { std::lock_guard lk(mutex); }
+                wakeUp.notify_one();
+            }
+        } else {
+            bool wake;
+            {
+                std::lock_guard lk(mutex);
+                globalQueue.push_back(task);
+                wake = sleepers.load(std::memory_order_relaxed) > 0;
+            }
+            if (wake) {
+                wakeUp.notify_one();
+            }
+        }
+    }
+
+    PoolTask* findTask(size_t index) {
+        if (auto* task = workers[index]->deque.pop()) {
+            return task;
+        }
+        {
+            std::lock_guard lk(mutex);
+            if (!globalQueue.empty()) {
+                auto* task = globalQueue.front();
+                globalQueue.pop_front();
+                return task;
+            }
+        }
+        // Start at a different victim on every worker so that thieves spread
+        // out.
+        const size_t count = workers.size();
+        for (size_t i = 1; i < count; ++i) {
+            if (auto* task = workers[(index + i) % count]->deque.steal()) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    bool hasQueuedTasks() const {
+        if (!globalQueue.empty()) {
+            return true;
+        }
+        for (const auto& w: workers) {
+            if (!w->deque.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns false once the pool is stopping and all tasks have run.
+    bool sleep() {
+        std::unique_lock lk(mutex);
+        sleepers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool keepRunning = true;
+        if (!hasQueuedTasks()) {
+            if (stopping && pending.load(std::memory_order_acquire) == 0) {
+                keepRunning = false;
+            } else {
+                wakeUp.wait(lk);
+            }
+        }
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        return keepRunning;
+    }
+
+    void run(size_t index) {
+        pinCurrentThread(index);
+        std::function<void()> initializer;
+        {
+            std::lock_guard lk(workerInitializerMutex());
+            initializer = workerInitializer();
+        }
+        if (initializer) {
+            initializer();
+        }
+        t_pool = this;
+        t_index = index;
+        size_t idleRounds = 0;
+        for (;;) {
+            if (auto* task = findTask(index)) {
+                idleRounds = 0;
+                task->run();
+                delete task;
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    // Let sleeping workers of a stopping pool exit.
+                    bool wake;
+                    {
+                        std::lock_guard lk(mutex);
+                        wake = stopping;
+                    }
+                    if (wake) {
+                        wakeUp.notify_all();
+                    }
+                }
+            } else if (++idleRounds < kSpinRounds) {
+                // Work often shows up again within microseconds, as when
+                // other workers fan out. Look again before paying for a sleep
+                // and a wake-up.
+                std::this_thread::yield();
+            } else if (!sleep()) {
+                break;
+            } else {
+                idleRounds = 0;
+            }
+        }
+        t_pool = nullptr;
+    }
+
+    void pinCurrentThread(size_t index) {
+#if defined(__linux__)
+        if (options.pinThreads) {
+            unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(index % cores, &set);
+            sched_setaffinity(0, sizeof(set), &set);
+        }
+#else
+        (void)index;
+#endif
+    }
+};
+
+thread_local ThreadPool::Impl* ThreadPool::Impl::t_pool = nullptr;
+thread_local size_t ThreadPool::Impl::t_index = 0;
+
+ThreadPool::ThreadPool() : ThreadPool(Options{}) {}
+
+ThreadPool::ThreadPool(Options options) : _impl(std::make_unique<Impl>(options)) {}
+
+ThreadPool::~ThreadPool() = default;
+
+size_t ThreadPool::size() const {
+    return _impl->workers.size();
+}
+
+void ThreadPool::submit(detail::PoolTask* task) {
+    _impl->submit(task);
+}
+
+void ThreadPool::setWorkerInitializer(std::function<void()> initializer) {
+    std::lock_guard lk(workerInitializerMutex());
+    workerInitializer() = std::move(initializer);
+}
+
+ThreadPool& defaultThreadPool() {
+    static ThreadPool* pool = new ThreadPool();
+    return *pool;
+}
+
+} // namespace djinni
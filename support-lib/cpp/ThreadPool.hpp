@@ -0,0 +1,112 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#pragma once
+
+#include "Executor.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace djinni {
+
+namespace detail {
+
+// A type erased, move-only task owned by the pool between `execute()` and the
+// end of its run.
+struct PoolTask {
+    virtual ~PoolTask() = default;
+    virtual void run() = 0;
+};
+template <typename F>
+class PoolTaskImpl : public PoolTask {
+public:
+    explicit PoolTaskImpl(F&& f) : _f(std::move(f)) {}
+    explicit PoolTaskImpl(const F& f) : _f(f) {}
+    void run() override {
+        _f();
+    }
+private:
+    F _f;
+};
+
+} // namespace detail
+
+// A fixed set of worker threads that share tasks by work stealing. It is an
+// executor (see Executor.hpp), so it can be passed to `Future::then()`,
+// `Future::resumeOn()` and `async()`.
+//
+// Every worker owns a Chase-Lev deque. Tasks submitted from a worker go to the
+// bottom of its own deque, where the worker picks them up again without
+// synchronizing with anyone. Tasks submitted from any other thread go to a
+// global queue. An idle worker takes from its own deque first, then from the
+// global queue, then steals from the top of another worker's deque, and
+// finally sleeps until new work is submitted.
+//
+// Tasks must not throw: an exception that escapes a task terminates the
+// process, as it would on a std::thread. Wrap the work with `async()` to
+// deliver it through a future instead.
+//
+// In wasm, a pool can only be created in builds with pthreads enabled.
+class ThreadPool {
+public:
+    struct Options {
+        // Number of worker threads. 0 means one per hardware thread.
+        size_t threads = 0;
+        // Pin worker `i` to core `i % cores`. Only honored on Linux and
+        // Android; ignored elsewhere.
+        bool pinThreads = false;
+    };
+
+    ThreadPool();
+    explicit ThreadPool(Options options);
+    // Waits until every submitted task, including tasks submitted by other
+    // tasks meanwhile, has run, then joins the workers. Must not be called
+    // from one of the pool's own workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template <typename F>
+    void execute(F&& task) {
+        submit(new detail::PoolTaskImpl<std::decay_t<F>>(std::forward<F>(task)));
+    }
+
+    size_t size() const;
+
+    // Sets a function that every worker of every pool calls once on its own
+    // thread before it runs any task. The JNI support library uses it to
+    // attach workers to the JVM up front (see jniInit()). Workers that are
+    // already running are not affected.
+    static void setWorkerInitializer(std::function<void()> initializer);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+
+    void submit(detail::PoolTask* task);
+};
+
+// A process-wide pool with one worker per hardware thread, created on first
+// use. It is never destroyed, so tasks may still be running on it while
+// static destructors run.
+ThreadPool& defaultThreadPool();
+
+} // namespace djinni
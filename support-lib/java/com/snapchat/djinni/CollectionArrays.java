@@ -0,0 +1,195 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+package com.snapchat.djinni;
+
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Map;
+
+/**
+ * Flattens maps and sets into arrays, and builds them back from arrays, for the JNI marshallers
+ * of map<> and set<> (Map and Set in Marshal.hpp). Native code then reads or writes all the
+ * entries with one call and plain array accesses, instead of calling the iterator, getKey()
+ * and getValue(), or put(), once per entry.
+ *
+ * Elements of a primitive type travel in a primitive array, named by the element character of
+ * its type signature ('Z', 'B', 'S', 'I', 'J', 'F' or 'D'). Any other kind ('L') means an
+ * Object[] holding the elements as they are.
+ */
+public final class CollectionArrays {
+    private CollectionArrays() {}
+
+    public static Object toArray(HashSet<?> set, char kind) {
+        return unbox(set.toArray(), kind);
+    }
+
+    public static HashSet<Object> fromArray(Object array, char kind) {
+        final Object[] elements = box(array, kind);
+        final HashSet<Object> set = new HashSet<>(capacity(elements.length));
+        for (Object element : elements) {
+            set.add(element);
+        }
+        return set;
+    }
+
+    /** Returns the keys and the values of the map as two arrays in the same order. */
+    public static Object[] toArrays(HashMap<?, ?> map, char keyKind, char valueKind) {
+        final Object[] keys = new Object[map.size()];
+        final Object[] values = new Object[keys.length];
+        int i = 0;
+        for (Map.Entry<?, ?> entry : map.entrySet()) {
+            keys[i] = entry.getKey();
+            values[i] = entry.getValue();
+            i++;
+        }
+        return new Object[] {unbox(keys, keyKind), unbox(values, valueKind)};
+    }
+
+    public static HashMap<Object, Object> fromArrays(Object keys, char keyKind, Object values, char valueKind) {
+        final Object[] boxedKeys = box(keys, keyKind);
+        final Object[] boxedValues = box(values, valueKind);
+        final HashMap<Object, Object> map = new HashMap<>(capacity(boxedKeys.length));
+        for (int i = 0; i < boxedKeys.length; i++) {
+            map.put(boxedKeys[i], boxedValues[i]);
+        }
+        return map;
+    }
+
+    // The initial capacity that holds `size` entries without rehashing at the default load factor.
+    private static int capacity(int size) {
+        return (int) (size / 0.75f) + 1;
+    }
+
+    private static Object unbox(Object[] boxed, char kind) {
+        switch (kind) {
+            case 'Z': {
+                final boolean[] array = new boolean[boxed.length];
+                for (int i = 0; i < array.length; i++) {
+                    array[i] = (Boolean) boxed[i];
+                }
+                return array;
+            }
+            case 'B': {
+                final byte[] array = new byte[boxed.length];
+                for (int i = 0; i < array.length; i++) {
+                    array[i] = (Byte) boxed[i];
+                }
+                return array;
+            }
+            case 'S': {
+                final short[] array = new short[boxed.length];
+                for (int i = 0; i < array.length; i++) {
+                    array[i] = (Short) boxed[i];
+                }
+                return array;
+            }
+            case 'I': {
+                final int[] array = new int[boxed.length];
+                for (int i = 0; i < array.length; i++) {
+                    array[i] = (Integer) boxed[i];
+                }
+                return array;
+            }
+            case 'J': {
+                final long[] array = new long[boxed.length];
+                for (int i = 0; i < array.length; i++) {
+                    array[i] = (Long) boxed[i];
+                }
+                return array;
+            }
+            case 'F': {
+                final float[] array = new float[boxed.length];
+                for (int i = 0; i < array.length; i++) {
+                    array[i] = (Float) boxed[i];
+                }
+                return array;
+            }
+            case 'D': {
+                final double[] array = new double[boxed.length];
+                for (int i = 0; i < array.length; i++) {
+                    array[i] = (Double) boxed[i];
+                }
+                return array;
+            }
+            default:
+                return boxed;
+        }
+    }
+
+    private static Object[] box(Object array, char kind) {
+        switch (kind) {
+            case 'Z': {
+                final boolean[] primitives = (boolean[]) array;
+                final Object[] boxed = new Object[primitives.length];
+                for (int i = 0; i < boxed.length; i++) {
+                    boxed[i] = primitives[i];
+                }
+                return boxed;
+            }
+            case 'B': {
+                final byte[] primitives = (byte[]) array;
+                final Object[] boxed = new Object[primitives.length];
+                for (int i = 0; i < boxed.length; i++) {
+                    boxed[i] = primitives[i];
+                }
+                return boxed;
+            }
+            case 'S': {
+                final short[] primitives = (short[]) array;
+                final Object[] boxed = new Object[primitives.length];
+                for (int i = 0; i < boxed.length; i++) {
+                    boxed[i] = primitives[i];
+                }
+                return boxed;
+            }
+            case 'I': {
+                final int[] primitives = (int[]) array;
+                final Object[] boxed = new Object[primitives.length];
+                for (int i = 0; i < boxed.length; i++) {
+                    boxed[i] = primitives[i];
+                }
+                return boxed;
+            }
+            case 'J': {
+                final long[] primitives = (long[]) array;
+                final Object[] boxed = new Object[primitives.length];
+                for (int i = 0; i < boxed.length; i++) {
+                    boxed[i] = primitives[i];
+                }
+                return boxed;
+            }
+            case 'F': {
+                final float[] primitives = (float[]) array;
+                final Object[] boxed = new Object[primitives.length];
+                for (int i = 0; i < boxed.length; i++) {
+                    boxed[i] = primitives[i];
+                }
+                return boxed;
+            }
+            case 'D': {
+                final double[] primitives = (double[]) array;
+                final Object[] boxed = new Object[primitives.length];
+                for (int i = 0; i < boxed.length; i++) {
+                    boxed[i] = primitives[i];
+                }
+                return boxed;
+            }
+            default:
+                return (Object[]) array;
+        }
+    }
+}
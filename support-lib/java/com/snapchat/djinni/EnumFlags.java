@@ -0,0 +1,52 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+package com.snapchat.djinni;
+
+import java.util.EnumSet;
+
+/**
+ * Converts the EnumSet of a djinni flags enum to and from its bitmask for the
+ * JNI marshaller (JniFlags in djinni_support.hpp). Bit n stands for the
+ * constant with ordinal n. Walking the set on this side of the boundary lets
+ * native code convert a whole set with one call, instead of calling the
+ * iterator and ordinal() once per element or add() once per bit.
+ */
+public final class EnumFlags {
+    private EnumFlags() {}
+
+    public static long toBits(EnumSet<?> set) {
+        long bits = 0;
+        for (Enum<?> value : set) {
+            bits |= 1L << value.ordinal();
+        }
+        return bits;
+    }
+
+    /**
+     * values holds the constants of clazz in ordinal order. Native code keeps
+     * it from the enum's values() and passes it in, as getEnumConstants()
+     * would copy it on every call.
+     */
+    public static <E extends Enum<E>> EnumSet<E> fromBits(Class<E> clazz, E[] values, long bits) {
+        final EnumSet<E> set = EnumSet.noneOf(clazz);
+        while (bits != 0) {
+            set.add(values[Long.numberOfTrailingZeros(bits)]);
+            bits &= bits - 1;
+        }
+        return set;
+    }
+}
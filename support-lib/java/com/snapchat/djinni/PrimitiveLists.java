@@ -0,0 +1,142 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+package com.snapchat.djinni;
+
+import java.util.ArrayList;
+
+/**
+ * Converts lists of boxed primitives to and from primitive arrays for the JNI
+ * marshaller of list<bool>, list<i8> ... list<f64> (List in Marshal.hpp).
+ * Unboxing on this side of the boundary lets native code convert a whole list
+ * with one call and one array copy, instead of calling get() and the unboxing
+ * method once per element.
+ */
+public final class PrimitiveLists {
+    private PrimitiveLists() {}
+
+    public static boolean[] toBooleanArray(ArrayList<Boolean> list) {
+        final boolean[] array = new boolean[list.size()];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = list.get(i);
+        }
+        return array;
+    }
+
+    public static byte[] toByteArray(ArrayList<Byte> list) {
+        final byte[] array = new byte[list.size()];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = list.get(i);
+        }
+        return array;
+    }
+
+    public static short[] toShortArray(ArrayList<Short> list) {
+        final short[] array = new short[list.size()];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = list.get(i);
+        }
+        return array;
+    }
+
+    public static int[] toIntArray(ArrayList<Integer> list) {
+        final int[] array = new int[list.size()];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = list.get(i);
+        }
+        return array;
+    }
+
+    public static long[] toLongArray(ArrayList<Long> list) {
+        final long[] array = new long[list.size()];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = list.get(i);
+        }
+        return array;
+    }
+
+    public static float[] toFloatArray(ArrayList<Float> list) {
+        final float[] array = new float[list.size()];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = list.get(i);
+        }
+        return array;
+    }
+
+    public static double[] toDoubleArray(ArrayList<Double> list) {
+        final double[] array = new double[list.size()];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = list.get(i);
+        }
+        return array;
+    }
+
+    public static ArrayList<Boolean> fromArray(boolean[] array) {
+        final ArrayList<Boolean> list = new ArrayList<>(array.length);
+        for (boolean value : array) {
+            list.add(value);
+        }
+        return list;
+    }
+
+    public static ArrayList<Byte> fromArray(byte[] array) {
+        final ArrayList<Byte> list = new ArrayList<>(array.length);
+        for (byte value : array) {
+            list.add(value);
+        }
+        return list;
+    }
+
+    public static ArrayList<Short> fromArray(short[] array) {
+        final ArrayList<Short> list = new ArrayList<>(array.length);
+        for (short value : array) {
+            list.add(value);
+        }
+        return list;
+    }
+
+    public static ArrayList<Integer> fromArray(int[] array) {
+        final ArrayList<Integer> list = new ArrayList<>(array.length);
+        for (int value : array) {
+            list.add(value);
+        }
+        return list;
+    }
+
+    public static ArrayList<Long> fromArray(long[] array) {
+        final ArrayList<Long> list = new ArrayList<>(array.length);
+        for (long value : array) {
+            list.add(value);
+        }
+        return list;
+    }
+
+    public static ArrayList<Float> fromArray(float[] array) {
+        final ArrayList<Float> list = new ArrayList<>(array.length);
+        for (float value : array) {
+            list.add(value);
+        }
+        return list;
+    }
+
+    public static ArrayList<Double> fromArray(double[] array) {
+        final ArrayList<Double> list = new ArrayList<>(array.length);
+        for (double value : array) {
+            list.add(value);
+        }
+        return list;
+    }
+}
@@ -0,0 +1,85 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+package com.snapchat.djinni;
+
+/**
+ * A snapshot of the counters kept by one of djinni's proxy caches for one
+ * translated type (see ProxyCacheCounters in proxy_cache_interface.hpp).
+ *
+ * forJavaObjects() covers the cache of C++ proxies wrapping Java objects, and
+ * forCppObjects() the cache of CppProxy objects wrapping C++ objects. Neither
+ * takes a lock in the cache, so they can be polled while traffic is flowing;
+ * the counters are read one at a time, so they are only approximately
+ * consistent with each other.
+ */
+public final class ProxyCacheCounters {
+    /** The C++ type name the counters are kept for. */
+    public final String type;
+    public final long hits;
+    public final long misses;
+    /** Dead entries dropped by a lookup before their proxy's removal ran. */
+    public final long expiredPrunes;
+    public final long removes;
+    /** Removals that found a newer live proxy in place of the dying one. */
+    public final long removeRaces;
+    /** Removals queued for another thread because the cache's lock was busy. */
+    public final long deferredRemoves;
+    public final long lockContentions;
+    public final long lockWaitNanos;
+
+    ProxyCacheCounters(String type, long hits, long misses, long expiredPrunes,
+                       long removes, long removeRaces, long deferredRemoves,
+                       long lockContentions, long lockWaitNanos) {
+        this.type = type;
+        this.hits = hits;
+        this.misses = misses;
+        this.expiredPrunes = expiredPrunes;
+        this.removes = removes;
+        this.removeRaces = removeRaces;
+        this.deferredRemoves = deferredRemoves;
+        this.lockContentions = lockContentions;
+        this.lockWaitNanos = lockWaitNanos;
+    }
+
+    /**
+     * Approximate number of entries currently in the cache. A snapshot taken
+     * during traffic can count a removal but not yet the miss that created the
+     * entry, hence the clamp.
+     */
+    public long live() {
+        return Math.max(misses - expiredPrunes - removes, 0);
+    }
+
+    public static ProxyCacheCounters[] forJavaObjects() {
+        return nativeGet(false);
+    }
+
+    public static ProxyCacheCounters[] forCppObjects() {
+        return nativeGet(true);
+    }
+
+    @Override
+    public String toString() {
+        return type + "{hits=" + hits + ", misses=" + misses
+            + ", expiredPrunes=" + expiredPrunes + ", removes=" + removes
+            + ", removeRaces=" + removeRaces + ", deferredRemoves=" + deferredRemoves
+            + ", lockContentions=" + lockContentions
+            + ", lockWaitNanos=" + lockWaitNanos + "}";
+    }
+
+    private static native ProxyCacheCounters[] nativeGet(boolean cppObjects);
+}
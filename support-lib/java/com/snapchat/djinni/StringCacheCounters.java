@@ -0,0 +1,51 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+package com.snapchat.djinni;
+
+/**
+ * A snapshot of the counters kept by the cache that interned_string results
+ * go through on their way into Java (see jniGetStringCacheCounters in
+ * djinni_support.hpp). get() doesn't take the cache's lock, so the counters
+ * are only approximately consistent with each other.
+ */
+public final class StringCacheCounters {
+    public final long hits;
+    /** Strings short enough to cache that weren't in it. */
+    public final long misses;
+    public final long evictions;
+
+    StringCacheCounters(long hits, long misses, long evictions) {
+        this.hits = hits;
+        this.misses = misses;
+        this.evictions = evictions;
+    }
+
+    public double hitRate() {
+        return hits + misses == 0 ? 0.0 : (double) hits / (double) (hits + misses);
+    }
+
+    public static StringCacheCounters get() {
+        return nativeGet();
+    }
+
+    @Override
+    public String toString() {
+        return "{hits=" + hits + ", misses=" + misses + ", evictions=" + evictions + "}";
+    }
+
+    private static native StringCacheCounters nativeGet();
+}
@@ -0,0 +1,30 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+package com.snapchat.djinni;
+
+/**
+ * The size in bytes from which `zero_copy` binary results reach Java as a
+ * direct ByteBuffer owning the C++ vector's storage, instead of a wrapped
+ * byte[] (see jniGetZeroCopyBinaryThreshold in DataRef_jni.hpp).
+ */
+public final class ZeroCopyBinary {
+    private ZeroCopyBinary() {}
+
+    public static native long getThreshold();
+
+    public static native void setThreshold(long bytes);
+}
@@ -18,8 +18,11 @@
 
 #if DATAREF_JNI
 
+#include "DataRef_jni.hpp"
+#include "Marshal.hpp"
 #include "djinni_support.hpp"
 
+#include <atomic>
 #include <cassert>
 #include <variant>
 
@@ -203,6 +206,75 @@ DataRef::DataRef(void* platformObj) {
     _impl = std::make_shared<DataRefJNI>(reinterpret_cast<jobject>(platformObj));
 }
 
+static std::atomic<size_t> g_zeroCopyBinaryThreshold { 16 * 1024 };
+
+void jniSetZeroCopyBinaryThreshold(size_t bytes) {
+    g_zeroCopyBinaryThreshold.store(bytes, std::memory_order_relaxed);
+}
+
+size_t jniGetZeroCopyBinaryThreshold() {
+    return g_zeroCopyBinaryThreshold.load(std::memory_order_relaxed);
+}
+
+struct BinaryBufferClassInfo {
+    const GlobalRef<jclass> clazz { jniFindClass("java/nio/ByteBuffer") };
+    const jmethodID method_wrap { jniGetStaticMethodID(clazz.get(), "wrap", "([B)Ljava/nio/ByteBuffer;") };
+    const jmethodID method_position { jniGetMethodID(clazz.get(), "position", "()I") };
+    const jmethodID method_remaining { jniGetMethodID(clazz.get(), "remaining", "()I") };
+    const jmethodID method_array { jniGetMethodID(clazz.get(), "array", "()[B") };
+    const jmethodID method_arrayOffset { jniGetMethodID(clazz.get(), "arrayOffset", "()I") };
+};
+
+auto BinaryBuffer::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    DJINNI_ASSERT(j != nullptr, jniEnv);
+    const auto& data = JniClass<BinaryBufferClassInfo>::get();
+    const jint position = jniEnv->CallIntMethod(j, data.method_position);
+    jniExceptionCheck(jniEnv);
+    const jint remaining = jniEnv->CallIntMethod(j, data.method_remaining);
+    jniExceptionCheck(jniEnv);
+    if (const auto* buf = static_cast<const uint8_t*>(jniEnv->GetDirectBufferAddress(j))) {
+        return CppType(buf + position, buf + position + remaining);
+    }
+    // Not direct, so it must be backed by an array (ByteBuffer.wrap() or allocate()). Read-only
+    // buffers hide their array and are rejected with a ReadOnlyBufferException.
+    LocalRef<jbyteArray> array(jniEnv, static_cast<jbyteArray>(jniEnv->CallObjectMethod(j, data.method_array)));
+    jniExceptionCheck(jniEnv);
+    const jint offset = jniEnv->CallIntMethod(j, data.method_arrayOffset);
+    jniExceptionCheck(jniEnv);
+    CppType ret(static_cast<size_t>(remaining));
+    if (remaining > 0) {
+        jniEnv->GetByteArrayRegion(array.get(), offset + position, remaining, reinterpret_cast<jbyte*>(ret.data()));
+        jniExceptionCheck(jniEnv);
+    }
+    return ret;
+}
+
+static LocalRef<jobject> wrapByteArray(JNIEnv* jniEnv, const std::vector<uint8_t>& c) {
+    const auto& data = JniClass<BinaryBufferClassInfo>::get();
+    auto array = Binary::fromCpp(jniEnv, c);
+    LocalRef<jobject> buffer(jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_wrap, array.get()));
+    jniExceptionCheck(jniEnv);
+    return buffer;
+}
+
+static LocalRef<jobject> directBuffer(JNIEnv* jniEnv, const DataRef& ref) {
+    return LocalRef<jobject>(jniEnv, jniEnv->NewLocalRef(reinterpret_cast<jobject>(ref.platformObj())));
+}
+
+auto BinaryBuffer::fromCpp(JNIEnv* jniEnv, const CppType& c) -> LocalRef<JniType> {
+    if (c.size() < jniGetZeroCopyBinaryThreshold()) {
+        return wrapByteArray(jniEnv, c);
+    }
+    return directBuffer(jniEnv, DataRef(c.data(), c.size()));
+}
+
+auto BinaryBuffer::fromCpp(JNIEnv* jniEnv, CppType&& c) -> LocalRef<JniType> {
+    if (c.size() < jniGetZeroCopyBinaryThreshold()) {
+        return wrapByteArray(jniEnv, c);
+    }
+    return directBuffer(jniEnv, DataRef(std::move(c)));
+}
+
 // NOLINTNEXTLINE
 static void DataRefHelper_nativeDestroy(JNIEnv* /*unused*/, jclass /*unused*/, jlong nativeRef) {
     delete reinterpret_cast<DataRefJNI::DataObj*>(nativeRef);
@@ -218,6 +290,30 @@ static const JNINativeMethod kNativeMethods[] = {{
 static auto sRegisterMethods =
     JNIMethodLoadAutoRegister("com/snapchat/djinni/DataRefHelper", kNativeMethods);
 
+// NOLINTNEXTLINE
+static jlong ZeroCopyBinary_getThreshold(JNIEnv* /*unused*/, jclass /*unused*/) {
+    return static_cast<jlong>(jniGetZeroCopyBinaryThreshold());
+}
+
+// NOLINTNEXTLINE
+static void ZeroCopyBinary_setThreshold(JNIEnv* /*unused*/, jclass /*unused*/, jlong bytes) {
+    jniSetZeroCopyBinaryThreshold(static_cast<size_t>(bytes));
+}
+
+static const JNINativeMethod kZeroCopyBinaryMethods[] = {{
+    const_cast<char*>("getThreshold"),
+    const_cast<char*>("()J"),
+    reinterpret_cast<void*>(&ZeroCopyBinary_getThreshold),
+}, {
+    const_cast<char*>("setThreshold"),
+    const_cast<char*>("(J)V"),
+    reinterpret_cast<void*>(&ZeroCopyBinary_setThreshold),
+}};
+
+// NOLINTNEXTLINE
+static auto sRegisterZeroCopyBinaryMethods =
+    JNIMethodLoadAutoRegister("com/snapchat/djinni/ZeroCopyBinary", kZeroCopyBinaryMethods);
+
 } // namespace djinni
 
 #endif
@@ -19,6 +19,9 @@
 #include "djinni_support.hpp"
 #include "../cpp/DataRef.hpp"
 
+#include <cstdint>
+#include <vector>
+
 namespace djinni {
 struct NativeDataRef {
     using CppType = DataRef;
@@ -35,4 +38,32 @@ struct NativeDataRef {
 
     using Boxed = NativeDataRef;
 };
+
+/*
+ * Marshals the `binary` result of a method declared `zero_copy` (or of every method, with
+ * --jni-zero-copy-binary-results) as a java.nio.ByteBuffer. Results smaller than
+ * jniGetZeroCopyBinaryThreshold() are copied into a byte[] and wrapped, as for Binary. Bigger
+ * ones become a direct buffer that owns the vector's storage, the way DataRef takes over a
+ * vector, so an rvalue result is not copied at all and a const one is copied once, outside
+ * the Java heap. Either way the Java side reads the bytes between position() and limit().
+ */
+struct BinaryBuffer {
+    using CppType = std::vector<uint8_t>;
+    using JniType = jobject;
+
+    using Boxed = BinaryBuffer;
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, CppType&& c);
+};
+
+/*
+ * Size in bytes from which BinaryBuffer hands results to Java as a direct buffer instead of a
+ * wrapped byte[]. Registering a direct buffer for cleanup costs a few JNI calls, which only
+ * pays off once the copy it saves is big enough. Defaults to 16 KiB and may be changed at any
+ * time, from any thread.
+ */
+void jniSetZeroCopyBinaryThreshold(size_t bytes);
+size_t jniGetZeroCopyBinaryThreshold();
 } // namespace djinni
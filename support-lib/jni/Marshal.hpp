@@ -19,10 +19,14 @@
 #pragma once
 
 #include "djinni_support.hpp"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -40,6 +44,39 @@ namespace djinni
         static CppType toCpp(JNIEnv* /*jniEnv*/, JniType j) noexcept { return static_cast<CppType>(j); }
         static JniType fromCpp(JNIEnv* /*jniEnv*/, CppType c) noexcept { return static_cast<JniType>(c); }
 
+        // Conversions to and from the jlong slot a field takes in a packed record (see List).
+        // Floating point values keep their bit pattern, as Java's floatToRawIntBits and
+        // doubleToRawLongBits do on the other side.
+        static jlong pack(CppType c) noexcept
+        {
+            if constexpr (std::is_same<CppType, float>::value) {
+                int32_t bits;
+                std::memcpy(&bits, &c, sizeof(bits));
+                return bits;
+            } else if constexpr (std::is_same<CppType, double>::value) {
+                jlong bits;
+                std::memcpy(&bits, &c, sizeof(bits));
+                return bits;
+            } else {
+                return static_cast<jlong>(c);
+            }
+        }
+        static CppType unpack(jlong j) noexcept
+        {
+            if constexpr (std::is_same<CppType, float>::value) {
+                auto bits = static_cast<int32_t>(j);
+                float c;
+                std::memcpy(&c, &bits, sizeof(c));
+                return c;
+            } else if constexpr (std::is_same<CppType, double>::value) {
+                double c;
+                std::memcpy(&c, &j, sizeof(c));
+                return c;
+            } else {
+                return static_cast<CppType>(j);
+            }
+        }
+
         struct Boxed
         {
             using JniType = jobject;
@@ -162,6 +199,98 @@ namespace djinni
         }
     };
 
+    /*
+     * Bulk copies between Java primitive arrays and native memory, shared by Binary, the
+     * primitive Array specializations and Protobuf. An array of up to
+     * jniGetCriticalCopyThreshold() bytes is pinned with GetPrimitiveArrayCritical and copied in
+     * one go. A larger one is copied kJniArrayCopyChunkBytes at a time with
+     * Get/Set<Type>ArrayRegion, so the GC is never held off for longer than one chunk takes.
+     */
+    constexpr size_t kJniArrayCopyChunkBytes = 64 * 1024;
+
+    template <class JniElem> struct JniArrayRegion;
+#define DJINNI_JNI_ARRAY_REGION(JniElem, Name) \
+    template <> struct JniArrayRegion<JniElem> \
+    { \
+        static void get(JNIEnv* jniEnv, jarray arr, jsize start, jsize count, JniElem* out) { \
+            jniEnv->Get##Name##ArrayRegion(static_cast<JniElem##Array>(arr), start, count, out); \
+        } \
+        static void set(JNIEnv* jniEnv, jarray arr, jsize start, jsize count, const JniElem* in) { \
+            jniEnv->Set##Name##ArrayRegion(static_cast<JniElem##Array>(arr), start, count, in); \
+        } \
+    };
+    DJINNI_JNI_ARRAY_REGION(jboolean, Boolean)
+    DJINNI_JNI_ARRAY_REGION(jbyte, Byte)
+    DJINNI_JNI_ARRAY_REGION(jshort, Short)
+    DJINNI_JNI_ARRAY_REGION(jint, Int)
+    DJINNI_JNI_ARRAY_REGION(jlong, Long)
+    DJINNI_JNI_ARRAY_REGION(jfloat, Float)
+    DJINNI_JNI_ARRAY_REGION(jdouble, Double)
+#undef DJINNI_JNI_ARRAY_REGION
+
+    template <class JniElem>
+    bool jniUseCriticalCopy(jsize length)
+    {
+        return static_cast<size_t>(length) * sizeof(JniElem) <= jniGetCriticalCopyThreshold();
+    }
+
+    // Hands the `length` elements of `arr` to sink(const JniElem* data, jsize count), either all
+    // at once or a chunk at a time in order.
+    template <class JniElem, class Sink>
+    void jniReadArray(JNIEnv* jniEnv, jarray arr, jsize length, Sink&& sink)
+    {
+        if (length == 0) {
+            return;
+        }
+        if (jniUseCriticalCopy<JniElem>(length)) {
+            auto deleter = [jniEnv, arr] (void* c) {if (c) {jniEnv->ReleasePrimitiveArrayCritical(arr, c, JNI_ABORT);}};
+            std::unique_ptr<JniElem, decltype(deleter)> ptr(
+                reinterpret_cast<JniElem*>(jniEnv->GetPrimitiveArrayCritical(arr, nullptr)),
+                deleter);
+            if (!ptr) {
+                jniExceptionCheck(jniEnv);
+                return;
+            }
+            sink(static_cast<const JniElem*>(ptr.get()), length);
+            return;
+        }
+        constexpr jsize chunk = static_cast<jsize>(kJniArrayCopyChunkBytes / sizeof(JniElem));
+        std::unique_ptr<JniElem[]> buf(new JniElem[std::min(chunk, length)]);
+        for (jsize start = 0; start < length; start += chunk) {
+            const jsize count = std::min(chunk, length - start);
+            JniArrayRegion<JniElem>::get(jniEnv, arr, start, count, buf.get());
+            jniExceptionCheck(jniEnv);
+            sink(static_cast<const JniElem*>(buf.get()), count);
+        }
+    }
+
+    // Fills the `length` elements of `arr` by calling source(JniElem* out, jsize start,
+    // jsize count), either once for the whole array or once per chunk in order.
+    template <class JniElem, class Source>
+    void jniWriteArray(JNIEnv* jniEnv, jarray arr, jsize length, Source&& source)
+    {
+        if (length == 0) {
+            return;
+        }
+        if (jniUseCriticalCopy<JniElem>(length)) {
+            auto deleter = [jniEnv, arr] (void* c) {if (c) {jniEnv->ReleasePrimitiveArrayCritical(arr, c, 0);}};
+            std::unique_ptr<JniElem, decltype(deleter)> ptr(
+                reinterpret_cast<JniElem*>(jniEnv->GetPrimitiveArrayCritical(arr, nullptr)),
+                deleter);
+            DJINNI_ASSERT(ptr, jniEnv);
+            source(ptr.get(), jsize(0), length);
+            return;
+        }
+        constexpr jsize chunk = static_cast<jsize>(kJniArrayCopyChunkBytes / sizeof(JniElem));
+        std::unique_ptr<JniElem[]> buf(new JniElem[std::min(chunk, length)]);
+        for (jsize start = 0; start < length; start += chunk) {
+            const jsize count = std::min(chunk, length - start);
+            source(buf.get(), start, count);
+            JniArrayRegion<JniElem>::set(jniEnv, arr, start, count, buf.get());
+            jniExceptionCheck(jniEnv);
+        }
+    }
+
     struct String
     {
         using CppType = std::string;
@@ -177,10 +306,25 @@ namespace djinni
 
         static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
         {
+            if (jniGetInternAllStrings()) {
+                return {jniEnv, jniInternedStringFromUTF8(jniEnv, c)};
+            }
             return {jniEnv, jniStringFromUTF8(jniEnv, c)};
         }
     };
 
+    // Translator for `interned_string` (support-lib/interned_string.yaml): a string whose short
+    // values are handed to Java from the cache behind jniInternedStringFromUTF8().
+    struct InternedString : String
+    {
+        using Boxed = InternedString;
+
+        static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+        {
+            return {jniEnv, jniInternedStringFromUTF8(jniEnv, c)};
+        }
+    };
+
     struct WString
     {
         using CppType = std::wstring;
@@ -219,24 +363,20 @@ namespace djinni
                 return ret;
             }
 
-            {
-                auto deleter = [jniEnv, j] (void* c) {
-                    if (c) {
-                        jniEnv->ReleasePrimitiveArrayCritical(j, c, JNI_ABORT);
-                    }
-                };
-
-                std::unique_ptr<uint8_t, decltype(deleter)> ptr(
-                    reinterpret_cast<uint8_t*>(jniEnv->GetPrimitiveArrayCritical(j, nullptr)),
-                    deleter
-                );
-
-                if (ptr) {
-                    // Construct and then move-assign. This copies the elements only once,
-                    // and avoids having to initialize before filling (as with resize())
-                    ret = std::vector<uint8_t>{ptr.get(), ptr.get() + length};
-                } else {
-                    // Something failed...
+            if (jniUseCriticalCopy<jbyte>(length)) {
+                jniReadArray<jbyte>(jniEnv, j, length, [&ret] (const jbyte* data, jsize count) {
+                    // Inserting copies the elements only once, and avoids having to
+                    // initialize before filling (as with resize())
+                    const auto bytes = reinterpret_cast<const uint8_t*>(data);
+                    ret.insert(ret.end(), bytes, bytes + count);
+                });
+            } else {
+                // Too big to pin: copy straight into the vector a chunk at a time.
+                ret.resize(length);
+                const jsize chunk = static_cast<jsize>(kJniArrayCopyChunkBytes);
+                for (jsize start = 0; start < length; start += chunk) {
+                    const jsize count = std::min(chunk, length - start);
+                    jniEnv->GetByteArrayRegion(j, start, count, reinterpret_cast<jbyte*>(ret.data() + start));
                     jniExceptionCheck(jniEnv);
                 }
             }
@@ -249,10 +389,14 @@ namespace djinni
             assert(c.size() <= std::numeric_limits<jsize>::max());
             auto j = LocalRef<jbyteArray>(jniEnv, jniEnv->NewByteArray(static_cast<jsize>(c.size())));
             jniExceptionCheck(jniEnv);
-            // Using .data() on an empty vector is UB
-            if(!c.empty())
-            {
-                jniEnv->SetByteArrayRegion(j.get(), 0, jsize(c.size()), reinterpret_cast<const jbyte*>(c.data()));
+            // SetByteArrayRegion copies without pinning, but the VM still can't stop this thread
+            // for a GC until it returns, so large binaries are copied a chunk at a time.
+            const auto length = static_cast<jsize>(c.size());
+            const jsize chunk = jniUseCriticalCopy<jbyte>(length) ? length : static_cast<jsize>(kJniArrayCopyChunkBytes);
+            for (jsize start = 0; start < length; start += chunk) {
+                const jsize count = std::min(chunk, length - start);
+                jniEnv->SetByteArrayRegion(j.get(), start, count, reinterpret_cast<const jbyte*>(c.data() + start));
+                jniExceptionCheck(jniEnv);
             }
             return j;
         }
@@ -332,6 +476,207 @@ namespace djinni
         }
     };
 
+    /*
+     * Collections of interfaces are converted in batches, so that the proxy cache is
+     * consulted once per batch rather than once per element (see ProxyCache::get_batch).
+     * Batches are bounded, and the local references they hold are reserved with
+     * EnsureLocalCapacity before each batch, since the VM only guarantees room for 16.
+     */
+    template <class T, class = void>
+    struct IsJniInterface : std::false_type {};
+
+    template <class T>
+    struct IsJniInterface<T, std::enable_if_t<
+        std::is_base_of<JniInterface<typename T::CppType::element_type, T>, T>::value>>
+        : std::true_type {};
+
+    constexpr size_t kInterfaceBatchSize = 64;
+
+    inline void ensureInterfaceBatchCapacity(JNIEnv* jniEnv)
+    {
+        if(jniEnv->EnsureLocalCapacity(static_cast<jint>(kInterfaceBatchSize)) != 0)
+        {
+            // An OutOfMemoryError is pending.
+            jniExceptionCheck(jniEnv);
+        }
+    }
+
+    template <class T>
+    class InterfaceBatchToCpp
+    {
+        using CppType = typename T::CppType;
+
+    public:
+        // Takes the local reference to the next element.
+        void add(JNIEnv* jniEnv, LocalRef<jobject> j)
+        {
+            if(m_count == 0)
+            {
+                ensureInterfaceBatchCapacity(jniEnv);
+            }
+            m_refs[m_count++] = std::move(j);
+        }
+        bool full() const { return m_count == kInterfaceBatchSize; }
+
+        // Converts the pending elements, calling `sink(k, value)` for each in order.
+        template <class F>
+        void flush(JNIEnv* jniEnv, F&& sink)
+        {
+            jobject objs[kInterfaceBatchSize];
+            CppType values[kInterfaceBatchSize];
+            for(size_t k = 0; k < m_count; ++k)
+            {
+                objs[k] = m_refs[k].get();
+            }
+            JniInterface<typename CppType::element_type, T>::fromJavaBatch(jniEnv, objs, m_count, values);
+            for(size_t k = 0; k < m_count; ++k)
+            {
+                // Nulls go through the element marshaller, which decides whether they are allowed.
+                sink(k, objs[k] ? std::move(values[k]) : T::toCpp(jniEnv, nullptr));
+                m_refs[k].reset();
+            }
+            m_count = 0;
+        }
+
+    private:
+        LocalRef<jobject> m_refs[kInterfaceBatchSize];
+        size_t m_count = 0;
+    };
+
+    template <class T>
+    class InterfaceBatchFromCpp
+    {
+        using CppType = typename T::CppType;
+
+    public:
+        // The element must stay alive until the next flush().
+        void add(const CppType& c) { m_values[m_count++] = &c; }
+        bool full() const { return m_count == kInterfaceBatchSize; }
+
+        // Converts the pending elements, calling `sink(k, localRef)` for each in order.
+        template <class F>
+        void flush(JNIEnv* jniEnv, F&& sink)
+        {
+            if(m_count == 0)
+            {
+                return;
+            }
+            ensureInterfaceBatchCapacity(jniEnv);
+            jobject objs[kInterfaceBatchSize];
+            JniInterface<typename CppType::element_type, T>::toJavaBatch(jniEnv, m_values, m_count, objs);
+            // Take ownership of all the references first, so none leak if the sink throws.
+            LocalRef<jobject> refs[kInterfaceBatchSize];
+            for(size_t k = 0; k < m_count; ++k)
+            {
+                refs[k] = LocalRef<jobject>(jniEnv, objs[k]);
+            }
+            const size_t count = m_count;
+            m_count = 0;
+            for(size_t k = 0; k < count; ++k)
+            {
+                sink(k, std::move(refs[k]));
+            }
+        }
+
+    private:
+        const CppType* m_values[kInterfaceBatchSize];
+        size_t m_count = 0;
+    };
+
+    // Adds the interface elements of `c` to the Java collection `j`, converting them in batches.
+    template <class T, class C>
+    void addInterfaces(JNIEnv* jniEnv, const C& c, const LocalRef<jobject>& j, jmethodID method_add)
+    {
+        InterfaceBatchFromCpp<T> batch;
+        auto sink = [&](size_t, LocalRef<jobject> je)
+        {
+            jniEnv->CallBooleanMethod(j, method_add, je.get());
+            jniExceptionCheck(jniEnv);
+        };
+        for(const auto& ce : c)
+        {
+            batch.add(ce);
+            if(batch.full())
+            {
+                batch.flush(jniEnv, sink);
+            }
+        }
+        batch.flush(jniEnv, sink);
+    }
+
+    /*
+     * Lists of primitives are unboxed into (or boxed from) a primitive array on the Java side
+     * by com.snapchat.djinni.PrimitiveLists, so that each conversion is one call and one array
+     * copy rather than two calls per element.
+     */
+    template <class T, class = void>
+    struct IsJniPrimitive : std::false_type {};
+
+    template <class T>
+    struct IsJniPrimitive<T, std::enable_if_t<
+        std::is_base_of<Primitive<T, typename T::CppType, typename T::JniType>, T>::value>>
+        : std::true_type {};
+
+    template <class T> struct PrimitiveListMethods;
+    template <> struct PrimitiveListMethods<Bool>
+    {
+        static constexpr const char* toArray = "toBooleanArray";
+        static constexpr const char* arrayType = "[Z";
+    };
+    template <> struct PrimitiveListMethods<I8>
+    {
+        static constexpr const char* toArray = "toByteArray";
+        static constexpr const char* arrayType = "[B";
+    };
+    template <> struct PrimitiveListMethods<I16>
+    {
+        static constexpr const char* toArray = "toShortArray";
+        static constexpr const char* arrayType = "[S";
+    };
+    template <> struct PrimitiveListMethods<I32>
+    {
+        static constexpr const char* toArray = "toIntArray";
+        static constexpr const char* arrayType = "[I";
+    };
+    template <> struct PrimitiveListMethods<I64>
+    {
+        static constexpr const char* toArray = "toLongArray";
+        static constexpr const char* arrayType = "[J";
+    };
+    template <> struct PrimitiveListMethods<F32>
+    {
+        static constexpr const char* toArray = "toFloatArray";
+        static constexpr const char* arrayType = "[F";
+    };
+    template <> struct PrimitiveListMethods<F64>
+    {
+        static constexpr const char* toArray = "toDoubleArray";
+        static constexpr const char* arrayType = "[D";
+    };
+
+    template <class T>
+    struct PrimitiveListJniInfo
+    {
+        const GlobalRef<jclass> clazz { jniFindClass("com/snapchat/djinni/PrimitiveLists") };
+        const jmethodID method_to_array { jniGetStaticMethodID(clazz.get(), PrimitiveListMethods<T>::toArray,
+            (std::string("(Ljava/util/ArrayList;)") + PrimitiveListMethods<T>::arrayType).c_str()) };
+        const jmethodID method_from_array { jniGetStaticMethodID(clazz.get(), "fromArray",
+            (std::string("(") + PrimitiveListMethods<T>::arrayType + ")Ljava/util/ArrayList;").c_str()) };
+    };
+
+    // Generated helpers of records whose fields are all primitives or enums declare kPackedFields,
+    // along with pack/unpack for a single record and packList/unpackList, which convert a Java
+    // list of them to and from a long[] holding kPackedFields slots per record.
+    template <class T, class = void>
+    struct IsJniPackedRecord : std::false_type {};
+
+    template <class T>
+    struct IsJniPackedRecord<T, std::void_t<decltype(T::kPackedFields)>> : std::true_type {};
+
+    // Defined below; only the primitive specializations are used here, which ignore ClassNameT.
+    template <class T, class ClassNameT>
+    class Array;
+
     struct ListJniInfo
     {
         const GlobalRef<jclass> clazz { jniFindClass("java/util/ArrayList") };
@@ -358,10 +703,67 @@ namespace djinni
             assert(j != nullptr);
             const auto& data = JniClass<ListJniInfo>::get();
             assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
+            if constexpr (IsJniPrimitive<T>::value)
+            {
+                const auto& lists = JniClass<PrimitiveListJniInfo<T>>::get();
+                auto ja = LocalRef<jobject>(jniEnv, jniEnv->CallStaticObjectMethod(lists.clazz.get(), lists.method_to_array, j));
+                jniExceptionCheck(jniEnv);
+                return Array<T, void>::toCpp(jniEnv, ja.get());
+            }
+            if constexpr (IsJniPackedRecord<T>::value)
+            {
+                auto ja = T::packList(jniEnv, j);
+                auto size = jniEnv->GetArrayLength(ja.get());
+                auto c = CppType();
+                if (size == 0) {
+                    return c;
+                }
+                c.reserve(size / T::kPackedFields);
+                // A chunk need not end on a record boundary: the slots of a record that
+                // straddles two chunks are gathered in `record` first.
+                jlong record[T::kPackedFields];
+                jsize filled = 0;
+                jniReadArray<jlong>(jniEnv, ja.get(), size, [&] (const jlong* data, jsize count) {
+                    jsize i = 0;
+                    if (filled > 0) {
+                        i = std::min<jsize>(T::kPackedFields - filled, count);
+                        std::copy(data, data + i, record + filled);
+                        filled += i;
+                        if (filled < static_cast<jsize>(T::kPackedFields)) {
+                            return;
+                        }
+                        c.push_back(T::unpack(record));
+                        filled = 0;
+                    }
+                    for(; i + static_cast<jsize>(T::kPackedFields) <= count; i += T::kPackedFields)
+                    {
+                        c.push_back(T::unpack(data + i));
+                    }
+                    filled = count - i;
+                    std::copy(data + i, data + count, record);
+                });
+                return c;
+            }
             auto size = jniEnv->CallIntMethod(j, data.method_size);
             jniExceptionCheck(jniEnv);
             auto c = CppType();
             c.reserve(size);
+            if constexpr (IsJniInterface<typename T::Boxed>::value)
+            {
+                InterfaceBatchToCpp<typename T::Boxed> batch;
+                auto sink = [&](size_t, ECppType&& e) { c.push_back(std::move(e)); };
+                for(jint i = 0; i < size; ++i)
+                {
+                    batch.add(jniEnv, LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_get, i)));
+                    jniExceptionCheck(jniEnv);
+                    if(batch.full())
+                    {
+                        batch.flush(jniEnv, sink);
+                    }
+                }
+                batch.flush(jniEnv, sink);
+                return c;
+            }
             for(jint i = 0; i < size; ++i)
             {
                 auto je = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_get, i));
@@ -373,11 +775,50 @@ namespace djinni
 
         static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
         {
-            const auto& data = JniClass<ListJniInfo>::get();
             assert(c.size() <= std::numeric_limits<jint>::max());
+            if constexpr (IsJniPrimitive<T>::value)
+            {
+                const auto& lists = JniClass<PrimitiveListJniInfo<T>>::get();
+                auto ja = Array<T, void>::fromCpp(jniEnv, c);
+                auto j = LocalRef<jobject>(jniEnv, jniEnv->CallStaticObjectMethod(lists.clazz.get(), lists.method_from_array, ja.get()));
+                jniExceptionCheck(jniEnv);
+                return j;
+            }
+            if constexpr (IsJniPackedRecord<T>::value)
+            {
+                assert(c.size() <= std::numeric_limits<jint>::max() / T::kPackedFields);
+                const auto length = static_cast<jsize>(c.size() * T::kPackedFields);
+                auto ja = LocalRef<jlongArray>(jniEnv, jniEnv->NewLongArray(length));
+                jniExceptionCheck(jniEnv);
+                jniWriteArray<jlong>(jniEnv, ja.get(), length, [&c] (jlong* out, jsize start, jsize count) {
+                    // Records cut by either end of the chunk are packed aside and only their
+                    // slots inside the chunk are copied.
+                    jlong record[T::kPackedFields];
+                    for(jsize slot = start; slot < start + count;)
+                    {
+                        const auto& ce = c[slot / T::kPackedFields];
+                        const jsize field = slot % T::kPackedFields;
+                        const jsize n = std::min<jsize>(T::kPackedFields - field, start + count - slot);
+                        if (n == static_cast<jsize>(T::kPackedFields)) {
+                            T::pack(ce, out + (slot - start));
+                        } else {
+                            T::pack(ce, record);
+                            std::copy(record + field, record + field + n, out + (slot - start));
+                        }
+                        slot += n;
+                    }
+                });
+                return T::unpackList(jniEnv, ja.get());
+            }
+            const auto& data = JniClass<ListJniInfo>::get();
             auto size = static_cast<jint>(c.size());
             auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, size));
             jniExceptionCheck(jniEnv);
+            if constexpr (IsJniInterface<typename T::Boxed>::value)
+            {
+                addInterfaces<typename T::Boxed>(jniEnv, c, j, data.method_add);
+                return j;
+            }
             for(const auto& ce : c)
             {
                 auto je = T::Boxed::fromCpp(jniEnv, ce);
@@ -388,26 +829,137 @@ namespace djinni
         }
     };
 
-    struct IteratorJniInfo
+    /*
+     * Maps and sets are flattened into arrays (and built back from them) on the Java side by
+     * com.snapchat.djinni.CollectionArrays, so that each conversion is one call plus array
+     * accesses rather than an iterator call, getKey()/getValue() or put() per entry. Elements of
+     * a primitive type travel in a primitive array, named by the element character of its type
+     * signature; anything else travels in an Object[].
+     */
+    template <class T>
+    constexpr jchar jniArrayKind()
+    {
+        if constexpr (IsJniPrimitive<T>::value)
+        {
+            return static_cast<jchar>(PrimitiveListMethods<T>::arrayType[1]);
+        }
+        else
+        {
+            return 'L';
+        }
+    }
+
+    struct CollectionArraysJniInfo
     {
-        const GlobalRef<jclass> clazz { jniFindClass("java/util/Iterator") };
-        const jmethodID method_next { jniGetMethodID(clazz.get(), "next", "()Ljava/lang/Object;") };
+        const GlobalRef<jclass> clazz { jniFindClass("com/snapchat/djinni/CollectionArrays") };
+        const GlobalRef<jclass> objectClazz { jniFindClass("java/lang/Object") };
+        const jmethodID method_set_to_array { jniGetStaticMethodID(clazz.get(), "toArray", "(Ljava/util/HashSet;C)Ljava/lang/Object;") };
+        const jmethodID method_set_from_array { jniGetStaticMethodID(clazz.get(), "fromArray", "(Ljava/lang/Object;C)Ljava/util/HashSet;") };
+        const jmethodID method_map_to_arrays { jniGetStaticMethodID(clazz.get(), "toArrays", "(Ljava/util/HashMap;CC)[Ljava/lang/Object;") };
+        const jmethodID method_map_from_arrays { jniGetStaticMethodID(clazz.get(), "fromArrays", "(Ljava/lang/Object;CLjava/lang/Object;C)Ljava/util/HashMap;") };
     };
 
+    // Converts the elements of an array made by CollectionArrays, calling `sink(value)` for each in order.
+    template <class T, class F>
+    void collectionArrayToCpp(JNIEnv* jniEnv, jobject ja, F&& sink)
+    {
+        using ECppType = typename T::CppType;
+        using EJniType = typename T::Boxed::JniType;
+        if constexpr (IsJniPrimitive<T>::value)
+        {
+            for(auto&& e : Array<T, void>::toCpp(jniEnv, ja))
+            {
+                sink(ECppType(e));
+            }
+        }
+        else
+        {
+            auto arr = static_cast<jobjectArray>(ja);
+            const jsize size = jniEnv->GetArrayLength(arr);
+            if constexpr (IsJniInterface<typename T::Boxed>::value)
+            {
+                InterfaceBatchToCpp<typename T::Boxed> batch;
+                auto batchSink = [&](size_t, ECppType&& e) { sink(std::move(e)); };
+                for(jsize i = 0; i < size; ++i)
+                {
+                    batch.add(jniEnv, LocalRef<jobject>(jniEnv, jniEnv->GetObjectArrayElement(arr, i)));
+                    jniExceptionCheck(jniEnv);
+                    if(batch.full())
+                    {
+                        batch.flush(jniEnv, batchSink);
+                    }
+                }
+                batch.flush(jniEnv, batchSink);
+            }
+            else
+            {
+                for(jsize i = 0; i < size; ++i)
+                {
+                    auto je = LocalRef<jobject>(jniEnv, jniEnv->GetObjectArrayElement(arr, i));
+                    jniExceptionCheck(jniEnv);
+                    sink(T::Boxed::toCpp(jniEnv, static_cast<EJniType>(je.get())));
+                }
+            }
+        }
+    }
+
+    // Builds an array for CollectionArrays from `proj(ce)` for each element `ce` of `c`.
+    template <class T, class C, class P>
+    LocalRef<jobject> collectionArrayFromCpp(JNIEnv* jniEnv, const C& c, P&& proj)
+    {
+        using ECppType = typename T::CppType;
+        if constexpr (IsJniPrimitive<T>::value)
+        {
+            std::vector<ECppType> values;
+            values.reserve(c.size());
+            for(const auto& ce : c)
+            {
+                values.push_back(proj(ce));
+            }
+            return LocalRef<jobject>(jniEnv, Array<T, void>::fromCpp(jniEnv, values).release());
+        }
+        else
+        {
+            const auto& data = JniClass<CollectionArraysJniInfo>::get();
+            auto ja = LocalRef<jobjectArray>(jniEnv, jniEnv->NewObjectArray(static_cast<jsize>(c.size()), data.objectClazz.get(), nullptr));
+            jniExceptionCheck(jniEnv);
+            jsize i = 0;
+            if constexpr (IsJniInterface<typename T::Boxed>::value)
+            {
+                InterfaceBatchFromCpp<typename T::Boxed> batch;
+                auto sink = [&](size_t, LocalRef<jobject> je) { jniEnv->SetObjectArrayElement(ja.get(), i++, je.get()); };
+                for(const auto& ce : c)
+                {
+                    batch.add(proj(ce));
+                    if(batch.full())
+                    {
+                        batch.flush(jniEnv, sink);
+                    }
+                }
+                batch.flush(jniEnv, sink);
+            }
+            else
+            {
+                for(const auto& ce : c)
+                {
+                    auto je = T::Boxed::fromCpp(jniEnv, proj(ce));
+                    jniEnv->SetObjectArrayElement(ja.get(), i++, get(je));
+                }
+            }
+            jniExceptionCheck(jniEnv);
+            return LocalRef<jobject>(jniEnv, ja.release());
+        }
+    }
+
     struct SetJniInfo
     {
         const GlobalRef<jclass> clazz { jniFindClass("java/util/HashSet") };
-        const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "()V") };
-        const jmethodID method_add { jniGetMethodID(clazz.get(), "add", "(Ljava/lang/Object;)Z") };
-        const jmethodID method_size { jniGetMethodID(clazz.get(), "size", "()I") };
-        const jmethodID method_iterator { jniGetMethodID(clazz.get(), "iterator", "()Ljava/util/Iterator;") };
     };
 
     template <class T>
     class Set
     {
         using ECppType = typename T::CppType;
-        using EJniType = typename T::Boxed::JniType;
 
     public:
         using CppType = std::unordered_set<ECppType>;
@@ -418,36 +970,23 @@ namespace djinni
         static CppType toCpp(JNIEnv* jniEnv, JniType j)
         {
             assert(j != nullptr);
-            const auto& data = JniClass<SetJniInfo>::get();
-            const auto& iteData = JniClass<IteratorJniInfo>::get();
-            assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
-            auto size = jniEnv->CallIntMethod(j, data.method_size);
+            const auto& data = JniClass<CollectionArraysJniInfo>::get();
+            assert(jniEnv->IsInstanceOf(j, JniClass<SetJniInfo>::get().clazz.get()));
+            auto ja = LocalRef<jobject>(jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_set_to_array, j, jniArrayKind<T>()));
             jniExceptionCheck(jniEnv);
             auto c = CppType();
-            auto it = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_iterator));
-            jniExceptionCheck(jniEnv);
-            for(jint i = 0; i < size; ++i)
-            {
-                auto je = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(it, iteData.method_next));
-                jniExceptionCheck(jniEnv);
-                c.insert(T::Boxed::toCpp(jniEnv, static_cast<EJniType>(je.get())));
-            }
+            c.reserve(jniEnv->GetArrayLength(static_cast<jarray>(ja.get())));
+            collectionArrayToCpp<T>(jniEnv, ja.get(), [&](ECppType&& e) { c.insert(std::move(e)); });
             return c;
         }
 
         static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
         {
-            const auto& data = JniClass<SetJniInfo>::get();
+            const auto& data = JniClass<CollectionArraysJniInfo>::get();
             assert(c.size() <= std::numeric_limits<jint>::max());
-            auto size = static_cast<jint>(c.size());
-            auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, size));
+            auto ja = collectionArrayFromCpp<T>(jniEnv, c, [](const ECppType& ce) -> const ECppType& { return ce; });
+            auto j = LocalRef<jobject>(jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_set_from_array, ja.get(), jniArrayKind<T>()));
             jniExceptionCheck(jniEnv);
-            for(const auto& ce : c)
-            {
-                auto je = T::Boxed::fromCpp(jniEnv, ce);
-                jniEnv->CallBooleanMethod(j, data.method_add, get(je));
-                jniExceptionCheck(jniEnv);
-            }
             return j;
         }
     };
@@ -455,23 +994,6 @@ namespace djinni
     struct MapJniInfo
     {
         const GlobalRef<jclass> clazz { jniFindClass("java/util/HashMap") };
-        const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "()V") };
-        const jmethodID method_put { jniGetMethodID(clazz.get(), "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;") };
-        const jmethodID method_size { jniGetMethodID(clazz.get(), "size", "()I") };
-        const jmethodID method_entrySet { jniGetMethodID(clazz.get(), "entrySet", "()Ljava/util/Set;") };
-    };
-
-    struct EntrySetJniInfo
-    {
-        const GlobalRef<jclass> clazz { jniFindClass("java/util/Set") };
-        const jmethodID method_iterator { jniGetMethodID(clazz.get(), "iterator", "()Ljava/util/Iterator;") };
-    };
-
-    struct EntryJniInfo
-    {
-        const GlobalRef<jclass> clazz { jniFindClass("java/util/Map$Entry") };
-        const jmethodID method_getKey { jniGetMethodID(clazz.get(), "getKey", "()Ljava/lang/Object;") };
-        const jmethodID method_getValue { jniGetMethodID(clazz.get(), "getValue", "()Ljava/lang/Object;") };
     };
 
     template <class Key, class Value>
@@ -479,8 +1001,6 @@ namespace djinni
     {
         using CppKeyType = typename Key::CppType;
         using CppValueType = typename Value::CppType;
-        using JniKeyType = typename Key::Boxed::JniType;
-        using JniValueType = typename Value::Boxed::JniType;
 
     public:
         using CppType = std::unordered_map<CppKeyType, CppValueType>;
@@ -491,47 +1011,40 @@ namespace djinni
         static CppType toCpp(JNIEnv* jniEnv, JniType j)
         {
             assert(j != nullptr);
-            const auto& data = JniClass<MapJniInfo>::get();
-            const auto& entrySetData = JniClass<EntrySetJniInfo>::get();
-            const auto& entryData = JniClass<EntryJniInfo>::get();
-            const auto& iteData = JniClass<IteratorJniInfo>::get();
-            assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
-            auto size = jniEnv->CallIntMethod(j, data.method_size);
+            const auto& data = JniClass<CollectionArraysJniInfo>::get();
+            assert(jniEnv->IsInstanceOf(j, JniClass<MapJniInfo>::get().clazz.get()));
+            auto jarrays = LocalRef<jobjectArray>(jniEnv, static_cast<jobjectArray>(jniEnv->CallStaticObjectMethod(
+                data.clazz.get(), data.method_map_to_arrays, j, jniArrayKind<Key>(), jniArrayKind<Value>())));
+            jniExceptionCheck(jniEnv);
+            auto jKeys = LocalRef<jobject>(jniEnv, jniEnv->GetObjectArrayElement(jarrays.get(), 0));
             jniExceptionCheck(jniEnv);
-            auto entrySet = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_entrySet));
+            auto jValues = LocalRef<jobject>(jniEnv, jniEnv->GetObjectArrayElement(jarrays.get(), 1));
             jniExceptionCheck(jniEnv);
+            const auto size = static_cast<size_t>(jniEnv->GetArrayLength(static_cast<jarray>(jKeys.get())));
+            // The keys are converted first and wait in a vector, in the same order as the values.
+            std::vector<CppKeyType> keys;
+            keys.reserve(size);
+            collectionArrayToCpp<Key>(jniEnv, jKeys.get(), [&](CppKeyType&& key) { keys.push_back(std::move(key)); });
             auto c = CppType();
             c.reserve(size);
-            auto it = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(entrySet, entrySetData.method_iterator));
-            jniExceptionCheck(jniEnv);
-            for(jint i = 0; i < size; ++i)
+            size_t i = 0;
+            collectionArrayToCpp<Value>(jniEnv, jValues.get(), [&](CppValueType&& value)
             {
-                auto je = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(it, iteData.method_next));
-                jniExceptionCheck(jniEnv);
-                auto jKey = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(je, entryData.method_getKey));
-                jniExceptionCheck(jniEnv);
-                auto jValue = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(je, entryData.method_getValue));
-                jniExceptionCheck(jniEnv);
-                c.emplace(Key::Boxed::toCpp(jniEnv, static_cast<JniKeyType>(jKey.get())),
-                          Value::Boxed::toCpp(jniEnv, static_cast<JniValueType>(jValue.get())));
-            }
+                c.emplace(std::move(keys[i++]), std::move(value));
+            });
             return c;
         }
 
         static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
         {
-            const auto& data = JniClass<MapJniInfo>::get();
+            const auto& data = JniClass<CollectionArraysJniInfo>::get();
             assert(c.size() <= std::numeric_limits<jint>::max());
-            auto size = c.size();
-            auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, size));
+            // Both arrays come from iterating the same unmodified container, so their orders match.
+            auto jKeys = collectionArrayFromCpp<Key>(jniEnv, c, [](const auto& ce) -> const CppKeyType& { return ce.first; });
+            auto jValues = collectionArrayFromCpp<Value>(jniEnv, c, [](const auto& ce) -> const CppValueType& { return ce.second; });
+            auto j = LocalRef<jobject>(jniEnv, jniEnv->CallStaticObjectMethod(
+                data.clazz.get(), data.method_map_from_arrays, jKeys.get(), jniArrayKind<Key>(), jValues.get(), jniArrayKind<Value>()));
             jniExceptionCheck(jniEnv);
-            for(const auto& ce : c)
-            {
-                auto jKey = Key::Boxed::fromCpp(jniEnv, ce.first);
-                auto jValue = Value::Boxed::fromCpp(jniEnv, ce.second);
-                jniEnv->CallObjectMethod(j, data.method_put, get(jKey), get(jValue));
-                jniExceptionCheck(jniEnv);
-            }
             return j;
         }
     };
@@ -553,6 +1066,57 @@ namespace djinni
         }
     };
 
+    // Serializer for Protobuf<> that keeps large messages off the Java heap. Select it with
+    // `jni_class: '::djinni::GpbMessageLiteDirectSerializer'` under `java:` in the protobuf yaml.
+    // A message of at least jniGetDirectProtobufThreshold() bytes is written by Java's
+    // CodedOutputStream straight into a direct ByteBuffer over a JniScratchBuffer and parsed by
+    // C++ in place. In the other direction C++ serializes into scratch memory, and Java parses it
+    // through CodedInputStream. Smaller messages use the byte[] path inherited from
+    // GpbMessageLiteSerializer.
+    struct GpbMessageLiteDirectSerializer : GpbMessageLiteSerializer
+    {
+        static constexpr bool usesDirectBuffers = true;
+
+        const jmethodID method_get_serialized_size { jniGetMethodID(clazz.get(), "getSerializedSize", "()I") };
+        const jmethodID method_write_to { jniGetMethodID(clazz.get(), "writeTo", "(Lcom/google/protobuf/CodedOutputStream;)V") };
+        const GlobalRef<jclass> outputClazz { jniFindClass("com/google/protobuf/CodedOutputStream") };
+        const jmethodID method_new_output { jniGetStaticMethodID(outputClazz.get(), "newInstance", "(Ljava/nio/ByteBuffer;)Lcom/google/protobuf/CodedOutputStream;") };
+        const jmethodID method_flush { jniGetMethodID(outputClazz.get(), "flush", "()V") };
+        const GlobalRef<jclass> inputClazz { jniFindClass("com/google/protobuf/CodedInputStream") };
+        const jmethodID method_new_input { jniGetStaticMethodID(inputClazz.get(), "newInstance", "(Ljava/nio/ByteBuffer;)Lcom/google/protobuf/CodedInputStream;") };
+
+        // Signature of the static parseFrom() that deserializeJavaProto() calls on direct buffers
+        static constexpr const char* parseFromArgs = "(Lcom/google/protobuf/CodedInputStream;)";
+
+        using GpbMessageLiteSerializer::serializeJavaProto;
+        using GpbMessageLiteSerializer::deserializeJavaProto;
+
+        jint serializedSize(JNIEnv* jniEnv, jobject jproto) const {
+            return jniEnv->CallIntMethod(jproto, method_get_serialized_size);
+        }
+
+        // Writes the message to the start of directBuf, which must have room for serializedSize()
+        void serializeJavaProto(JNIEnv* jniEnv, jobject jproto, jobject directBuf) const {
+            auto output = LocalRef<jobject>(jniEnv, jniEnv->CallStaticObjectMethod(outputClazz.get(), method_new_output, directBuf));
+            jniExceptionCheck(jniEnv);
+            jniEnv->CallVoidMethod(jproto, method_write_to, output.get());
+            jniExceptionCheck(jniEnv);
+            jniEnv->CallVoidMethod(output.get(), method_flush);
+        }
+
+        jobject deserializeJavaProto(JNIEnv* jniEnv, jobject directBuf, jclass protoClazz, jmethodID parseFrom) const {
+            auto input = LocalRef<jobject>(jniEnv, jniEnv->CallStaticObjectMethod(inputClazz.get(), method_new_input, directBuf));
+            jniExceptionCheck(jniEnv);
+            return jniEnv->CallStaticObjectMethod(protoClazz, parseFrom, input.get());
+        }
+    };
+
+    template<typename JAVA_SERIALIZER, typename = void>
+    struct JniSerializerUsesDirectBuffers : std::false_type {};
+    template<typename JAVA_SERIALIZER>
+    struct JniSerializerUsesDirectBuffers<JAVA_SERIALIZER, std::void_t<decltype(JAVA_SERIALIZER::usesDirectBuffers)>>
+        : std::integral_constant<bool, JAVA_SERIALIZER::usesDirectBuffers> {};
+
     // Helper class to carry a Java class name in a type.
     // This is passed to the JAVA_PROTO parameter of Protobuf<> below.
     template<char... chars>
@@ -581,9 +1145,31 @@ namespace djinni
         static CppType toCpp(JNIEnv* jniEnv, JniType j)
         {
             CPP_PROTO ret;
+            parseInto(jniEnv, j, ret);
+            return ret;
+        }
 
-            // Call message.toByteArray() through JNI
+        // Parses the Java message j into ret, which may live on an arena (see ArenaProtobuf)
+        static void parseInto(JNIEnv* jniEnv, JniType j, CPP_PROTO& ret)
+        {
             const auto& msgcls = JniClass<JAVA_SERIALIZER>::get();
+            if constexpr (JniSerializerUsesDirectBuffers<JAVA_SERIALIZER>::value) {
+                const jint size = msgcls.serializedSize(jniEnv, j);
+                jniExceptionCheck(jniEnv);
+                if (size > 0 && static_cast<size_t>(size) >= jniGetDirectProtobufThreshold()) {
+                    JniScratchBuffer scratch(static_cast<size_t>(size));
+                    auto buf = LocalRef<jobject>(jniEnv, jniEnv->NewDirectByteBuffer(scratch.data(), size));
+                    jniExceptionCheck(jniEnv);
+                    msgcls.serializeJavaProto(jniEnv, j, buf.get());
+                    jniExceptionCheck(jniEnv);
+                    [[maybe_unused]]
+                    bool success = ret.ParseFromArray(scratch.data(), size);
+                    assert(success);
+                    return;
+                }
+            }
+
+            // Call message.toByteArray() through JNI
             auto bytes = LocalRef<jbyteArray>(jniEnv, msgcls.serializeJavaProto(jniEnv, j));
             jniExceptionCheck(jniEnv);
 
@@ -591,7 +1177,17 @@ namespace djinni
             jsize length = jniEnv->GetArrayLength(bytes);
             jniExceptionCheck(jniEnv);
             if (length == 0) {
-                return ret;
+                return;
+            }
+
+            // Small messages are parsed straight out of the pinned array; bigger ones are copied
+            // out a chunk at a time first, so the GC isn't held off for the whole parse.
+            if (!jniUseCriticalCopy<jbyte>(length)) {
+                const auto copy = Binary::toCpp(jniEnv, bytes.get());
+                [[maybe_unused]]
+                bool success = ret.ParseFromArray(copy.data(), static_cast<int>(copy.size()));
+                assert(success);
+                return;
             }
 
             // Get a pointer into the bytes
@@ -604,12 +1200,26 @@ namespace djinni
             [[maybe_unused]]
             bool success = ret.ParseFromArray(ptr.get(), static_cast<int>(length));
             assert(success);
-            
-            return ret;
         }
         
         static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
         {
+            if constexpr (JniSerializerUsesDirectBuffers<JAVA_SERIALIZER>::value) {
+                const size_t size = c.ByteSizeLong();
+                if (size > 0 && size >= jniGetDirectProtobufThreshold()) {
+                    // Serialize into scratch memory, which Java only reads during parseFrom()
+                    JniScratchBuffer scratch(size);
+                    c.SerializeWithCachedSizesToArray(scratch.data());
+                    auto buf = LocalRef<jobject>(jniEnv, jniEnv->NewDirectByteBuffer(scratch.data(), static_cast<jlong>(size)));
+                    jniExceptionCheck(jniEnv);
+                    const auto& parser = JniClass<JavaParser>::get();
+                    auto ret = JniClass<JAVA_SERIALIZER>::get().deserializeJavaProto(
+                        jniEnv, buf.get(), parser.clazz.get(), parser.method_parse_from);
+                    jniExceptionCheck(jniEnv);
+                    return {jniEnv, ret};
+                }
+            }
+
             // Serialize to C++ vector
             std::vector<uint8_t> cppBuf(c.ByteSizeLong());
             LocalRef<jobject> javaBuf;
@@ -634,6 +1244,14 @@ namespace djinni
             jniExceptionCheck(jniEnv);
             return {jniEnv, ret};
         }
+
+    private:
+        // The message class and its parseFrom() for direct buffers, looked up once
+        struct JavaParser {
+            const GlobalRef<jclass> clazz { jniFindClass(JAVA_PROTO::name()) };
+            const jmethodID method_parse_from { jniGetStaticMethodID(clazz.get(), "parseFrom",
+                (std::string(JAVA_SERIALIZER::parseFromArgs) + "L" + JAVA_PROTO::name() + ";").c_str()) };
+        };
     };
 
     // Base template, covers non-primitive types (boxed arrays)
@@ -694,30 +1312,23 @@ namespace djinni
         {
             auto arr = static_cast<jarray>(j);
             auto size = jniEnv->GetArrayLength(arr);
+            CppType c;
             if (size == 0) {
-                return {};
+                return c;
             }
-            auto deleter = [jniEnv, arr] (void* c) {if (c) {jniEnv->ReleasePrimitiveArrayCritical(arr, c, JNI_ABORT);}};
-            std::unique_ptr<EJniType, decltype(deleter)> ptr(
-                reinterpret_cast<EJniType*>(jniEnv->GetPrimitiveArrayCritical(arr, nullptr)),
-                deleter);
-            if (!ptr) {
-                jniExceptionCheck(jniEnv);
-                return {};
-            }
-            return CppType{ptr.get(), ptr.get() + size};
+            c.reserve(size);
+            jniReadArray<EJniType>(jniEnv, arr, size, [&c] (const EJniType* data, jsize count) {
+                c.insert(c.end(), data, data + count);
+            });
+            return c;
         }
 
         static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
         {
             auto j = T::makePrimitiveArray(jniEnv, static_cast<jint>(c.size()));
-            if (c.size() > 0) {
-                auto deleter = [jniEnv, j] (void* c) {if (c) {jniEnv->ReleasePrimitiveArrayCritical(j, c, 0);}};
-                std::unique_ptr<EJniType, decltype(deleter)> ptr(
-                    reinterpret_cast<EJniType*>(jniEnv->GetPrimitiveArrayCritical(j, nullptr)),
-                    deleter);
-                std::copy(c.begin(), c.end(), ptr.get());
-            }
+            jniWriteArray<EJniType>(jniEnv, j, static_cast<jsize>(c.size()), [&c] (EJniType* out, jsize start, jsize count) {
+                std::copy(c.begin() + start, c.begin() + start + count, out);
+            });
             return LocalRef<JniType>(jniEnv, static_cast<JniType>(j));
         }
     };
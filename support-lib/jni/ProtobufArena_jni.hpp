@@ -0,0 +1,43 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#pragma once
+
+#include "Marshal.hpp"
+#include "../cpp/ProtobufArena.hpp"
+
+namespace djinni {
+
+// Protobuf<> that parses into the thread's ProtobufArenaScope. Generated code uses it for the
+// parameters of C++ methods whose type is a message with `arena: true` under `cpp:` in its
+// manifest (or any message, with --cpp-protobuf-arena). Only toCpp() differs; the C++ method
+// sees a `const CPP_PROTO&` that lives until it returns. Messages inside containers, optionals
+// and records, and those returned by Java, still go through Protobuf<>: they end up in an owned
+// value, which the arena would only add a copy to.
+template<typename CPP_PROTO, typename JAVA_PROTO, typename JAVA_SERIALIZER = GpbMessageLiteSerializer>
+class ArenaProtobuf : public Protobuf<CPP_PROTO, JAVA_PROTO, JAVA_SERIALIZER> {
+public:
+    using Boxed = ArenaProtobuf;
+
+    static ArenaMessage<CPP_PROTO> toCpp(JNIEnv* jniEnv, jobject j)
+    {
+        ArenaMessage<CPP_PROTO> ret;
+        Protobuf<CPP_PROTO, JAVA_PROTO, JAVA_SERIALIZER>::parseInto(jniEnv, j, ret.get());
+        return ret;
+    }
+};
+
+} // namespace djinni
@@ -0,0 +1,63 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#include "djinni_support.hpp"
+
+namespace djinni {
+
+struct ProxyCacheCountersClassInfo {
+    const GlobalRef<jclass> clazz { jniFindClass("com/snapchat/djinni/ProxyCacheCounters") };
+    const jmethodID constructor {
+        jniGetMethodID(clazz.get(), "<init>", "(Ljava/lang/String;JJJJJJJJ)V") };
+};
+
+// NOLINTNEXTLINE
+static jobjectArray ProxyCacheCounters_nativeGet(JNIEnv* jniEnv, jclass /*unused*/, jboolean cppObjects) {
+    try {
+        const auto counters = cppObjects ? JniCppProxyCache::counters() : JavaProxyCache::counters();
+        const auto & info = JniClass<ProxyCacheCountersClassInfo>::get();
+        auto j = LocalRef<jobjectArray>(jniEnv, jniEnv->NewObjectArray(
+            static_cast<jsize>(counters.size()), info.clazz.get(), nullptr));
+        jniExceptionCheck(jniEnv);
+        jsize i = 0;
+        for (const auto & kv : counters) {
+            const ProxyCacheCounters & c = kv.second;
+            LocalRef<jstring> type(jniEnv, jniStringFromUTF8(jniEnv, kv.first));
+            LocalRef<jobject> jc(jniEnv, jniEnv->NewObject(
+                info.clazz.get(), info.constructor, type.get(),
+                static_cast<jlong>(c.hits), static_cast<jlong>(c.misses),
+                static_cast<jlong>(c.expired_prunes), static_cast<jlong>(c.removes),
+                static_cast<jlong>(c.remove_races), static_cast<jlong>(c.deferred_removes),
+                static_cast<jlong>(c.lock_contentions), static_cast<jlong>(c.lock_wait_ns)));
+            jniExceptionCheck(jniEnv);
+            jniEnv->SetObjectArrayElement(j.get(), i++, jc.get());
+            jniExceptionCheck(jniEnv);
+        }
+        return j.release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+static const JNINativeMethod kNativeMethods[] = {{
+    const_cast<char*>("nativeGet"),
+    const_cast<char*>("(Z)[Lcom/snapchat/djinni/ProxyCacheCounters;"),
+    reinterpret_cast<void*>(&ProxyCacheCounters_nativeGet),
+}};
+
+// NOLINTNEXTLINE
+static auto sRegisterMethods =
+    JNIMethodLoadAutoRegister("com/snapchat/djinni/ProxyCacheCounters", kNativeMethods);
+
+} // namespace djinni
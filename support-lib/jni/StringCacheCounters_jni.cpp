@@ -0,0 +1,49 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#include "djinni_support.hpp"
+
+namespace djinni {
+
+struct StringCacheCountersClassInfo {
+    const GlobalRef<jclass> clazz { jniFindClass("com/snapchat/djinni/StringCacheCounters") };
+    const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(JJJ)V") };
+};
+
+// NOLINTNEXTLINE
+static jobject StringCacheCounters_nativeGet(JNIEnv* jniEnv, jclass /*unused*/) {
+    try {
+        const auto c = jniGetStringCacheCounters();
+        const auto & info = JniClass<StringCacheCountersClassInfo>::get();
+        auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(
+            info.clazz.get(), info.constructor, static_cast<jlong>(c.hits),
+            static_cast<jlong>(c.misses), static_cast<jlong>(c.evictions)));
+        jniExceptionCheck(jniEnv);
+        return j.release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+static const JNINativeMethod kNativeMethods[] = {{
+    const_cast<char*>("nativeGet"),
+    const_cast<char*>("()Lcom/snapchat/djinni/StringCacheCounters;"),
+    reinterpret_cast<void*>(&StringCacheCounters_nativeGet),
+}};
+
+// NOLINTNEXTLINE
+static auto sRegisterMethods =
+    JNIMethodLoadAutoRegister("com/snapchat/djinni/StringCacheCounters", kNativeMethods);
+
+} // namespace djinni
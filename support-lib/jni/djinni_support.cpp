@@ -18,12 +18,19 @@
 
 #include "../djinni_common.hpp"
 #include "djinni_support.hpp"
+#include "djinni_utf.hpp"
 #include "../proxy_cache_impl.hpp"
+#include "../cpp/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
-#include <locale>
-#include <codecvt>
+#include <list>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 static_assert(sizeof(jlong) >= sizeof(void*), "must be able to fit a void* into a jlong");
  
@@ -63,10 +70,32 @@ namespace djinni {
 // Set only once from JNI_OnLoad before any other JNI calls, so no lock needed.
 static JavaVM * g_cachedJVM;
 
+// Bumped by jniInit() and jniShutdown(), so that an env cached under an earlier VM is not
+// handed out again.
+static std::atomic<unsigned> g_jvmGeneration;
+
+// The JNIEnv of a thread that jniGetThreadEnv() attached itself. Such a thread stays attached
+// until onThreadExit() detaches it, so the pointer can be reused without asking the VM. Threads
+// attached by anyone else may be detached behind our back, so those still go through GetEnv.
+struct CachedThreadEnv {
+    JNIEnv * env;
+    unsigned generation;
+};
+static thread_local CachedThreadEnv t_cachedEnv;
+
+static JNIEnv * getCachedThreadEnv() {
+    const CachedThreadEnv & cached = t_cachedEnv;
+    if (cached.env && cached.generation == g_jvmGeneration.load(std::memory_order_relaxed)) {
+        return cached.env;
+    }
+    return nullptr;
+}
+
 static pthread_key_t threadExitCallbackKey;
 
 void onThreadExit(void*)
 {
+    t_cachedEnv.env = nullptr;
     g_cachedJVM->DetachCurrentThread();
 }
 
@@ -108,6 +137,7 @@ static auto& getMethodRecords() {
 
 void jniInit(JavaVM * jvm) {
     g_cachedJVM = jvm;
+    g_jvmGeneration.fetch_add(1, std::memory_order_relaxed);
 
     auto env = jniGetThreadEnv();
 
@@ -141,6 +171,11 @@ void jniInit(JavaVM * jvm) {
 
     createThreadDetachCallbackKey();
 
+    // Attach ThreadPool workers as soon as they start, so that calls into Java from pool
+    // tasks find a cached JNIEnv. They are detached by onThreadExit() like any other thread
+    // attached by jniGetThreadEnv().
+    ThreadPool::setWorkerInitializer([] { jniGetThreadEnv(); });
+
     try {
         for (const auto & initializer : JniClassInitializer::get_all()) {
             initializer();
@@ -161,14 +196,24 @@ void jniRegisterNatives(JNIEnv* env, const char* className, const JNINativeMetho
         env->RegisterNatives(clazz.get(), records, size);
 }
 
+static void clearStringCache();
+
 void jniShutdown() {
+    ThreadPool::setWorkerInitializer(nullptr);
+    clearStringCache();
     g_cachedJVM = nullptr;
+    g_jvmGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 JNIEnv * jniGetThreadEnv() {
+    if (JNIEnv * env = getCachedThreadEnv()) {
+        return env;
+    }
+
     assert(g_cachedJVM);
     JNIEnv * env = nullptr;
     jint get_res = g_cachedJVM->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
+    bool attached = false;
     if (get_res == JNI_EDETACHED) {
 #if defined(ANDROID) || defined(__ANDROID__)
         get_res = g_cachedJVM->AttachCurrentThread(&env, nullptr);
@@ -176,16 +221,90 @@ JNIEnv * jniGetThreadEnv() {
         get_res = g_cachedJVM->AttachCurrentThread(reinterpret_cast<void**>(&env), nullptr);
 #endif
         pthread_setspecific(threadExitCallbackKey, env);
+        attached = true;
     }
     if (get_res != 0 || !env) {
         // :(
         std::abort();
     }
 
+    if (attached) {
+        t_cachedEnv = { env, g_jvmGeneration.load(std::memory_order_relaxed) };
+    }
     return env;
 }
 
+static std::atomic<size_t> g_criticalCopyThreshold { 256 * 1024 };
+
+void jniSetCriticalCopyThreshold(size_t bytes) {
+    g_criticalCopyThreshold.store(bytes, std::memory_order_relaxed);
+}
+
+size_t jniGetCriticalCopyThreshold() {
+    return g_criticalCopyThreshold.load(std::memory_order_relaxed);
+}
+
+static std::atomic<size_t> g_directProtobufThreshold { 4 * 1024 };
+
+void jniSetDirectProtobufThreshold(size_t bytes) {
+    g_directProtobufThreshold.store(bytes, std::memory_order_relaxed);
+}
+
+size_t jniGetDirectProtobufThreshold() {
+    return g_directProtobufThreshold.load(std::memory_order_relaxed);
+}
+
+// Blocks bigger than this are freed instead of going back to the pool, and the pool keeps at
+// most this many, so an occasional huge message doesn't pin its memory for the thread's lifetime.
+static constexpr size_t kScratchBlockMaxBytes = 4 * 1024 * 1024;
+static constexpr size_t kScratchPoolMaxBlocks = 4;
+
+std::vector<JniScratchBuffer::Block> & JniScratchBuffer::freeBlocks() {
+    // Per thread, so leasing never takes a lock. Only native memory lives here, which is safe to
+    // free at thread exit without a JNIEnv.
+    thread_local std::vector<Block> blocks;
+    return blocks;
+}
+
+JniScratchBuffer::JniScratchBuffer(size_t size) {
+    auto & blocks = freeBlocks();
+    auto best = blocks.end();
+    for (auto it = blocks.begin(); it != blocks.end(); ++it) {
+        if (it->capacity >= size && (best == blocks.end() || it->capacity < best->capacity)) {
+            best = it;
+        }
+    }
+    if (best != blocks.end()) {
+        m_block = std::move(*best);
+        blocks.erase(best);
+        return;
+    }
+    // Round up to whole pages so that messages growing a little don't reallocate every time.
+    m_block.capacity = std::max<size_t>((size + 4095) & ~size_t(4095), 4096);
+    m_block.data.reset(new uint8_t[m_block.capacity]);
+}
+
+JniScratchBuffer::~JniScratchBuffer() {
+    if (!m_block.data || m_block.capacity > kScratchBlockMaxBytes) {
+        return;
+    }
+    auto & blocks = freeBlocks();
+    if (blocks.size() < kScratchPoolMaxBlocks) {
+        blocks.push_back(std::move(m_block));
+        return;
+    }
+    // The pool is full: keep the bigger blocks, which are the expensive ones to reallocate.
+    auto smallest = std::min_element(blocks.begin(), blocks.end(),
+                                     [] (const Block & a, const Block & b) { return a.capacity < b.capacity; });
+    if (smallest->capacity < m_block.capacity) {
+        *smallest = std::move(m_block);
+    }
+}
+
 static JNIEnv * getOptThreadEnv() {
+    if (JNIEnv * env = getCachedThreadEnv()) {
+        return env;
+    }
     if (!g_cachedJVM) {
         return nullptr;
     }
@@ -354,10 +473,38 @@ jfieldID jniGetFieldID(jclass clazz, const char * name, const char * sig) {
     return id;
 }
 
+// Calls the enum's values(), which returns a new copy of the constants array every time.
+static LocalRef<jobjectArray> jniCallEnumValues(JNIEnv * env, jclass clazz, const std::string & name) {
+    const jmethodID valuesMethod = jniGetStaticMethodID(clazz, "values", ("()[L" + name + ";").c_str());
+    LocalRef<jobjectArray> values(env, static_cast<jobjectArray>(env->CallStaticObjectMethod(clazz, valuesMethod)));
+    jniExceptionCheck(env);
+    DJINNI_ASSERT_NO_EXC_CHECK(values);
+    return values;
+}
+
+static std::vector<GlobalRef<jobject>> jniGetEnumValues(jclass clazz, const std::string & name) {
+    JNIEnv * env = jniGetThreadEnv();
+    const auto array = jniCallEnumValues(env, clazz, name);
+    const jsize size = env->GetArrayLength(array.get());
+    std::vector<GlobalRef<jobject>> result;
+    result.reserve(size);
+    for (jsize i = 0; i < size; ++i) {
+        LocalRef<jobject> value(env, env->GetObjectArrayElement(array.get(), i));
+        jniExceptionCheck(env);
+        result.emplace_back(env, value.get());
+    }
+    return result;
+}
+
+static GlobalRef<jobjectArray> jniGetEnumValuesArray(jclass clazz, const std::string & name) {
+    JNIEnv * env = jniGetThreadEnv();
+    return GlobalRef<jobjectArray>(env, jniCallEnumValues(env, clazz, name).get());
+}
+
 JniEnum::JniEnum(const std::string & name)
     : m_clazz { jniFindClass(name.c_str()) },
-      m_staticmethValues { jniGetStaticMethodID(m_clazz.get(), "values", ("()[L" + name + ";").c_str()) },
-      m_methOrdinal { jniGetMethodID(m_clazz.get(), "ordinal", "()I") }
+      m_methOrdinal { jniGetMethodID(m_clazz.get(), "ordinal", "()I") },
+      m_values { jniGetEnumValues(m_clazz.get(), name) }
     {}
 
 jint JniEnum::ordinal(JNIEnv * env, jobject obj) const {
@@ -368,47 +515,29 @@ jint JniEnum::ordinal(JNIEnv * env, jobject obj) const {
 }
 
 LocalRef<jobject> JniEnum::create(JNIEnv * env, jint value) const {
-    LocalRef<jobject> values(env, env->CallStaticObjectMethod(m_clazz.get(), m_staticmethValues));
-    jniExceptionCheck(env);
-    DJINNI_ASSERT_NO_EXC_CHECK(values);
-    LocalRef<jobject> result(env,
-                             env->GetObjectArrayElement(static_cast<jobjectArray>(values.get()),
-                                                        value));
-    jniExceptionCheck(env);
-    return result;
+    DJINNI_ASSERT(value >= 0 && static_cast<size_t>(value) < m_values.size(), env);
+    return LocalRef<jobject>(env, env->NewLocalRef(m_values[value].get()));
 }
 
 JniFlags::JniFlags(const std::string & name)
-    : JniEnum { name }
+    : JniEnum { name },
+      m_values { jniGetEnumValuesArray(enumClass(), name) }
     {}
 
 unsigned JniFlags::flags(JNIEnv * env, jobject obj) const {
-    DJINNI_ASSERT(obj && env->IsInstanceOf(obj, m_clazz.get()), env);
-    const auto size = env->CallIntMethod(obj, m_methSize);
-    jniExceptionCheck(env);
-    unsigned flags = 0;
-    auto it = LocalRef<jobject>(env, env->CallObjectMethod(obj, m_methIterator));
+    DJINNI_ASSERT_NO_EXC_CHECK(obj);
+    const jlong bits = env->CallStaticLongMethod(m_clazz.get(), m_methToBits, obj);
     jniExceptionCheck(env);
-    for(jint i = 0; i < size; ++i) {
-        auto jf = LocalRef<jobject>(env, env->CallObjectMethod(it, m_iterator.methNext));
-        jniExceptionCheck(env);
-        flags |= (1u << static_cast<unsigned>(ordinal(env, jf)));
-    }
-    return flags;
+    return static_cast<unsigned>(bits);
 }
 
 LocalRef<jobject> JniFlags::create(JNIEnv * env, unsigned flags, int bits) const {
-    auto j = LocalRef<jobject>(env, env->CallStaticObjectMethod(m_clazz.get(), m_methNoneOf, enumClass()));
+    DJINNI_ASSERT_NO_EXC_CHECK(bits >= 0 && bits <= 32);
+    // Bits past the last flag (e.g. from operator~) have no constant, so they are dropped.
+    const jlong mask = (jlong(1) << bits) - 1;
+    auto j = LocalRef<jobject>(env, env->CallStaticObjectMethod(m_clazz.get(), m_methFromBits, enumClass(),
+                                                               m_values.get(), static_cast<jlong>(flags) & mask));
     jniExceptionCheck(env);
-    unsigned mask = 1;
-    for(int i = 0; i < bits; ++i, mask <<= 1) {
-        if((flags & mask) != 0) {
-            auto jf = create(env, static_cast<jint>(i));
-            jniExceptionCheck(env);
-            env->CallBooleanMethod(j, m_methAdd, jf.get());
-            jniExceptionCheck(env);
-        }
-    }
     return j;
 }
 
@@ -435,41 +564,236 @@ void JniLocalScope::_popLocalFrame(JNIEnv* const env, jobject returnRef) {
     env->PopLocalFrame(returnRef);
 }
 
-using WcharConverter = std::wstring_convert<std::codecvt_utf16<wchar_t, 0x10ffff, std::codecvt_mode::little_endian>>;
-using Utf8Converter = std::wstring_convert<std::codecvt_utf8_utf16<char16_t, 0x10ffff, std::codecvt_mode::little_endian>, char16_t>;
+namespace {
+
+// Holds a string's characters on their way into NewString() or out of GetStringRegion().
+// Strings that fit are kept on the stack.
+template <typename Char, size_t kInlineSize = 512>
+class TranscodeBuffer {
+public:
+    explicit TranscodeBuffer(size_t size) : m_heap(size > kInlineSize ? new Char[size] : nullptr) {}
+    Char * get() { return m_heap ? m_heap.get() : m_inline; }
+
+private:
+    Char m_inline[kInlineSize];
+    std::unique_ptr<Char[]> m_heap;
+};
+
+// The characters of a jstring. Up to jniGetCriticalCopyThreshold() bytes of them are held with
+// GetStringCritical(), so that the VM can hand out its own buffer instead of a copy; no JNI
+// calls may be made while that is alive. Longer strings are copied out with GetStringRegion()
+// instead, so that the GC isn't held off while they are transcoded.
+class StringChars {
+public:
+    StringChars(JNIEnv * env, jstring jstr)
+        : m_env(env), m_jstr(jstr), m_length(static_cast<size_t>(env->GetStringLength(jstr))),
+          m_critical(m_length * sizeof(jchar) <= jniGetCriticalCopyThreshold()),
+          m_copy(m_critical ? 0 : m_length) {
+        if (m_critical) {
+            m_chars = env->GetStringCritical(jstr, nullptr);
+            // Only checked on failure: the assertion makes JNI calls.
+            if (!m_chars) {
+                DJINNI_ASSERT(m_chars, env);
+            }
+        } else {
+            env->GetStringRegion(jstr, 0, static_cast<jsize>(m_length), m_copy.get());
+            jniExceptionCheck(env);
+            m_chars = m_copy.get();
+        }
+    }
+    ~StringChars() {
+        if (m_critical) {
+            m_env->ReleaseStringCritical(m_jstr, m_chars);
+        }
+    }
+    StringChars(const StringChars &) = delete;
+    StringChars & operator=(const StringChars &) = delete;
+
+    const char16_t * data() const { return reinterpret_cast<const char16_t *>(m_chars); }
+    size_t size() const { return m_length; }
+
+private:
+    JNIEnv * const m_env;
+    const jstring m_jstr;
+    const size_t m_length;
+    const bool m_critical;
+    TranscodeBuffer<jchar> m_copy;
+    const jchar * m_chars = nullptr;
+};
+
+} // namespace
 
 jstring jniStringFromWString(JNIEnv * env, const std::wstring & str) {
-    std::string u16 = WcharConverter{}.to_bytes(str);
-    jstring res = env->NewString(reinterpret_cast<const jchar*>(u16.data()), u16.size()/sizeof(jchar));
+    jstring res;
+    if constexpr (sizeof(wchar_t) == sizeof(jchar)) {
+        res = env->NewString(reinterpret_cast<const jchar*>(str.data()), static_cast<jsize>(str.size()));
+    } else {
+        TranscodeBuffer<char16_t> u16(str.size() * 2);
+        const size_t length = utf16FromWide(str.data(), str.size(), u16.get());
+        res = env->NewString(reinterpret_cast<const jchar*>(u16.get()), static_cast<jsize>(length));
+    }
     DJINNI_ASSERT(res, env);
     return res;
 }
 
 std::wstring jniWStringFromString(JNIEnv * env, const jstring jstr) {
     DJINNI_ASSERT(jstr, env);
-    auto length = env->GetStringLength(jstr);
-    const jchar* u16 = env->GetStringChars(jstr, nullptr);
-    const char* bytes = reinterpret_cast<const char*>(u16);
-    auto byteLength = length * sizeof(jchar);
-    std::wstring out = WcharConverter{}.from_bytes(bytes, bytes + byteLength);
-    env->ReleaseStringChars(jstr, u16);
+    const StringChars u16(env, jstr);
+    std::wstring out;
+    if constexpr (sizeof(wchar_t) == sizeof(jchar)) {
+        out.assign(reinterpret_cast<const wchar_t*>(u16.data()), u16.size());
+    } else {
+        out.resize(u16.size());
+        out.resize(wideFromUTF16(u16.data(), u16.size(), &out[0]));
+    }
     return out;
 }
 
 jstring jniStringFromUTF8(JNIEnv * env, const std::string & str) {
-    std::u16string u16 = Utf8Converter{}.from_bytes(str);
-    jstring res = env->NewString(reinterpret_cast<const jchar*>(u16.data()), u16.size());
+    TranscodeBuffer<char16_t> u16(str.size());
+    const size_t length = utf16FromUTF8(str.data(), str.size(), u16.get());
+    jstring res = env->NewString(reinterpret_cast<const jchar*>(u16.get()), static_cast<jsize>(length));
     DJINNI_ASSERT(res, env);
     return res;
 }
 
+namespace {
+
+// The cache behind jniInternedStringFromUTF8(): a map into an LRU list, under one lock. A hit
+// only moves its entry to the front, so the lock is held very briefly; creating the String on a
+// miss happens outside it.
+class StringCache {
+public:
+    jstring get(JNIEnv * env, const std::string & str) {
+        if (m_capacity.load(std::memory_order_relaxed) == 0) {
+            return jniStringFromUTF8(env, str);
+        }
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_index.find(str);
+            if (it != m_index.end()) {
+                m_lru.splice(m_lru.begin(), m_lru, it->second);
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+                jstring res = static_cast<jstring>(env->NewLocalRef(it->second->ref.get()));
+                DJINNI_ASSERT(res, env);
+                return res;
+            }
+        }
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        jstring res = jniStringFromUTF8(env, str);
+        GlobalRef<jstring> ref(env, res);
+        std::vector<GlobalRef<jstring>> evicted;
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            // Another thread may have added the same string meanwhile; theirs stays.
+            if (m_index.count(str)) {
+                return res;
+            }
+            m_lru.push_front({str, std::move(ref)});
+            m_index.emplace(m_lru.front().key, m_lru.begin());
+            evictTo(m_capacity.load(std::memory_order_relaxed), evicted);
+        }
+        // The evicted references are deleted here, outside the lock.
+        return res;
+    }
+
+    void setCapacity(size_t entries) {
+        std::vector<GlobalRef<jstring>> evicted;
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_capacity.store(entries, std::memory_order_relaxed);
+        evictTo(entries, evicted);
+    }
+
+    void clear() {
+        std::vector<GlobalRef<jstring>> evicted;
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        evictTo(0, evicted);
+    }
+
+    JniStringCacheCounters counters() const {
+        JniStringCacheCounters c;
+        c.hits = m_hits.load(std::memory_order_relaxed);
+        c.misses = m_misses.load(std::memory_order_relaxed);
+        c.evictions = m_evictions.load(std::memory_order_relaxed);
+        return c;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        GlobalRef<jstring> ref;
+    };
+
+    void evictTo(size_t entries, std::vector<GlobalRef<jstring>> & evicted) {
+        while (m_lru.size() > entries) {
+            m_index.erase(m_lru.back().key);
+            evicted.push_back(std::move(m_lru.back().ref));
+            m_lru.pop_back();
+            m_evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::mutex m_mutex;
+    std::atomic<size_t> m_capacity { 256 };
+    std::list<Entry> m_lru;
+    // Keys point into the list's entries, which never move.
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> m_index;
+    std::atomic<uint64_t> m_hits { 0 };
+    std::atomic<uint64_t> m_misses { 0 };
+    std::atomic<uint64_t> m_evictions { 0 };
+};
+
+StringCache & stringCache() {
+    static StringCache cache;
+    return cache;
+}
+
+std::atomic<size_t> g_stringCacheMaxLength { 64 };
+std::atomic<bool> g_internAllStrings { false };
+
+} // namespace
+
+static void clearStringCache() {
+    stringCache().clear();
+}
+
+jstring jniInternedStringFromUTF8(JNIEnv * env, const std::string & str) {
+    if (str.size() > g_stringCacheMaxLength.load(std::memory_order_relaxed)) {
+        return jniStringFromUTF8(env, str);
+    }
+    return stringCache().get(env, str);
+}
+
+void jniSetStringCacheCapacity(size_t entries) {
+    stringCache().setCapacity(entries);
+}
+
+void jniSetStringCacheMaxLength(size_t bytes) {
+    g_stringCacheMaxLength.store(bytes, std::memory_order_relaxed);
+}
+
+size_t jniGetStringCacheMaxLength() {
+    return g_stringCacheMaxLength.load(std::memory_order_relaxed);
+}
+
+void jniSetInternAllStrings(bool intern) {
+    g_internAllStrings.store(intern, std::memory_order_relaxed);
+}
+
+bool jniGetInternAllStrings() {
+    return g_internAllStrings.load(std::memory_order_relaxed);
+}
+
+JniStringCacheCounters jniGetStringCacheCounters() {
+    return stringCache().counters();
+}
+
 std::string jniUTF8FromString(JNIEnv* env, const jstring jstr) {
     DJINNI_ASSERT(jstr, env);
-    auto length = env->GetStringLength(jstr);
-    const jchar* u16 = env->GetStringChars(jstr, nullptr);
-    const char16_t* p = reinterpret_cast<const char16_t*>(u16);
-    std::string out = Utf8Converter{}.to_bytes(p, p + length);
-    env->ReleaseStringChars(jstr, u16);
+    const StringChars u16(env, jstr);
+    std::string out;
+    out.resize(utf8LengthOfUTF16(u16.data(), u16.size()));
+    utf8FromUTF16(u16.data(), u16.size(), &out[0]);
     return out;
 }
 
@@ -556,6 +880,10 @@ private:
     GlobalRef<jobject> m_weakRef;
 };
 
+void JniCppProxyCacheTraits::release_proxy(jobject proxy) {
+    jniGetThreadEnv()->DeleteLocalRef(proxy);
+}
+
 template class ProxyCache<JniCppProxyCacheTraits>;
 
 } // namespace djinni
@@ -23,6 +23,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "../proxy_cache_interface.hpp"
@@ -63,10 +64,58 @@ struct JNIMethodLoadAutoRegister {
 };
 
 /*
- * Get the JNIEnv for the invoking thread. Should only be called on Java-created threads.
+ * Get the JNIEnv for the invoking thread, attaching the thread to the VM if needed. A thread
+ * attached here is detached when it exits, and its JNIEnv is cached in a thread_local until
+ * then, so later calls on it don't go through JavaVM::GetEnv.
  */
 JNIEnv * jniGetThreadEnv();
 
+/*
+ * Primitive arrays and binaries of up to this many bytes are copied across JNI while pinned
+ * with GetPrimitiveArrayCritical, which is fastest but keeps the GC from running until the
+ * copy is done. Bigger ones are copied in fixed-size chunks instead, which bounds that pause.
+ * Java strings of up to this many bytes of UTF-16 are read with GetStringCritical likewise;
+ * longer ones are copied out with GetStringRegion before they are transcoded.
+ * Defaults to 256 KiB and may be changed at any time, from any thread.
+ */
+void jniSetCriticalCopyThreshold(size_t bytes);
+size_t jniGetCriticalCopyThreshold();
+
+/*
+ * Serialized messages of at least this many bytes are passed through a direct java.nio.ByteBuffer
+ * over native scratch memory when their Protobuf<> marshaller uses GpbMessageLiteDirectSerializer.
+ * Smaller ones still go through a byte[], which takes fewer JNI calls. Defaults to 4 KiB and may
+ * be changed at any time, from any thread.
+ */
+void jniSetDirectProtobufThreshold(size_t bytes);
+size_t jniGetDirectProtobufThreshold();
+
+/*
+ * Native scratch memory of at least `size` bytes, borrowed from a small per-thread pool and
+ * given back to it when the JniScratchBuffer is destroyed. Once a thread has seen its largest
+ * message, further leases cost no allocation. Leases may nest; each gets its own block.
+ */
+class JniScratchBuffer {
+public:
+    explicit JniScratchBuffer(size_t size);
+    ~JniScratchBuffer();
+
+    JniScratchBuffer(const JniScratchBuffer &) = delete;
+    JniScratchBuffer & operator=(const JniScratchBuffer &) = delete;
+
+    uint8_t * data() const { return m_block.data.get(); }
+    size_t capacity() const { return m_block.capacity; }
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity = 0;
+    };
+    static std::vector<Block> & freeBlocks();
+
+    Block m_block;
+};
+
 /*
  * Global and local reference guard objects.
  *
@@ -317,6 +366,8 @@ struct JniCppProxyCacheTraits {
     using WeakProxyPointer = JavaWeakRef;
     using UnowningImplPointerHash = std::hash<void *>;
     using UnowningImplPointerEqual = std::equal_to<void *>;
+    // JavaWeakRef::lock() returns a local reference.
+    static void release_proxy(jobject proxy);
 };
 extern template class ProxyCache<JniCppProxyCacheTraits>;
 using JniCppProxyCache = ProxyCache<JniCppProxyCacheTraits>;
@@ -355,6 +406,18 @@ struct CppProxyClassInfo {
     explicit operator bool() const { return bool(clazz); }
 };
 
+/*
+ * Whether the proxies for an interface adapter go through JavaProxyCache and
+ * JniCppProxyCache. Adapters for interfaces declared `uncached` in the IDL define
+ * `static constexpr bool kUsesProxyCache = false`, and get a new proxy each time an object
+ * crosses the boundary.
+ */
+template <typename Self, typename = void>
+struct JniUsesProxyCache : std::true_type {};
+template <typename Self>
+struct JniUsesProxyCache<Self, std::void_t<decltype(Self::kUsesProxyCache)>>
+    : std::integral_constant<bool, Self::kUsesProxyCache> {};
+
 /*
  * Base class for Java <-> C++ interface adapters.
  *
@@ -372,6 +435,8 @@ public:
      * 2. The provided C++ object is actually a JavaProxy (C++-side proxy for Java impl)
      * 3. The provided C++ object has an existing CppProxy (Java-side proxy for C++ impl)
      * 4. The provided C++ object needs a new CppProxy allocated
+     *
+     * For uncached interfaces case 3 never applies.
      */
     jobject _toJava(JNIEnv* jniEnv, const ::djinni::SharedPtr<I> & c) const {
         // Case 1 - null
@@ -386,8 +451,11 @@ public:
 
         // Cases 3 and 4.
         assert(m_cppProxyClass);
-        return JniCppProxyCache::get(typeid(c), c, &newCppProxy);
-
+        if constexpr (JniUsesProxyCache<Self>::value) {
+            return JniCppProxyCache::get(typeid(c), c, &newCppProxy);
+        } else {
+            return newCppProxy(c).first;
+        }
     }
 
     /*
@@ -418,6 +486,82 @@ public:
         return _getJavaProxy<Self>(j);
     }
 
+    /*
+     * Batch versions of _toJava and _fromJava, for collections of this interface. The
+     * objects that need to go through the proxy cache are looked up with a single call to
+     * ProxyCache::get_batch(). _toJavaBatch stores local references in `j`.
+     */
+    void _toJavaBatch(JNIEnv* jniEnv, const ::djinni::SharedPtr<I> * const * c, size_t count,
+                      jobject * j) const {
+        std::vector<::djinni::SharedPtr<void>> impls;
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < count; ++i) {
+            j[i] = nullptr;
+            if (!*c[i]) {
+                continue;
+            }
+            if (jobject impl = _unwrapJavaProxy<Self>(c[i])) {
+                j[i] = jniEnv->NewLocalRef(impl);
+                continue;
+            }
+            impls.push_back(*c[i]);
+            indices.push_back(i);
+        }
+        if (impls.empty()) {
+            return;
+        }
+
+        assert(m_cppProxyClass);
+        std::vector<jobject> proxies(impls.size());
+        if constexpr (JniUsesProxyCache<Self>::value) {
+            JniCppProxyCache::get_batch(typeid(::djinni::SharedPtr<I>), impls.data(),
+                                        impls.size(), &newCppProxy, proxies.data());
+        } else {
+            for (size_t k = 0; k < impls.size(); ++k) {
+                proxies[k] = newCppProxy(impls[k]).first;
+            }
+        }
+        for (size_t k = 0; k < indices.size(); ++k) {
+            j[indices[k]] = proxies[k];
+        }
+    }
+
+    void _fromJavaBatch(JNIEnv* jniEnv, const jobject * j, size_t count,
+                        ::djinni::SharedPtr<I> * c) const {
+        std::vector<jobject> impls;
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < count; ++i) {
+            if (!j[i]) {
+                c[i] = nullptr;
+                continue;
+            }
+            LocalRef<jclass> clazz {jniEnv->GetObjectClass(j[i])};
+            if (m_cppProxyClass
+                && jniEnv->IsSameObject(clazz.get(), m_cppProxyClass.clazz.get())) {
+                jlong handle = jniEnv->GetLongField(j[i], m_cppProxyClass.idField);
+                jniExceptionCheck(jniEnv);
+                c[i] = objectFromHandleAddress<I>(handle);
+                continue;
+            }
+            impls.push_back(j[i]);
+            indices.push_back(i);
+        }
+        if (!impls.empty()) {
+            _getJavaProxies<Self>(impls.data(), impls.size(), indices.data(), c);
+        }
+    }
+
+    // Entry points for the collection marshallers in Marshal.hpp. Generated classes derive
+    // privately from JniInterface, so its members can't be called through them directly.
+    static void toJavaBatch(JNIEnv* jniEnv, const ::djinni::SharedPtr<I> * const * c,
+                            size_t count, jobject * j) {
+        static_cast<const JniInterface &>(JniClass<Self>::get())._toJavaBatch(jniEnv, c, count, j);
+    }
+    static void fromJavaBatch(JNIEnv* jniEnv, const jobject * j, size_t count,
+                              ::djinni::SharedPtr<I> * c) {
+        static_cast<const JniInterface &>(JniClass<Self>::get())._fromJavaBatch(jniEnv, j, count, c);
+    }
+
     // Constructor for interfaces for which a Java-side CppProxy class exists
     JniInterface(const char * cppProxyClassName) : m_cppProxyClass(cppProxyClassName) {}
 
@@ -451,8 +595,13 @@ private:
     static std::pair<jobject, void*> newCppProxy(const ::djinni::SharedPtr<void> & cppObj) {
         const auto & data = JniClass<Self>::get();
         const auto & jniEnv = jniGetThreadEnv();
-        std::unique_ptr<CppProxyHandle<I>> to_encapsulate(
-                new CppProxyHandle<I>(static_pointer_cast<I>(cppObj)));
+        std::unique_ptr<CppProxyHandle<I>> to_encapsulate;
+        if constexpr (JniUsesProxyCache<Self>::value) {
+            to_encapsulate.reset(new CppProxyHandle<I>(static_pointer_cast<I>(cppObj)));
+        } else {
+            to_encapsulate.reset(
+                new CppProxyHandle<I>(ProxyCacheBypass{}, static_pointer_cast<I>(cppObj)));
+        }
         jlong handle = static_cast<jlong>(reinterpret_cast<uintptr_t>(to_encapsulate.get()));
         jobject cppProxy = jniEnv->NewObject(data.m_cppProxyClass.clazz.get(),
                                              data.m_cppProxyClass.constructor,
@@ -471,13 +620,12 @@ private:
         static_assert(std::is_base_of<JavaProxyHandle<JavaProxy>, JavaProxy>::value,
             "JavaProxy must derive from JavaProxyCacheEntry");
 
-        return static_pointer_cast<JavaProxy>(JavaProxyCache::get(
-            typeid(JavaProxy), j,
-            [] (const jobject & obj) -> std::pair<::djinni::SharedPtr<void>, jobject> {
-                auto ret = djinni::makeShared<JavaProxy>(obj);
-                return { ret, ret->JavaProxyHandle<JavaProxy>::get().get() };
-            }
-        ));
+        if constexpr (JniUsesProxyCache<Self>::value) {
+            return static_pointer_cast<JavaProxy>(JavaProxyCache::get(
+                typeid(JavaProxy), j, &newJavaProxy<JavaProxy>));
+        } else {
+            return djinni::makeShared<JavaProxy>(j);
+        }
     }
 
     template <typename S>
@@ -486,6 +634,36 @@ private:
         return nullptr;
     }
 
+    // Batch version of _getJavaProxy, for _fromJavaBatch. Stores the proxy for `j[k]` in
+    // `c[indices[k]]`.
+    template <typename S, typename JavaProxy = typename S::JavaProxy>
+    void _getJavaProxies(const jobject * j, size_t count, const size_t * indices,
+                         ::djinni::SharedPtr<I> * c) const {
+        if constexpr (JniUsesProxyCache<Self>::value) {
+            std::vector<::djinni::SharedPtr<void>> proxies(count);
+            JavaProxyCache::get_batch(typeid(JavaProxy), j, count, &newJavaProxy<JavaProxy>,
+                                      proxies.data());
+            for (size_t k = 0; k < count; ++k) {
+                c[indices[k]] = static_pointer_cast<JavaProxy>(proxies[k]);
+            }
+        } else {
+            for (size_t k = 0; k < count; ++k) {
+                c[indices[k]] = djinni::makeShared<JavaProxy>(j[k]);
+            }
+        }
+    }
+
+    template <typename S>
+    void _getJavaProxies(...) const {
+        assert(false);
+    }
+
+    template <typename JavaProxy>
+    static std::pair<::djinni::SharedPtr<void>, jobject> newJavaProxy(const jobject & obj) {
+        auto ret = djinni::makeShared<JavaProxy>(obj);
+        return { ret, ret->JavaProxyHandle<JavaProxy>::get().get() };
+    }
+
     const CppProxyClassInfo m_cppProxyClass;
 };
 
@@ -537,6 +715,37 @@ std::string jniUTF8FromString(JNIEnv * env, const jstring jstr);
 jstring jniStringFromWString(JNIEnv * env, const std::wstring & str);
 std::wstring jniWStringFromString(JNIEnv * env, const jstring jstr);
 
+/*
+ * A bounded cache of Java Strings for short strings that C++ hands to Java over and over, such
+ * as status codes, keys and enum-like identifiers. A hit returns a new local reference to the
+ * cached String instead of transcoding and allocating another. The least recently used entry
+ * is evicted when the cache is full; all of them are dropped by jniShutdown().
+ *
+ * Results of the `interned_string` type (support-lib/interned_string.yaml) always go through
+ * the cache. Every other `string` does too after jniSetInternAllStrings(true). Either way, only
+ * strings of up to jniGetStringCacheMaxLength() UTF-8 bytes are cached.
+ */
+jstring jniInternedStringFromUTF8(JNIEnv * env, const std::string & str);
+
+// Number of Strings kept, 256 by default. 0 turns the cache off and empties it.
+void jniSetStringCacheCapacity(size_t entries);
+// Longest string cached, in UTF-8 bytes; 64 by default.
+void jniSetStringCacheMaxLength(size_t bytes);
+size_t jniGetStringCacheMaxLength();
+// Whether String::fromCpp goes through the cache too; off by default.
+void jniSetInternAllStrings(bool intern);
+bool jniGetInternAllStrings();
+
+struct JniStringCacheCounters {
+    uint64_t hits = 0;
+    uint64_t misses = 0;   // strings short enough to cache that weren't in it
+    uint64_t evictions = 0;
+
+    double hitRate() const { return hits + misses ? double(hits) / double(hits + misses) : 0.0; }
+};
+// Read without taking the cache's lock, so only approximately consistent with each other.
+JniStringCacheCounters jniGetStringCacheCounters();
+
 class JniEnum {
 public:
     /*
@@ -556,8 +765,10 @@ protected:
 
 private:
     const GlobalRef<jclass> m_clazz;
-    const jmethodID m_staticmethValues;
     const jmethodID m_methOrdinal;
+    // The enum constants in ordinal order, fetched once with values(), which copies the
+    // array on every call.
+    const std::vector<GlobalRef<jobject>> m_values;
 };
 
 class JniFlags : private JniEnum {
@@ -579,16 +790,13 @@ protected:
     JniFlags(const std::string & name);
 
 private:
-    const GlobalRef<jclass> m_clazz { jniFindClass("java/util/EnumSet") };
-    const jmethodID m_methNoneOf { jniGetStaticMethodID(m_clazz.get(), "noneOf", "(Ljava/lang/Class;)Ljava/util/EnumSet;") };
-    const jmethodID m_methAdd { jniGetMethodID(m_clazz.get(), "add", "(Ljava/lang/Object;)Z") };
-    const jmethodID m_methIterator { jniGetMethodID(m_clazz.get(), "iterator", "()Ljava/util/Iterator;") };
-    const jmethodID m_methSize { jniGetMethodID(m_clazz.get(), "size", "()I") };
-
-    struct {
-        const GlobalRef<jclass> clazz { jniFindClass("java/util/Iterator") };
-        const jmethodID methNext { jniGetMethodID(clazz.get(), "next", "()Ljava/lang/Object;") };
-    } m_iterator;
+    // com.snapchat.djinni.EnumFlags walks the EnumSet on the Java side, so each conversion is
+    // a single call that passes the flags as a long bitmask.
+    const GlobalRef<jclass> m_clazz { jniFindClass("com/snapchat/djinni/EnumFlags") };
+    const jmethodID m_methToBits { jniGetStaticMethodID(m_clazz.get(), "toBits", "(Ljava/util/EnumSet;)J") };
+    const jmethodID m_methFromBits { jniGetStaticMethodID(m_clazz.get(), "fromBits", "(Ljava/lang/Class;[Ljava/lang/Enum;J)Ljava/util/EnumSet;") };
+    // The constants in ordinal order, handed to fromBits() so that it needn't copy them.
+    const GlobalRef<jobjectArray> m_values;
 };
 
 /*
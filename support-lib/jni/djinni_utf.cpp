@@ -0,0 +1,308 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#include "djinni_utf.hpp"
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DJINNI_UTF_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DJINNI_UTF_NEON 1
+#endif
+
+namespace djinni {
+
+[[noreturn]] static void throwInvalid() {
+    throw std::range_error("invalid UTF-8 or UTF-16 string");
+}
+
+// Widens the ASCII bytes at the start of `in` into `out`, a block at a time. Returns the
+// number of bytes copied, which stops short of the first block holding a non-ASCII byte.
+static size_t widenASCII(const unsigned char * in, size_t len, char16_t * out) {
+    size_t i = 0;
+#if defined(DJINNI_UTF_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= len; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif defined(DJINNI_UTF_NEON)
+    for (; i + 16 <= len; i += 16) {
+        const uint8x16_t v = vld1q_u8(in + i);
+        const uint8x8_t any = vorr_u8(vget_low_u8(v), vget_high_u8(v));
+        if (vget_lane_u64(vreinterpret_u64_u8(any), 0) & UINT64_C(0x8080808080808080)) {
+            break;
+        }
+        vst1q_u16(reinterpret_cast<uint16_t *>(out + i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(out + i + 8), vmovl_u8(vget_high_u8(v)));
+    }
+#else
+    for (; i + 8 <= len; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, in + i, sizeof(word));
+        if (word & UINT64_C(0x8080808080808080)) {
+            break;
+        }
+        for (size_t k = 0; k < 8; ++k) {
+            out[i + k] = in[i + k];
+        }
+    }
+#endif
+    return i;
+}
+
+// Narrows the ASCII units at the start of `in` into `out`, a block at a time. Returns the
+// number of units copied, which stops short of the first block holding a non-ASCII unit.
+static size_t narrowASCII(const char16_t * in, size_t len, char * out) {
+    size_t i = 0;
+#if defined(DJINNI_UTF_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i high = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for (; i + 8 <= len; i += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), zero)) != 0xFFFF) {
+            break;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(v, v));
+    }
+#elif defined(DJINNI_UTF_NEON)
+    for (; i + 8 <= len; i += 8) {
+        const uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t *>(in + i));
+        const uint16x8_t nonASCII = vtstq_u16(v, vdupq_n_u16(0xFF80));
+        const uint16x4_t any = vorr_u16(vget_low_u16(nonASCII), vget_high_u16(nonASCII));
+        if (vget_lane_u64(vreinterpret_u64_u16(any), 0) != 0) {
+            break;
+        }
+        vst1_u8(reinterpret_cast<uint8_t *>(out + i), vmovn_u16(v));
+    }
+#else
+    for (; i < len && in[i] < 0x80; ++i) {
+        out[i] = static_cast<char>(in[i]);
+    }
+#endif
+    return i;
+}
+
+// Adds the UTF-8 length of the 8 units at `in` to `bytes`, unless one of them is a surrogate,
+// in which case it returns false and the caller has to look at them one by one.
+static bool utf8LengthOfBlock(const char16_t * in, size_t & bytes) {
+#if defined(DJINNI_UTF_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+    const __m128i top5 = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800)));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(top5, _mm_set1_epi16(static_cast<short>(0xD800))))) {
+        return false;
+    }
+    // Two mask bits per unit: count the units below 0x80 and below 0x800.
+    const int below80 = _mm_movemask_epi8(
+        _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80))), zero));
+    const int below800 = _mm_movemask_epi8(_mm_cmpeq_epi16(top5, zero));
+    bytes += 24 - (std::bitset<16>(below80).count() + std::bitset<16>(below800).count()) / 2;
+#elif defined(DJINNI_UTF_NEON)
+    const uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t *>(in));
+    const uint16x8_t top5 = vandq_u16(v, vdupq_n_u16(0xF800));
+    const uint16x8_t surrogate = vceqq_u16(top5, vdupq_n_u16(0xD800));
+    const uint16x4_t any = vorr_u16(vget_low_u16(surrogate), vget_high_u16(surrogate));
+    if (vget_lane_u64(vreinterpret_u64_u16(any), 0) != 0) {
+        return false;
+    }
+    // One byte per unit, plus one from 0x80 and another from 0x800.
+    uint16x8_t extra = vshrq_n_u16(vtstq_u16(v, vdupq_n_u16(0xFF80)), 15);
+    extra = vaddq_u16(extra, vshrq_n_u16(vtstq_u16(v, vdupq_n_u16(0xF800)), 15));
+    const uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(extra));
+    bytes += 8 + static_cast<size_t>(vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1));
+#else
+    size_t total = 0;
+    for (size_t k = 0; k < 8; ++k) {
+        const char16_t c = in[k];
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            return false;
+        }
+        total += c < 0x80 ? 1 : c < 0x800 ? 2 : 3;
+    }
+    bytes += total;
+#endif
+    return true;
+}
+
+// Reads the code point at `in[i]`, advancing `i` past it.
+static char32_t readUTF16(const char16_t * in, size_t len, size_t & i) {
+    const char16_t c = in[i++];
+    if (c < 0xD800 || c > 0xDFFF) {
+        return c;
+    }
+    if (c >= 0xDC00 || i == len || (in[i] & 0xFC00) != 0xDC00) {
+        throwInvalid();
+    }
+    const char16_t low = in[i++];
+    return 0x10000 + ((static_cast<char32_t>(c - 0xD800) << 10) | (low - 0xDC00));
+}
+
+// Java strings may end with an unpaired high surrogate, for instance when cut in the middle of a
+// pair. std::wstring_convert dropped it, and so do the UTF-16 decoders here.
+static size_t lengthWithoutTrailingHighSurrogate(const char16_t * in, size_t len) {
+    return len && (in[len - 1] & 0xFC00) == 0xD800 ? len - 1 : len;
+}
+
+static size_t writeUTF16(char32_t cp, char16_t * out) {
+    if (cp < 0x10000) {
+        out[0] = static_cast<char16_t>(cp);
+        return 1;
+    }
+    cp -= 0x10000;
+    out[0] = static_cast<char16_t>(0xD800 + (cp >> 10));
+    out[1] = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+    return 2;
+}
+
+size_t utf16FromUTF8(const char * str, size_t len, char16_t * out) {
+    const auto * in = reinterpret_cast<const unsigned char *>(str);
+    size_t i = 0;
+    size_t o = 0;
+    while (i < len) {
+        unsigned char c = in[i];
+        if (c < 0x80) {
+            const size_t n = widenASCII(in + i, len - i, out + o);
+            i += n;
+            o += n;
+            // Finish the run up to the first non-ASCII byte.
+            while (i < len && (c = in[i]) < 0x80) {
+                out[o++] = c;
+                ++i;
+            }
+            continue;
+        }
+
+        size_t n;
+        char32_t cp;
+        if (c < 0xC2) { // A continuation byte, or an overlong 2-byte sequence.
+            throwInvalid();
+        } else if (c < 0xE0) {
+            n = 2;
+            cp = c & 0x1F;
+        } else if (c < 0xF0) {
+            n = 3;
+            cp = c & 0x0F;
+        } else if (c < 0xF5) {
+            n = 4;
+            cp = c & 0x07;
+        } else {
+            throwInvalid();
+        }
+        if (len - i < n) {
+            throwInvalid();
+        }
+        for (size_t k = 1; k < n; ++k) {
+            const unsigned char b = in[i + k];
+            if ((b & 0xC0) != 0x80) {
+                throwInvalid();
+            }
+            cp = (cp << 6) | (b & 0x3F);
+        }
+        if ((n == 3 && (cp < 0x800 || (cp >= 0xD800 && cp <= 0xDFFF)))
+            || (n == 4 && (cp < 0x10000 || cp > 0x10FFFF))) {
+            throwInvalid();
+        }
+        o += writeUTF16(cp, out + o);
+        i += n;
+    }
+    return o;
+}
+
+size_t utf8LengthOfUTF16(const char16_t * in, size_t len) {
+    len = lengthWithoutTrailingHighSurrogate(in, len);
+    size_t bytes = 0;
+    size_t i = 0;
+    while (i + 8 <= len) {
+        if (utf8LengthOfBlock(in + i, bytes)) {
+            i += 8;
+            continue;
+        }
+        // The last pair may straddle the end of the block; readUTF16() reads past it then.
+        for (const size_t end = i + 8; i < end;) {
+            const char32_t cp = readUTF16(in, len, i);
+            bytes += cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+        }
+    }
+    while (i < len) {
+        const char32_t cp = readUTF16(in, len, i);
+        bytes += cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+    }
+    return bytes;
+}
+
+size_t utf8FromUTF16(const char16_t * in, size_t len, char * str) {
+    len = lengthWithoutTrailingHighSurrogate(in, len);
+    auto * out = reinterpret_cast<unsigned char *>(str);
+    size_t i = 0;
+    size_t o = 0;
+    while (i < len) {
+        if (in[i] < 0x80) {
+            const size_t n = narrowASCII(in + i, len - i, str + o);
+            i += n;
+            o += n;
+            while (i < len && in[i] < 0x80) {
+                out[o++] = static_cast<unsigned char>(in[i++]);
+            }
+            continue;
+        }
+        const char32_t cp = readUTF16(in, len, i);
+        if (cp < 0x800) {
+            out[o++] = static_cast<unsigned char>(0xC0 | (cp >> 6));
+        } else if (cp < 0x10000) {
+            out[o++] = static_cast<unsigned char>(0xE0 | (cp >> 12));
+            out[o++] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+        } else {
+            out[o++] = static_cast<unsigned char>(0xF0 | (cp >> 18));
+            out[o++] = static_cast<unsigned char>(0x80 | ((cp >> 12) & 0x3F));
+            out[o++] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+        }
+        out[o++] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+    }
+    return o;
+}
+
+size_t utf16FromWide(const wchar_t * in, size_t len, char16_t * out) {
+    size_t o = 0;
+    for (size_t i = 0; i < len; ++i) {
+        const auto cp = static_cast<char32_t>(in[i]);
+        if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            throwInvalid();
+        }
+        o += writeUTF16(cp, out + o);
+    }
+    return o;
+}
+
+size_t wideFromUTF16(const char16_t * in, size_t len, wchar_t * out) {
+    len = lengthWithoutTrailingHighSurrogate(in, len);
+    size_t o = 0;
+    for (size_t i = 0; i < len;) {
+        out[o++] = static_cast<wchar_t>(readUTF16(in, len, i));
+    }
+    return o;
+}
+
+} // namespace djinni
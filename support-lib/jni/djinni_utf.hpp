@@ -0,0 +1,56 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#pragma once
+
+#include <cstddef>
+
+namespace djinni {
+
+/*
+ * Transcoders between the UTF-8 (and 32-bit `wchar_t`) strings used in C++ and the UTF-16
+ * strings used by Java. They write straight into a buffer supplied by the caller, which the
+ * JNI string functions size from the input, so no intermediate string is built.
+ *
+ * Runs of ASCII are handled 16 bytes at a time with SSE2 or NEON where available; the rest
+ * goes through a scalar loop. All of them validate their input and throw std::range_error on
+ * malformed UTF-8, unpaired surrogates or code points above U+10FFFF, as std::wstring_convert
+ * did before them. Like it, the UTF-16 decoders drop an unpaired high surrogate at the very end
+ * of their input instead, since Java strings can end with one.
+ */
+
+// Decodes `len` bytes of UTF-8 into `out`, which must have room for `len` units. Returns the
+// number of UTF-16 units written.
+size_t utf16FromUTF8(const char * in, size_t len, char16_t * out);
+
+// Returns the number of bytes utf8FromUTF16() will write for the given UTF-16 string, and
+// checks that it is well formed.
+size_t utf8LengthOfUTF16(const char16_t * in, size_t len);
+
+// Encodes `len` units of UTF-16 into `out`, which must have room for utf8LengthOfUTF16()
+// bytes. The input must have been validated by utf8LengthOfUTF16(). Returns the number of
+// bytes written.
+size_t utf8FromUTF16(const char16_t * in, size_t len, char * out);
+
+// Encodes `len` code points into `out`, which must have room for 2 * `len` units. Returns the
+// number of UTF-16 units written. Only meaningful where wchar_t is 32 bits wide.
+size_t utf16FromWide(const wchar_t * in, size_t len, char16_t * out);
+
+// Decodes `len` units of UTF-16 into `out`, which must have room for `len` code points.
+// Returns the number of code points written. Only meaningful where wchar_t is 32 bits wide.
+size_t wideFromUTF16(const char16_t * in, size_t len, wchar_t * out);
+
+} // namespace djinni
@@ -59,4 +59,24 @@ ObjcType * get_cpp_proxy(const CppPtrType & cppRef) {
     return get_cpp_proxy_impl<ObjcType, typename std::remove_reference<decltype(*cppRef)>::type>(cppRef);
 }
 
+// Holds the C++ object of an ObjC wrapper for an interface declared `uncached`, in place of a
+// CppProxyCache::Handle. Such wrappers are created by new_cpp_proxy without going through the
+// cache, so there is no entry to remove when they are destroyed.
+template <typename T>
+class UncachedCppRef {
+public:
+    void assign(const T & obj) { m_obj = obj; }
+
+    const T & get() const & noexcept { return m_obj; }
+
+private:
+    T m_obj;
+};
+
+// Wraps cppRef in a new ObjC object every time, for interfaces declared `uncached`.
+template <typename ObjcType, typename CppPtrType>
+ObjcType * new_cpp_proxy(const CppPtrType & cppRef) {
+    return [[ObjcType alloc] initWithCpp:cppRef];
+}
+
 } // namespace djinni
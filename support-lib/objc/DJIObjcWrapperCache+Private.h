@@ -53,6 +53,12 @@ static ::djinni::SharedPtr<CppType> get_objc_proxy(ObjcType * objcRef) {
     ));
 }
 
+// Creates a new C++ proxy for objcRef every time, for interfaces declared `uncached`.
+template <typename CppType, typename ObjcType>
+static ::djinni::SharedPtr<CppType> new_objc_proxy(ObjcType * objcRef) {
+    return djinni::makeShared<CppType>(ProxyCacheBypass{}, objcRef);
+}
+
 // Private implementation base class for all ObjC proxies, which manages the
 // Handle, and ensures that it is created and destroyed in a safe way, inside
 // of an @autoreleasepool to avoid leaks.  The complexity here is just necessary
@@ -75,6 +81,13 @@ public:
         }
     }
 
+    // For proxies created by new_objc_proxy, whose handle is not in the cache.
+    ObjcProxyBase(ProxyCacheBypass, ObjcType objc) {
+        @autoreleasepool {
+            new (&m_djinni_private_proxy_handle) HandleType(ProxyCacheBypass{}, objc);
+        }
+    }
+
     ObjcProxyBase(const ObjcProxyBase&) = delete;
     ObjcProxyBase& operator=(const ObjcProxyBase&) = delete;
 
@@ -19,9 +19,50 @@
 #pragma once
 
 #include "proxy_cache_interface.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Number of independently locked shards in each ProxyCache. Lookups and removals only
+ * lock the shard selected by the hash of their (type, impl) key, so threads passing
+ * different objects across the boundary don't serialize on a single mutex. Must be a
+ * power of two; define as 1 to get the old single-lock behaviour.
+ */
+#ifndef DJINNI_PROXY_CACHE_SHARDS
+#define DJINNI_PROXY_CACHE_SHARDS 16
+#endif
+
+/*
+ * Whether ProxyCache keeps the per-type counters returned by ProxyCache::counters(). They
+ * are relaxed atomic increments, plus two clock reads whenever a lock is contended. Define
+ * as 0 to compile them out.
+ */
+#ifndef DJINNI_PROXY_CACHE_COUNTERS
+#define DJINNI_PROXY_CACHE_COUNTERS 1
+#endif
+
+/*
+ * When nonzero, a Handle destructor that finds its shard's lock busy doesn't wait for it:
+ * it pushes the removal onto a lock-free list, which is applied by the next thread to lock
+ * the shard (any get() that misses, another removal, stats()) or by ProxyCache::drain().
+ * This keeps the finalizer threads that destroy proxies from queueing behind the threads
+ * using the cache, at the cost of dead entries lingering a little longer.
+ */
+#ifndef DJINNI_PROXY_CACHE_DEFERRED_REMOVALS
+#define DJINNI_PROXY_CACHE_DEFERRED_REMOVALS 0
+#endif
 
 // """
 //    This place is not a place of honor.
@@ -81,22 +122,62 @@ public:
     OwningProxyPointer get(const std::type_index & tag,
                            const OwningImplPointer & impl,
                            AllocatorFunction * alloc) {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        UnowningImplPointer ptr = get_unowning(impl);
-        auto existing_proxy_iter = m_mapping.find({tag, ptr});
-        if (existing_proxy_iter != m_mapping.end()) {
-            OwningProxyPointer existing_proxy = upgrade_weak(existing_proxy_iter->second);
-            if (existing_proxy) {
-                return existing_proxy;
-            } else {
-                // The weak reference is expired, so prune it from the map eagerly.
-                m_mapping.erase(existing_proxy_iter);
+        // Hash outside of the lock: for Java this is a JNI call.
+        const size_t tag_hash = tag.hash_code();
+        const HashedKey key = make_key(tag, tag_hash, get_unowning(impl));
+        TagCounters * counters = counters_for(tag, tag_hash);
+        Shard & shard = shard_for(key.hash);
+        if (OwningProxyPointer existing_proxy = find_unlocked(shard, key)) {
+            count(counters, &TagCounters::hits);
+            return existing_proxy;
+        }
+
+        // Replaced tables are freed after the lock is released.
+        Garbage garbage;
+        std::unique_lock<std::mutex> lock = lock_shard(shard, counters);
+        OwningProxyPointer proxy = get_locked(shard, key, impl, alloc, counters, garbage);
+        collect(shard, garbage);
+        return proxy;
+    }
+
+    /*
+     * Look up or create the proxies for a batch of objects of the same type. Same as calling
+     * get() for each of them, except that the misses are grouped by shard so that each
+     * shard's mutex is taken at most once.
+     */
+    void get_batch(const std::type_index & tag,
+                   const OwningImplPointer * impls,
+                   size_t count,
+                   AllocatorFunction * alloc,
+                   OwningProxyPointer * proxies) {
+        const size_t tag_hash = tag.hash_code();
+        TagCounters * counters = counters_for(tag, tag_hash);
+        std::vector<HashedKey> keys;
+        std::vector<size_t> misses;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            keys.push_back(make_key(tag, tag_hash, get_unowning(impls[i])));
+            proxies[i] = find_unlocked(shard_for(keys[i].hash), keys[i]);
+            if (!proxies[i]) {
+                misses.push_back(i);
             }
         }
+        this->count(counters, &TagCounters::hits, count - misses.size());
 
-        auto alloc_result = alloc(impl);
-        m_mapping.emplace(Key{tag, alloc_result.second}, alloc_result.first);
-        return alloc_result.first;
+        std::sort(misses.begin(), misses.end(), [&](size_t lhs, size_t rhs) {
+            return shard_index(keys[lhs].hash) < shard_index(keys[rhs].hash);
+        });
+        for (auto it = misses.begin(); it != misses.end();) {
+            Shard & shard = shard_for(keys[*it].hash);
+            Garbage garbage;
+            std::unique_lock<std::mutex> lock = lock_shard(shard, counters);
+            do {
+                proxies[*it] = get_locked(shard, keys[*it], impls[*it], alloc, counters,
+                                          garbage);
+                ++it;
+            } while (it != misses.end() && &shard_for(keys[*it].hash) == &shard);
+            collect(shard, garbage);
+        }
     }
 
     /*
@@ -109,10 +190,11 @@ public:
         // However, remove() does not happen atomically with the proxy object
         // becoming weakly reachable. It's possible that during the window
         // between when the weak-ref holding this proxy expires and when we
-        // enter remove() and take m_mutex, another thread could have created a
-        // new proxy for the same original object and added it to the map.
+        // enter remove() and take the shard's mutex, another thread could have
+        // created a new proxy for the same original object and added it to the
+        // map.
         // 
-        // In that case, `it->second` will contain a live pointer to a different
+        // In that case, the entry will contain a live pointer to a different
         // proxy object, not an expired weak pointer to the Handle currently
         // being destructed. We only remove the map entry if its pointer is
         // already expired.
@@ -120,50 +202,702 @@ public:
         // Since the is_expired() test could potentially acquire the ownership
         // temporarily and result in destructing the proxy object with the mutex
         // already held.  We store a strong ref to the new object outside of the
-        // mutex scope so that in case we are left with the last reference to
-        // the new proxy object, the destruction will happen outside of the
-        // mutex
-        OwningProxyPointer temp_ptr_holder [[maybe_unused]];
+        // mutex scope (in `garbage`) so that in case we are left with the last
+        // reference to the new proxy object, the destruction will happen outside
+        // of the mutex
+        Garbage garbage;
+        const size_t tag_hash = tag.hash_code();
+        const HashedKey key = make_key(tag, tag_hash, impl_unowning);
+        TagCounters * counters = counters_for(tag, tag_hash);
+        Shard & shard = shard_for(key.hash);
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            auto it = m_mapping.find({tag, impl_unowning});
-            if (it != m_mapping.end()) {
-                temp_ptr_holder = upgrade_weak(it->second);
-                if (is_expired(it->second)) {
-                    m_mapping.erase(it);
+            std::unique_lock<std::mutex> lock;
+            if constexpr (kDeferredRemovals) {
+                // If somebody else holds the lock, leave the removal to them or to the next
+                // thread to take it. The second try_lock catches a holder that released the
+                // lock before the removal was queued, which would otherwise leave it queued
+                // until the shard is next used.
+                lock = std::unique_lock<std::mutex>(shard.mutex, std::try_to_lock);
+                if (!lock) {
+                    auto * removal = new PendingRemoval{
+                        key.hash, counters, shard.pending.load(std::memory_order_relaxed)};
+                    while (!shard.pending.compare_exchange_weak(removal->next, removal,
+                                                                std::memory_order_release,
+                                                                std::memory_order_relaxed)) {
+                    }
+                    if (lock.try_lock()) {
+                        collect(shard, garbage);
+                    } else {
+                        count(counters, &TagCounters::deferred_removes);
+                    }
+                    return;
                 }
+            } else {
+                lock = lock_shard(shard, counters);
+            }
+            OwningProxyPointer live_proxy;
+            size_t erased = 0;
+            const bool found_live = find_locked(shard, key, live_proxy, garbage, erased) != Table::npos;
+            if (found_live) {
+                garbage.proxies.push_back(std::move(live_proxy));
+            }
+            if (erased) {
+                count(counters, &TagCounters::removes, erased);
+            } else if (found_live) {
+                count(counters, &TagCounters::remove_races);
+            }
+            collect(shard, garbage);
+        }
+    }
+
+    void drain() {
+        for (auto & shard : m_shards) {
+            if (shard.pending.load(std::memory_order_relaxed)) {
+                Garbage garbage;
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                collect(shard, garbage);
             }
         }
     }
 
     std::unordered_map<const char*, size_t> stats() {
-        std::unique_lock<std::mutex> lock(m_mutex);
         std::unordered_map<const char*, size_t> result;
-        for (const auto& entry: m_mapping) {
-            // Just use the mangled name here because demangling requires
-            // allocation.
-            const auto* mangled_type_name = entry.first.first.name();
-            result[mangled_type_name]++;
+        for (auto & shard : m_shards) {
+            Garbage garbage;
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            collect(shard, garbage);
+            const Table & table = *shard.table.load(std::memory_order_relaxed);
+            for (size_t i = 0; i <= table.mask; ++i) {
+                if (const Entry * entry = table.slots[i].entry.load(std::memory_order_relaxed)) {
+                    // Just use the mangled name here because demangling requires
+                    // allocation.
+                    const auto* mangled_type_name = entry->key.key.first.name();
+                    result[mangled_type_name]++;
+                }
+            }
+        }
+        return result;
+    }
+
+    std::unordered_map<const char*, ProxyCacheCounters> counters() {
+        std::unordered_map<const char*, ProxyCacheCounters> result;
+        for (const auto & counters : m_counters) {
+            if (const char * name = counters.name.load(std::memory_order_acquire)) {
+                result[name] = counters.snapshot();
+            }
         }
         return result;
     }
 
+    ~Pimpl() {
+        for (auto & shard : m_shards) {
+            Table * table = shard.table.load(std::memory_order_relaxed);
+            for (size_t i = 0; i <= table->mask; ++i) {
+                if (Entry * entry = table->slots[i].entry.load(std::memory_order_relaxed)) {
+                    destroy_entry(entry);
+                }
+            }
+            delete table;
+            for (PendingRemoval * removal = shard.pending.load(std::memory_order_relaxed);
+                 removal;) {
+                PendingRemoval * next = removal->next;
+                delete removal;
+                removal = next;
+            }
+            // No readers are left at this point, so everything retired can go.
+            for (auto & retired : shard.retired) {
+                for (Entry * entry : retired.entries) destroy_entry(entry);
+                for (Table * retired_table : retired.tables) delete retired_table;
+            }
+            for (void * storage : shard.spare_entries) {
+                ::operator delete(storage);
+            }
+        }
+    }
+
 private:
-    struct KeyHash {
-        std::size_t operator()(const Key & k) const {
-            return k.first.hash_code() ^ UnowningImplPointerHash{}(k.second);
+    static constexpr size_t kShardCount = DJINNI_PROXY_CACHE_SHARDS;
+    static_assert(kShardCount > 0 && (kShardCount & (kShardCount - 1)) == 0,
+                  "DJINNI_PROXY_CACHE_SHARDS must be a power of two");
+    // Storage of freed entries kept per shard for reuse, so that a steady stream of proxies
+    // being created and destroyed doesn't go through the heap for each one.
+    static constexpr size_t kMaxSpareEntries = 64;
+
+    static constexpr unsigned log2(size_t n) {
+        return n > 1 ? 1 + log2(n / 2) : 0;
+    }
+    static constexpr unsigned kShardBits = log2(kShardCount);
+
+    /*
+     * The hash is computed once per operation, before any lock is taken, and is carried
+     * along with the key so that neither shard selection nor the table lookup recompute it.
+     * It is the traits' hash of the key scrambled by Fibonacci hashing: pointer hashes have
+     * their low bits clear, so the shard is picked from the top bits of the result and the
+     * slot within the shard's table from the bits below those.
+     */
+    struct HashedKey {
+        Key key;
+        uint64_t hash;
+    };
+
+    /*
+     * A cache entry. Entries are immutable once published to readers: removing one from the
+     * cache unlinks it from the table and retires it, and it is only destroyed once no reader
+     * can still be looking at it.
+     */
+    struct Entry {
+        const HashedKey key;
+        const WeakProxyPointer proxy;
+    };
+
+    /*
+     * Open-addressed (linear probing) table of entry pointers. Each slot also holds a copy
+     * of its entry's hash, so that probing doesn't have to touch the entries it skips.
+     *
+     * Readers walk the table without locking. Writers hold the shard's mutex, and only ever
+     * store whole values into slots. Deletion shifts the rest of the probe run back into the
+     * hole instead of leaving a tombstone, so the table never fills up with dead slots and
+     * only needs replacing when it grows or shrinks. A reader racing with such a shift can
+     * miss an entry that is there; that just sends it to the locked path, which looks again.
+     */
+    struct Table {
+        static constexpr size_t npos = static_cast<size_t>(-1);
+        static constexpr size_t kMinCapacity = 16;
+
+        struct Slot {
+            std::atomic<size_t> hash;
+            std::atomic<Entry *> entry;
+        };
+
+        const size_t mask;
+        const unsigned shift;
+        const std::unique_ptr<Slot[]> slots;
+        size_t size = 0; // Only accessed by writers.
+
+        explicit Table(size_t capacity)
+            : mask(capacity - 1), shift(64 - log2(capacity)), slots(new Slot[capacity]) {
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].hash.store(0, std::memory_order_relaxed);
+                slots[i].entry.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        size_t home(uint64_t hash) const {
+            if constexpr (kShardBits == 0) {
+                return static_cast<size_t>(hash >> shift);
+            } else {
+                return static_cast<size_t>((hash << kShardBits) >> shift);
+            }
+        }
+
+        // Writer-side, the key must not be present and there must be a free slot.
+        void place(Entry * entry) {
+            size_t i = home(entry->key.hash);
+            while (slots[i].entry.load(std::memory_order_relaxed)) {
+                i = (i + 1) & mask;
+            }
+            store(i, entry);
+            ++size;
         }
+
+        // Writer-side, empties `slot` and moves later entries of the probe run back so that
+        // every remaining entry stays reachable from its home slot.
+        void unlink(size_t slot) {
+            size_t hole = slot;
+            for (size_t i = (slot + 1) & mask;; i = (i + 1) & mask) {
+                Entry * entry = slots[i].entry.load(std::memory_order_relaxed);
+                if (!entry) {
+                    break;
+                }
+                // The entry can fill the hole if the hole lies between its home and its slot.
+                if (((i - home(entry->key.hash)) & mask) >= ((i - hole) & mask)) {
+                    store(hole, entry);
+                    hole = i;
+                }
+            }
+            slots[hole].entry.store(nullptr, std::memory_order_release);
+            --size;
+        }
+
+        void store(size_t i, Entry * entry) {
+            slots[i].hash.store(static_cast<size_t>(entry->key.hash), std::memory_order_relaxed);
+            slots[i].entry.store(entry, std::memory_order_release);
+        }
+    };
+
+    /*
+     * Reclamation of unlinked entries and replaced tables, RCU style. Readers announce
+     * themselves in one of two counters, chosen by the parity of `generation`. Writers put
+     * what they unlink on the retired list of the current generation; once the previous
+     * generation's list is empty, they flip the generation and the list becomes freeable
+     * as soon as the readers that might have seen its contents (those counted under the
+     * old parity) have left.
+     */
+    struct Retired {
+        std::vector<Entry *> entries;
+        std::vector<Table *> tables;
+
+        bool empty() const { return entries.empty() && tables.empty(); }
+    };
+
+    struct TagCounters;
+
+    template <typename T, typename = void>
+    struct HasReleaseProxy : std::false_type {};
+    template <typename T>
+    struct HasReleaseProxy<T, std::void_t<decltype(T::release_proxy(
+        std::declval<const typename T::OwningProxyPointer &>()))>> : std::true_type {};
+
+    // Drops a strong reference obtained from upgrade_weak(). Traits whose OwningProxyPointer
+    // isn't released by going out of scope (a JNI local reference) provide `release_proxy()`.
+    static void release(OwningProxyPointer & proxy) {
+        if constexpr (HasReleaseProxy<Traits>::value) {
+            if (proxy) {
+                Traits::release_proxy(proxy);
+            }
+        }
+        proxy = OwningProxyPointer{};
+    }
+
+    // Owns replaced tables that have become unreachable until it goes out of scope, so that
+    // callers can free them after dropping the shard's mutex. `proxies` holds the strong
+    // references taken under the mutex, for the same reason.
+    struct Garbage {
+        std::vector<Table *> tables;
+        std::vector<OwningProxyPointer> proxies;
+        ~Garbage() {
+            for (Table * table : tables) delete table;
+            for (OwningProxyPointer & proxy : proxies) release(proxy);
+        }
+    };
+
+    // A removal queued by remove(), identified by its key's hash alone: the impl pointer
+    // may be invalid by the time it is applied (in Java it is a reference owned by the
+    // Handle being destroyed). Until then the entry stays in the table with that key, so
+    // nothing compares an entry's key without first checking that its proxy is alive.
+    struct PendingRemoval {
+        uint64_t hash;
+        TagCounters * counters;
+        PendingRemoval * next;
+    };
+
+    // Padded to a cache line so that threads working on neighbouring shards don't false-share.
+    struct alignas(64) Shard {
+        std::atomic<Table *> table { new Table(Table::kMinCapacity) };
+        std::atomic<unsigned> generation { 0 };
+        std::atomic<size_t> readers[2] = {};
+        std::mutex mutex;
+        // Guarded by mutex.
+        Retired retired[2]; // Indexed by generation parity.
+        std::vector<void *> spare_entries;
+        std::atomic<PendingRemoval *> pending { nullptr }; // Lock-free stack.
+    };
+
+    // Scope in which a reader may dereference the shard's table and entries.
+    class ReadSection {
+    public:
+        explicit ReadSection(Shard & shard) : m_shard(shard) {
+            for (;;) {
+                const unsigned generation = shard.generation.load();
+                m_parity = generation & 1;
+                shard.readers[m_parity].fetch_add(1);
+                // If a writer flipped the generation in between, it may already have
+                // checked our counter; announce ourselves again under the new parity.
+                if (shard.generation.load() == generation) {
+                    break;
+                }
+                shard.readers[m_parity].fetch_sub(1);
+            }
+        }
+        ~ReadSection() { m_shard.readers[m_parity].fetch_sub(1, std::memory_order_release); }
+        ReadSection(const ReadSection &) = delete;
+        ReadSection & operator=(const ReadSection &) = delete;
+
+        const Table * table() const { return m_shard.table.load(std::memory_order_acquire); }
+
+    private:
+        Shard & m_shard;
+        unsigned m_parity;
     };
 
     struct KeyEqual {
-        bool operator()(const Key & lhs, const Key & rhs) const {
-            return lhs.first == rhs.first
-                && UnowningImplPointerEqual{}(lhs.second, rhs.second);
+        bool operator()(const HashedKey & lhs, const HashedKey & rhs) const {
+            return lhs.hash == rhs.hash
+                && lhs.key.first == rhs.key.first
+                && UnowningImplPointerEqual{}(lhs.key.second, rhs.key.second);
+        }
+    };
+
+    /*
+     * Reader-side lookup, called without the mutex. Returns true and stores a strong
+     * reference to the live proxy for `key` in `proxy` if there is one; returns false if
+     * there is none (or if it can't tell, in which case the caller falls back to the locked
+     * path).
+     *
+     * The weak reference is upgraded *before* the impl pointers are compared: an entry can
+     * be unlinked concurrently, and only while its proxy is alive is the impl pointer stored
+     * in it (e.g. the proxy's own JNI GlobalRef) guaranteed to still be valid to compare.
+     */
+    static bool find_live(const Table & table, const HashedKey & key, OwningProxyPointer & proxy) {
+        // Entries move around under concurrent deletions, so bound the walk rather than
+        // relying on reaching an empty slot.
+        for (size_t i = table.home(key.hash), n = 0; n <= table.mask; i = (i + 1) & table.mask, ++n) {
+            const Entry * entry = table.slots[i].entry.load(std::memory_order_acquire);
+            if (!entry) {
+                break;
+            }
+            if (table.slots[i].hash.load(std::memory_order_relaxed) != static_cast<size_t>(key.hash)
+                || entry->key.hash != key.hash
+                || entry->key.key.first != key.key.first) {
+                continue;
+            }
+            proxy = upgrade_weak(entry->proxy);
+            if (!proxy) {
+                break;
+            }
+            if (UnowningImplPointerEqual{}(entry->key.key.second, key.key.second)) {
+                return true;
+            }
+            release(proxy);
+        }
+        proxy = OwningProxyPointer{};
+        return false;
+    }
+
+    static constexpr bool kCounters = DJINNI_PROXY_CACHE_COUNTERS;
+    static constexpr bool kDeferredRemovals = DJINNI_PROXY_CACHE_DEFERRED_REMOVALS;
+    static constexpr size_t kMaxCountedTags = 128;
+
+    /*
+     * Counters for one type tag. They are bumped with relaxed atomics from any thread and
+     * read the same way by counters(), so a snapshot is only approximately consistent.
+     */
+    struct alignas(64) TagCounters {
+        enum : unsigned { kFree, kClaiming, kClaimed };
+        std::atomic<unsigned> state { kFree };
+        std::optional<std::type_index> tag; // Written once, before state becomes kClaimed.
+        std::atomic<const char *> name { nullptr };
+        std::atomic<uint64_t> hits { 0 };
+        std::atomic<uint64_t> misses { 0 };
+        std::atomic<uint64_t> expired_prunes { 0 };
+        std::atomic<uint64_t> removes { 0 };
+        std::atomic<uint64_t> remove_races { 0 };
+        std::atomic<uint64_t> deferred_removes { 0 };
+        std::atomic<uint64_t> lock_contentions { 0 };
+        std::atomic<uint64_t> lock_wait_ns { 0 };
+
+        ProxyCacheCounters snapshot() const {
+            ProxyCacheCounters result;
+            result.hits = hits.load(std::memory_order_relaxed);
+            result.misses = misses.load(std::memory_order_relaxed);
+            result.expired_prunes = expired_prunes.load(std::memory_order_relaxed);
+            result.removes = removes.load(std::memory_order_relaxed);
+            result.remove_races = remove_races.load(std::memory_order_relaxed);
+            result.deferred_removes = deferred_removes.load(std::memory_order_relaxed);
+            result.lock_contentions = lock_contentions.load(std::memory_order_relaxed);
+            result.lock_wait_ns = lock_wait_ns.load(std::memory_order_relaxed);
+            return result;
         }
     };
 
-    std::unordered_map<Key, WeakProxyPointer, KeyHash, KeyEqual> m_mapping;
-    std::mutex m_mutex;
+    /*
+     * Finds (or claims) the counters for `tag` in a fixed-size, insert-only open-addressed
+     * table, without locking. The hash only picks where to start looking; slots are matched
+     * by type, so types whose hashes collide still get counters of their own. Types beyond
+     * the table's capacity share the last slot.
+     */
+    TagCounters * counters_for(const std::type_index & tag, size_t tag_hash) {
+        if constexpr (!kCounters) {
+            return nullptr;
+        } else {
+            for (size_t i = tag_hash % (kMaxCountedTags - 1), n = 0; n < kMaxCountedTags - 1;
+                 i = (i + 1) % (kMaxCountedTags - 1), ++n) {
+                TagCounters & counters = m_counters[i];
+                unsigned state = counters.state.load(std::memory_order_acquire);
+                if (state == TagCounters::kFree
+                    && counters.state.compare_exchange_strong(state, TagCounters::kClaiming,
+                                                              std::memory_order_acquire)) {
+                    counters.tag.emplace(tag);
+                    counters.name.store(tag.name(), std::memory_order_release);
+                    counters.state.store(TagCounters::kClaimed, std::memory_order_release);
+                    return &counters;
+                }
+                // Another thread is claiming the slot; that only takes a couple of stores.
+                while (state == TagCounters::kClaiming) {
+                    std::this_thread::yield();
+                    state = counters.state.load(std::memory_order_acquire);
+                }
+                if (*counters.tag == tag) {
+                    return &counters;
+                }
+            }
+            TagCounters & overflow = m_counters[kMaxCountedTags - 1];
+            overflow.name.store("<other>", std::memory_order_release);
+            return &overflow;
+        }
+    }
+
+    void count(TagCounters * counters, std::atomic<uint64_t> TagCounters::* counter,
+               uint64_t n = 1) {
+        if constexpr (kCounters) {
+            if (counters && n) {
+                (counters->*counter).fetch_add(n, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Locks the shard, recording the time spent waiting if the lock is contended.
+    std::unique_lock<std::mutex> lock_shard(Shard & shard, TagCounters * counters) {
+        if constexpr (kCounters) {
+            if (counters && !shard.mutex.try_lock()) {
+                const auto start = std::chrono::steady_clock::now();
+                shard.mutex.lock();
+                const auto waited = std::chrono::steady_clock::now() - start;
+                count(counters, &TagCounters::lock_contentions);
+                count(counters, &TagCounters::lock_wait_ns, static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()));
+                return std::unique_lock<std::mutex>(shard.mutex, std::adopt_lock);
+            }
+            if (counters) {
+                return std::unique_lock<std::mutex>(shard.mutex, std::adopt_lock);
+            }
+        }
+        return std::unique_lock<std::mutex>(shard.mutex);
+    }
+
+    // Returns the live proxy for `key` if the shard's table has one, without taking the
+    // shard's mutex. Most lookups are for proxies that are still alive.
+    static OwningProxyPointer find_unlocked(Shard & shard, const HashedKey & key) {
+        ReadSection section(shard);
+        OwningProxyPointer existing_proxy;
+        find_live(*section.table(), key, existing_proxy);
+        return existing_proxy;
+    }
+
+    /*
+     * Writer-side lookup, called with the shard's mutex held. Returns the slot of the live
+     * entry for `key` and stores a strong reference to its proxy in `proxy`, or returns npos.
+     *
+     * Like find_live(), this only compares an entry's key once its proxy is upgraded: the
+     * Handle of an expired entry may already have released the key (a deferred removal).
+     * Expired entries met along the probe run are dead whichever impl they were for, so
+     * they are erased on the way, and counted in `erased`. Strong references to the live
+     * entries that don't match go to `garbage`.
+     */
+    size_t find_locked(Shard & shard, const HashedKey & key, OwningProxyPointer & proxy,
+                       Garbage & garbage, size_t & erased) {
+        Table * table = shard.table.load(std::memory_order_relaxed);
+        for (size_t i = table->home(key.hash);;) {
+            Entry * entry = table->slots[i].entry.load(std::memory_order_relaxed);
+            if (!entry) {
+                return Table::npos;
+            }
+            if (table->slots[i].hash.load(std::memory_order_relaxed) != static_cast<size_t>(key.hash)
+                || entry->key.key.first != key.key.first) {
+                i = (i + 1) & table->mask;
+                continue;
+            }
+            OwningProxyPointer candidate = upgrade_weak(entry->proxy);
+            if (!candidate) {
+                erase(shard, *table, i);
+                ++erased;
+                // The rest of the run has shifted back into slot i, unless the table shrank.
+                Table * current = shard.table.load(std::memory_order_relaxed);
+                if (current != table) {
+                    table = current;
+                    i = table->home(key.hash);
+                }
+                continue;
+            }
+            if (KeyEqual{}(entry->key, key)) {
+                proxy = std::move(candidate);
+                return i;
+            }
+            garbage.proxies.push_back(std::move(candidate));
+            i = (i + 1) & table->mask;
+        }
+    }
+
+    // Returns the live proxy for `key`, creating it if there is none. Called with the
+    // shard's mutex held.
+    OwningProxyPointer get_locked(Shard & shard, const HashedKey & key,
+                                  const OwningImplPointer & impl, AllocatorFunction * alloc,
+                                  TagCounters * counters, Garbage & garbage) {
+        OwningProxyPointer existing_proxy;
+        size_t erased = 0;
+        const size_t slot = find_locked(shard, key, existing_proxy, garbage, erased);
+        // Expired entries for the same key are pruned eagerly.
+        count(counters, &TagCounters::expired_prunes, erased);
+        if (slot != Table::npos) {
+            count(counters, &TagCounters::hits);
+            return existing_proxy;
+        }
+
+        count(counters, &TagCounters::misses);
+        auto alloc_result = alloc(impl);
+        // The allocator returns the pointer that the proxy actually holds on to (e.g. a
+        // GlobalRef rather than the caller's local ref). It's the same object, so the hash
+        // and the shard don't change.
+        Entry * entry = make_entry(shard,
+                                   HashedKey{Key{key.key.first, alloc_result.second}, key.hash},
+                                   WeakProxyPointer(alloc_result.first));
+        insert(shard, entry);
+        return alloc_result.first;
+    }
+
+    // Called with the shard's mutex held.
+    Entry * make_entry(Shard & shard, HashedKey key, WeakProxyPointer proxy) {
+        void * storage;
+        if (shard.spare_entries.empty()) {
+            storage = ::operator new(sizeof(Entry));
+        } else {
+            storage = shard.spare_entries.back();
+            shard.spare_entries.pop_back();
+        }
+        return new (storage) Entry{std::move(key), std::move(proxy)};
+    }
+
+    static void destroy_entry(Entry * entry) {
+        entry->~Entry();
+        ::operator delete(entry);
+    }
+
+    // Called with the shard's mutex held, once no reader can reach the entry anymore.
+    // Destroying the weak reference never destroys a proxy, so this is fine under the lock.
+    void recycle_entry(Shard & shard, Entry * entry) {
+        if (shard.spare_entries.size() < kMaxSpareEntries) {
+            entry->~Entry();
+            shard.spare_entries.push_back(entry);
+        } else {
+            destroy_entry(entry);
+        }
+    }
+
+    // Called with the shard's mutex held.
+    void insert(Shard & shard, Entry * entry) {
+        Table * table = shard.table.load(std::memory_order_relaxed);
+        if ((table->size + 1) * 4 > (table->mask + 1) * 3) {
+            table = rebuild(shard, *table, table->size + 1);
+        }
+        table->place(entry);
+    }
+
+    // Called with the shard's mutex held.
+    void erase(Shard & shard, Table & table, size_t slot) {
+        Entry * entry = table.slots[slot].entry.load(std::memory_order_relaxed);
+        table.unlink(slot);
+        shard.retired[shard.generation.load(std::memory_order_relaxed) & 1].entries.push_back(entry);
+        // Give memory back once most of the proxies are gone.
+        if (table.mask + 1 > Table::kMinCapacity && table.size * 8 < table.mask + 1) {
+            rebuild(shard, table, table.size);
+        }
+    }
+
+    // Replaces the shard's table with one sized for `count` entries, at most half full.
+    // Called with the shard's mutex held.
+    Table * rebuild(Shard & shard, Table & old_table, size_t count) {
+        size_t capacity = Table::kMinCapacity;
+        while (capacity < count * 2) {
+            capacity *= 2;
+        }
+        Table * table = new Table(capacity);
+        for (size_t i = 0; i <= old_table.mask; ++i) {
+            if (Entry * entry = old_table.slots[i].entry.load(std::memory_order_relaxed)) {
+                table->place(entry);
+            }
+        }
+        shard.table.store(table, std::memory_order_release);
+        shard.retired[shard.generation.load(std::memory_order_relaxed) & 1].tables.push_back(&old_table);
+        return table;
+    }
+
+    // Applies deferred removals, then reclaims retired objects that no reader can reach
+    // anymore, and advances the generation when possible. Entries are recycled right away;
+    // tables go to `garbage`. Called with the shard's mutex held, before releasing it.
+    void collect(Shard & shard, Garbage & garbage) {
+        if constexpr (kDeferredRemovals) {
+            PendingRemoval * removal = shard.pending.exchange(nullptr, std::memory_order_acquire);
+            while (removal) {
+                apply_removal(shard, *removal, garbage);
+                PendingRemoval * next = removal->next;
+                delete removal;
+                removal = next;
+            }
+        }
+        unsigned generation = shard.generation.load(std::memory_order_relaxed);
+        Retired & previous = shard.retired[(generation + 1) & 1];
+        if (!previous.empty()) {
+            if (shard.readers[(generation + 1) & 1].load() != 0) {
+                return;
+            }
+            reclaim(shard, previous, garbage);
+        }
+        Retired & current = shard.retired[generation & 1];
+        if (!current.empty()) {
+            shard.generation.store(++generation);
+            if (shard.readers[(generation + 1) & 1].load() == 0) {
+                reclaim(shard, current, garbage);
+            }
+        }
+    }
+
+    // Erases an expired entry with the removal's hash. Any such entry is dead, whether or not
+    // it's the one the removal was queued for, and if a new proxy has been created for the
+    // same impl in the meantime its entry is live and stays.
+    void apply_removal(Shard & shard, const PendingRemoval & removal, Garbage & garbage) {
+        Table & table = *shard.table.load(std::memory_order_relaxed);
+        bool found_live = false;
+        for (size_t i = table.home(removal.hash);; i = (i + 1) & table.mask) {
+            Entry * entry = table.slots[i].entry.load(std::memory_order_relaxed);
+            if (!entry) {
+                break;
+            }
+            if (entry->key.hash != removal.hash) {
+                continue;
+            }
+            if (OwningProxyPointer proxy = upgrade_weak(entry->proxy)) {
+                garbage.proxies.push_back(std::move(proxy));
+                found_live = true;
+            } else {
+                erase(shard, table, i);
+                count(removal.counters, &TagCounters::removes);
+                return;
+            }
+        }
+        if (found_live) {
+            count(removal.counters, &TagCounters::remove_races);
+        }
+    }
+
+    void reclaim(Shard & shard, Retired & retired, Garbage & garbage) {
+        for (Entry * entry : retired.entries) {
+            recycle_entry(shard, entry);
+        }
+        garbage.tables.insert(garbage.tables.end(), retired.tables.begin(), retired.tables.end());
+        retired.entries.clear();
+        retired.tables.clear();
+    }
+
+    static HashedKey make_key(const std::type_index & tag, size_t tag_hash,
+                              const UnowningImplPointer & ptr) {
+        const uint64_t hash = tag_hash ^ UnowningImplPointerHash{}(ptr);
+        return HashedKey{Key{tag, ptr}, hash * UINT64_C(0x9E3779B97F4A7C15)};
+    }
+
+    static size_t shard_index(uint64_t hash) {
+        if constexpr (kShardCount == 1) {
+            return 0;
+        } else {
+            return static_cast<size_t>(hash >> (64 - kShardBits));
+        }
+    }
+
+    Shard & shard_for(uint64_t hash) {
+        return m_shards[shard_index(hash)];
+    }
+
+    std::array<Shard, kShardCount> m_shards;
+    std::array<TagCounters, kCounters ? kMaxCountedTags : 1> m_counters;
 
     // Only ProxyCache<Traits>::get_base() can allocate these objects.
     Pimpl() = default;
@@ -202,10 +936,29 @@ auto ProxyCache<Traits>::get(const std::type_index & tag,
     return get_base()->get(tag, impl, alloc);
 }
 
+template <typename Traits>
+void ProxyCache<Traits>::get_batch(const std::type_index & tag,
+                                   const OwningImplPointer * impls,
+                                   size_t count,
+                                   AllocatorFunction * alloc,
+                                   OwningProxyPointer * proxies) {
+    get_base()->get_batch(tag, impls, count, alloc, proxies);
+}
+
 template<typename Traits>
 std::unordered_map<const char*, size_t> ProxyCache<Traits>::stats() {
     return get_base()->stats();
 }
 
+template<typename Traits>
+void ProxyCache<Traits>::drain() {
+    get_base()->drain();
+}
+
+template<typename Traits>
+std::unordered_map<const char*, ProxyCacheCounters> ProxyCache<Traits>::counters() {
+    return get_base()->counters();
+}
+
 
 } // namespace djinni
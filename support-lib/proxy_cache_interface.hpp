@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <functional>
 #include <typeindex>
@@ -41,6 +42,38 @@ template <typename T> static inline auto get_unowning(const T & ptr) -> decltype
 }
 template <typename T> static inline T * get_unowning(T * ptr) { return ptr; }
 
+/*
+ * Tag for constructing a ProxyCache::Handle for a proxy that was created without going
+ * through the cache; see ProxyCache::Handle.
+ */
+struct ProxyCacheBypass {};
+
+/*
+ * Running totals kept by a ProxyCache for one translated type; see ProxyCache::counters().
+ * Every get() is either a hit or a miss, and every miss creates a proxy. Entries for dead
+ * proxies are dropped either by remove() (`removes`) or, if a get() for an object with the
+ * same hash came first, by get() (`expired_prunes`). `remove_races` counts the remove() calls
+ * that found a live proxy because a new one had already replaced the dying one. With
+ * DJINNI_PROXY_CACHE_DEFERRED_REMOVALS, removals are counted when they're applied.
+ */
+struct ProxyCacheCounters {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t expired_prunes = 0;
+    uint64_t removes = 0;
+    uint64_t remove_races = 0;
+    uint64_t deferred_removes = 0; // removals left for another thread to apply
+    uint64_t lock_contentions = 0; // lock acquisitions that had to wait
+    uint64_t lock_wait_ns = 0;     // total time spent waiting for those
+
+    // Approximate number of entries currently in the cache. A snapshot taken during traffic
+    // can count a removal but not yet the miss that created the entry, hence the clamp.
+    uint64_t live() const {
+        const uint64_t dropped = expired_prunes + removes;
+        return misses > dropped ? misses - dropped : 0;
+    }
+};
+
 /*
  * ProxyCache provides a mechanism for re-using proxy objects generated in one language
  * that wrap around implementations in a different language. This is for correctness, not
@@ -69,6 +102,10 @@ template <typename T> static inline T * get_unowning(T * ptr) { return ptr; }
  *       an equality predicate for UnowningImplPointer, like std::equal_to<UnowningImplPointer>.
  *       In some cases (e.g. Java) a custom equality predicate may be needed.
  *
+ * It may also define `static void release_proxy(const OwningProxyPointer &)`, which the
+ * cache calls to drop the strong references it takes internally when OwningProxyPointer
+ * isn't released by going out of scope (e.g. a JNI local reference).
+ *
  * Generally, ProxyCache will be explicitly instantiated in one source file with C++11's
  * `extern template` mechanism. The WeakProxyPointer, UnowningImplPointerHash, and
  * UnowningImplPointerEqual types can be incomplete except for where the explicit
@@ -97,8 +134,11 @@ template <typename T> static inline T * get_unowning(T * ptr) { return ptr; }
  * impl, do we already have a proxy in existence?"
  *
  * We use one map for all translated types, rather than a separate one for each type,
- * to minimize duplication of code and make it so the unordered_map is as contained as
- * possible.
+ * to minimize duplication of code and make it so the hash table is as contained as
+ * possible. The map is split into DJINNI_PROXY_CACHE_SHARDS independently locked shards
+ * (see proxy_cache_impl.hpp), selected by the hash of the key, so that unrelated objects
+ * crossing the boundary on different threads don't contend on the same lock. Lookups that
+ * find a live proxy don't take the lock at all; only misses and removals do.
  */
 template <typename Traits>
 class ProxyCache {
@@ -129,15 +169,21 @@ public:
      * created. Normally this is the same as T (a specialized OwningImplPointer), but in
      * cases like Java where all object types are uniformly represented as `jobject` in C++,
      * another type may be used.
+     *
+     * Proxies for interfaces that opt out of identity caching (`uncached` in the IDL) are
+     * created directly rather than by `get()`. Their Handle is constructed with a leading
+     * ProxyCacheBypass argument, and its destructor leaves the cache alone.
      */
     template <typename T, typename TagType = T>
     class Handle {
     public:
         template <typename... Args> Handle(Args &&... args)
             : m_cache(get_base()), m_obj(std::forward<Args>(args)...) {}
+        template <typename... Args> Handle(ProxyCacheBypass, Args &&... args)
+            : m_obj(std::forward<Args>(args)...) {}
         Handle(const Handle &) = delete;
         Handle & operator=(const Handle &) = delete;
-        ~Handle() { if (m_obj) cleanup(m_cache, typeid(TagType), get_unowning(m_obj)); }
+        ~Handle() { if (m_obj && m_cache) cleanup(m_cache, typeid(TagType), get_unowning(m_obj)); }
 
         void assign(const T & obj) { m_obj = obj; }
 
@@ -178,8 +224,37 @@ public:
                                   const OwningImplPointer & impl,
                                   AllocatorFunction * alloc);
 
+    /*
+     * Batch version of get(), for collections: stores the proxies for `count` objects of
+     * the same type in `proxies`. The objects that don't already have a live proxy are
+     * handled together, taking the cache's locks once per batch rather than once per
+     * object. None of the `impls` may be null.
+     */
+    static void get_batch(const std::type_index &,
+                          const OwningImplPointer * impls,
+                          size_t count,
+                          AllocatorFunction * alloc,
+                          OwningProxyPointer * proxies);
+
+    /*
+     * Applies the removals that Handle destructors have left queued (only possible when
+     * built with DJINNI_PROXY_CACHE_DEFERRED_REMOVALS; see proxy_cache_impl.hpp). They are
+     * otherwise applied by whichever thread next locks the same part of the cache, so a
+     * periodic call only matters if some objects stop crossing the boundary altogether.
+     */
+    static void drain();
+
     static std::unordered_map<const char*, size_t> stats();
 
+    /*
+     * Returns the counters for each type (keyed by std::type_info::name()) that has gone
+     * through the cache. Unlike stats() this doesn't take any locks, so it can be polled
+     * while the cache is in use; the counters are read individually, so a snapshot taken
+     * concurrently with traffic is only approximately consistent. Empty if the counters are
+     * compiled out (DJINNI_PROXY_CACHE_COUNTERS=0).
+     */
+    static std::unordered_map<const char*, ProxyCacheCounters> counters();
+
 private:
     static void cleanup(const std::shared_ptr<Pimpl> &,
                         const std::type_index &,
@@ -0,0 +1,39 @@
+/**
+  * Copyright 2021 Snap, Inc.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  *    http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "../cpp/ProtobufArena.hpp"
+
+namespace djinni {
+
+// Protobuf<> that parses into the thread's ProtobufArenaScope; see ArenaProtobuf in
+// ProtobufArena_jni.hpp.
+template<typename CppProto, typename JsProto>
+class ArenaProtobuf : public Protobuf<CppProto, JsProto> {
+public:
+    using Boxed = ArenaProtobuf;
+
+    static ArenaMessage<CppProto> toCpp(em::val j)
+    {
+        ArenaMessage<CppProto> ret;
+        Protobuf<CppProto, JsProto>::parseInto(j, ret.get());
+        return ret;
+    }
+};
+
+} // namespace djinni
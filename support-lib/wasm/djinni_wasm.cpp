@@ -46,12 +46,17 @@ std::unordered_map<void*, CppProxyCacheEntry> cppProxyCache;
 std::mutex jsProxyCacheMutex;
 std::mutex cppProxyCacheMutex;
 
-JsProxyBase::JsProxyBase(const em::val& v) : _js(v), _id(_js["_djinni_js_proxy_id"].as<JsProxyId>()) {
+JsProxyBase::JsProxyBase(const em::val& v, bool cached) : _js(v) {
+    if (cached) {
+        _id = _js["_djinni_js_proxy_id"].as<JsProxyId>();
+    }
 }
 
 JsProxyBase::~JsProxyBase() {
-    std::lock_guard lk(jsProxyCacheMutex);
-    jsProxyCache.erase(_id);
+    if (_id) {
+        std::lock_guard lk(jsProxyCacheMutex);
+        jsProxyCache.erase(*_id);
+    }
 }
 
 const em::val& JsProxyBase::_jsRef() const {
@@ -277,12 +277,19 @@ public:
     using Boxed = Protobuf;
 
     static CppType toCpp(JsType j)
+    {
+        CppProto ret;
+        parseInto(j, ret);
+        return ret;
+    }
+
+    // Parses the JS message j into ret, which may live on an arena (see ArenaProtobuf)
+    static void parseInto(JsType j, CppProto& ret)
     {
         em::val jsClass = JsProto::resolve();
         auto writer = jsClass.call<em::val>("encode", j);
         auto bytes = writer.call<em::val>("finish");
         size_t length = bytes["byteLength"].as<int>();
-        CppProto ret;
         if (bytes["buffer"] == getWasmMemoryBuffer()) {
             const void* pbytes = reinterpret_cast<void*>(bytes["byteOffset"].as<unsigned>());
             ret.ParseFromArray(pbytes, static_cast<int>(length));
@@ -292,7 +299,6 @@ public:
             writeNativeMemory(bytes, reinterpret_cast<uint32_t>(cbuf.data()));
             ret.ParseFromArray(cbuf.data(), static_cast<int>(length));
         }
-        return ret;
     }
         
     static JsType fromCpp(const CppType& c)
@@ -447,7 +453,8 @@ private:
 
 class JsProxyBase {
 public:
-    JsProxyBase(const em::val& v);
+    // Proxies for uncached interfaces pass cached = false and aren't in jsProxyCache.
+    JsProxyBase(const em::val& v, bool cached = true);
     virtual ~JsProxyBase();
     const em::val& _jsRef() const;
     template<typename ...Args>
@@ -459,7 +466,7 @@ protected:
     void checkError(const em::val& v);
 private:
     em::val _js;
-    JsProxyId _id;
+    std::optional<JsProxyId> _id;
 };
 
 struct CppProxyCacheEntry {
@@ -475,9 +482,22 @@ extern std::mutex cppProxyCacheMutex;
 
 void checkForNull(void* ptr, const char* context);
 
+// Whether the proxies for an interface go through jsProxyCache and cppProxyCache.
+// Helpers for interfaces declared `uncached` in the IDL define
+// `static constexpr bool kUsesProxyCache = false`, and get a new proxy each time an
+// object crosses the boundary.
+template <typename Self, typename = void>
+struct JsUsesProxyCache : std::true_type {};
+template <typename Self>
+struct JsUsesProxyCache<Self, std::void_t<decltype(Self::kUsesProxyCache)>>
+    : std::integral_constant<bool, Self::kUsesProxyCache> {};
+
 template<typename I, typename Self>
 struct JsInterface {
     static void nativeDestroy(const ::djinni::SharedPtr<I>& cpp) {
+        if constexpr (!JsUsesProxyCache<Self>::value) {
+            return;
+        }
         std::lock_guard lk(cppProxyCacheMutex);
         auto i = cppProxyCache.find(cpp.get());
         assert(i != cppProxyCache.end());
@@ -497,6 +517,12 @@ struct JsInterface {
     template <typename T>
     struct GetOrCreateCppProxy<T, std::void_t<decltype(T::cppProxyMethods)>> {
         em::val operator() (const ::djinni::SharedPtr<I>& c) {
+            if constexpr (!JsUsesProxyCache<Self>::value) {
+                em::val nativeRef(c);
+                em::val cppProxy = getCppProxyClass().new_(nativeRef, Self::cppProxyMethods());
+                getCppProxyFinalizerRegistry().call<void>("register", cppProxy, nativeRef);
+                return cppProxy;
+            }
             // look up in cpp proxy cache
             std::lock_guard lk(cppProxyCacheMutex);
             auto i = cppProxyCache.find(c.get());
@@ -549,6 +575,9 @@ struct JsInterface {
     template <typename T>
     struct GetOrCreateJsProxy<T, std::void_t<typename T::JsProxy>> {
         ::djinni::SharedPtr<I> operator() (em::val js) {
+            if constexpr (!JsUsesProxyCache<Self>::value) {
+                return djinni::makeShared<typename Self::JsProxy>(js);
+            }
             std::lock_guard lk(jsProxyCacheMutex);
             // check prsence of proxy id in js object
             JsProxyId id;
@@ -0,0 +1,22 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#include "packed_primitives.hpp"  // my header
+
+namespace testsuite {
+
+
+bool operator==(const PackedPrimitives& lhs, const PackedPrimitives& rhs) {
+    return lhs.b == rhs.b &&
+           lhs.eight == rhs.eight &&
+           lhs.sixteen == rhs.sixteen &&
+           lhs.fthirtytwo == rhs.fthirtytwo &&
+           lhs.fsixtyfour == rhs.fsixtyfour &&
+           lhs.hue == rhs.hue;
+}
+
+bool operator!=(const PackedPrimitives& lhs, const PackedPrimitives& rhs) {
+    return !(lhs == rhs);
+}
+
+} // namespace testsuite
@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#pragma once
+
+#include "color.hpp"
+#include <cstdint>
+#include <utility>
+
+namespace testsuite {
+
+/** Only primitives and an enum, so JNI passes lists of it packed into a long[] */
+struct PackedPrimitives final {
+    bool b;
+    int8_t eight;
+    int16_t sixteen;
+    float fthirtytwo;
+    double fsixtyfour;
+    color hue;
+
+    friend bool operator==(const PackedPrimitives& lhs, const PackedPrimitives& rhs);
+    friend bool operator!=(const PackedPrimitives& lhs, const PackedPrimitives& rhs);
+
+    PackedPrimitives(bool b_,
+                     int8_t eight_,
+                     int16_t sixteen_,
+                     float fthirtytwo_,
+                     double fsixtyfour_,
+                     color hue_)
+    : b(std::move(b_))
+    , eight(std::move(eight_))
+    , sixteen(std::move(sixteen_))
+    , fthirtytwo(std::move(fthirtytwo_))
+    , fsixtyfour(std::move(fsixtyfour_))
+    , hue(std::move(hue_))
+    {}
+};
+
+} // namespace testsuite
@@ -9,6 +9,7 @@
 #include "proto/cpp/test2.pb.h"
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace testsuite {
@@ -45,6 +46,10 @@ public:
     static std::experimental::optional<::djinni::test::Person> stringToOptionalProto(const std::string & x);
 
     static djinni::expected<::djinni::test::Person, int32_t> stringToProtoOutcome(const std::string & x);
+
+    static std::unordered_map<std::string, std::string> protoMapToStrings(const std::unordered_map<std::string, ::djinni::test::Person> & x);
+
+    static std::unordered_map<std::string, ::djinni::test::Person> stringsToProtoMap(const std::unordered_map<std::string, std::string> & x);
 };
 
 } // namespace testsuite
@@ -0,0 +1,22 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace testsuite {
+
+class TestInternedString {
+public:
+    virtual ~TestInternedString() = default;
+
+    /**
+     * "ok", "not_found" or "café" for codes 0 to 2, and otherwise a description too long
+     * for the JNI string cache
+     */
+    static std::string status_name(int32_t code);
+};
+
+} // namespace testsuite
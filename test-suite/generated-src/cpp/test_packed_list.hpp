@@ -0,0 +1,19 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#pragma once
+
+#include <vector>
+
+namespace testsuite {
+
+struct PackedPrimitives;
+
+class TestPackedList {
+public:
+    virtual ~TestPackedList() = default;
+
+    static std::vector<PackedPrimitives> reverse_list(const std::vector<PackedPrimitives> & l);
+};
+
+} // namespace testsuite
@@ -0,0 +1,28 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace testsuite {
+
+class UncachedToken;
+
+class TestUncached {
+public:
+    virtual ~TestUncached() = default;
+
+    static /*not-null*/ std::shared_ptr<UncachedToken> create_cpp_token();
+
+    static /*not-null*/ std::shared_ptr<UncachedToken> token_id(const /*not-null*/ std::shared_ptr<UncachedToken> & t);
+
+    /** Whether `a` and `b` reached C++ as the same object */
+    static bool same_token(const /*not-null*/ std::shared_ptr<UncachedToken> & a, const /*not-null*/ std::shared_ptr<UncachedToken> & b);
+
+    /** `t` converted back to the caller's language twice */
+    static std::vector</*not-null*/ std::shared_ptr<UncachedToken>> token_twice(const /*not-null*/ std::shared_ptr<UncachedToken> & t);
+};
+
+} // namespace testsuite
@@ -0,0 +1,25 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace testsuite {
+
+class ZeroCopySource;
+
+class TestZeroCopy {
+public:
+    virtual ~TestZeroCopy() = default;
+
+    /** `size` bytes counting up from 0 and wrapping around at 256 */
+    static std::vector<uint8_t> make_bytes(int32_t size);
+
+    /** What C++ receives from `source.get_bytes(size)` */
+    static std::vector<uint8_t> read_source(const /*not-null*/ std::shared_ptr<ZeroCopySource> & source, int32_t size);
+};
+
+} // namespace testsuite
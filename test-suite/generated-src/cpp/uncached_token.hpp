@@ -0,0 +1,17 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#pragma once
+
+#include <string>
+
+namespace testsuite {
+
+class UncachedToken {
+public:
+    virtual ~UncachedToken() = default;
+
+    virtual std::string whoami() = 0;
+};
+
+} // namespace testsuite
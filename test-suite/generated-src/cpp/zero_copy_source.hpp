@@ -0,0 +1,18 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace testsuite {
+
+class ZeroCopySource {
+public:
+    virtual ~ZeroCopySource() = default;
+
+    virtual std::vector<uint8_t> get_bytes(int32_t size) = 0;
+};
+
+} // namespace testsuite
@@ -32,4 +32,21 @@ public class ExtendedRecord {
         "}";
     }
 
+    /*package*/ static long[] packList(java.util.ArrayList<ExtendedRecord> list) {
+        long[] packed = new long[list.size() * 1];
+        int i = 0;
+        for (ExtendedRecord value : list) {
+            packed[i++] = value.mFoo ? 1 : 0;
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<ExtendedRecord> unpackList(long[] packed) {
+        java.util.ArrayList<ExtendedRecord> list = new java.util.ArrayList<ExtendedRecord>(packed.length / 1);
+        for (int i = 0; i < packed.length; i += 1) {
+            list.add(new ExtendedRecord(packed[i] != 0));
+        }
+        return list;
+    }
+
 }
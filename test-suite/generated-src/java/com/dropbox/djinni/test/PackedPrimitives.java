@@ -0,0 +1,132 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Only primitives and an enum, so JNI passes lists of it packed into a long[] */
+public class PackedPrimitives {
+
+
+    /*package*/ final boolean mB;
+
+    /*package*/ final byte mEight;
+
+    /*package*/ final short mSixteen;
+
+    /*package*/ final float mFthirtytwo;
+
+    /*package*/ final double mFsixtyfour;
+
+    /*package*/ final Color mHue;
+
+    public PackedPrimitives(
+            boolean b,
+            byte eight,
+            short sixteen,
+            float fthirtytwo,
+            double fsixtyfour,
+            @Nonnull Color hue) {
+        this.mB = b;
+        this.mEight = eight;
+        this.mSixteen = sixteen;
+        this.mFthirtytwo = fthirtytwo;
+        this.mFsixtyfour = fsixtyfour;
+        this.mHue = hue;
+    }
+
+    public boolean getB() {
+        return mB;
+    }
+
+    public byte getEight() {
+        return mEight;
+    }
+
+    public short getSixteen() {
+        return mSixteen;
+    }
+
+    public float getFthirtytwo() {
+        return mFthirtytwo;
+    }
+
+    public double getFsixtyfour() {
+        return mFsixtyfour;
+    }
+
+    @Nonnull
+    public Color getHue() {
+        return mHue;
+    }
+
+    @Override
+    public boolean equals(@CheckForNull Object obj) {
+        if (!(obj instanceof PackedPrimitives)) {
+            return false;
+        }
+        PackedPrimitives other = (PackedPrimitives) obj;
+        return this.mB == other.mB &&
+                this.mEight == other.mEight &&
+                this.mSixteen == other.mSixteen &&
+                this.mFthirtytwo == other.mFthirtytwo &&
+                this.mFsixtyfour == other.mFsixtyfour &&
+                this.mHue == other.mHue;
+    }
+
+    @Override
+    public int hashCode() {
+        // Pick an arbitrary non-zero starting value
+        int hashCode = 17;
+        hashCode = hashCode * 31 + (mB ? 1 : 0);
+        hashCode = hashCode * 31 + mEight;
+        hashCode = hashCode * 31 + mSixteen;
+        hashCode = hashCode * 31 + Float.floatToIntBits(mFthirtytwo);
+        hashCode = hashCode * 31 + ((int) (Double.doubleToLongBits(mFsixtyfour) ^ (Double.doubleToLongBits(mFsixtyfour) >>> 32)));
+        hashCode = hashCode * 31 + mHue.hashCode();
+        return hashCode;
+    }
+
+    @Override
+    public String toString() {
+        return "PackedPrimitives{" +
+                "mB=" + mB +
+                "," + "mEight=" + mEight +
+                "," + "mSixteen=" + mSixteen +
+                "," + "mFthirtytwo=" + mFthirtytwo +
+                "," + "mFsixtyfour=" + mFsixtyfour +
+                "," + "mHue=" + mHue +
+        "}";
+    }
+
+    /*package*/ static long[] packList(java.util.ArrayList<PackedPrimitives> list) {
+        long[] packed = new long[list.size() * 6];
+        int i = 0;
+        for (PackedPrimitives value : list) {
+            packed[i++] = value.mB ? 1 : 0;
+            packed[i++] = value.mEight;
+            packed[i++] = value.mSixteen;
+            packed[i++] = Float.floatToRawIntBits(value.mFthirtytwo);
+            packed[i++] = Double.doubleToRawLongBits(value.mFsixtyfour);
+            packed[i++] = value.mHue.ordinal();
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<PackedPrimitives> unpackList(long[] packed) {
+        Color[] hueValues = Color.values();
+        java.util.ArrayList<PackedPrimitives> list = new java.util.ArrayList<PackedPrimitives>(packed.length / 6);
+        for (int i = 0; i < packed.length; i += 6) {
+            list.add(new PackedPrimitives(packed[i] != 0,
+                                          (byte) packed[i + 1],
+                                          (short) packed[i + 2],
+                                          Float.intBitsToFloat((int) packed[i + 3]),
+                                          Double.longBitsToDouble(packed[i + 4]),
+                                          hueValues[(int) packed[i + 5]]));
+        }
+        return list;
+    }
+
+}
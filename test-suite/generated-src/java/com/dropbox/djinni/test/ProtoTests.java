@@ -8,6 +8,7 @@ import djinni.test.Test.AddressBook;
 import djinni.test.Test.Person;
 import djinni.test2.Test2.PersistingState;
 import java.util.ArrayList;
+import java.util.HashMap;
 import java.util.concurrent.atomic.AtomicBoolean;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
@@ -52,6 +53,12 @@ public abstract class ProtoTests {
     @Nonnull
     public static native com.snapchat.djinni.Outcome<Person, Integer> stringToProtoOutcome(@Nonnull String x);
 
+    @Nonnull
+    public static native HashMap<String, String> protoMapToStrings(@Nonnull HashMap<String, Person> x);
+
+    @Nonnull
+    public static native HashMap<String, Person> stringsToProtoMap(@Nonnull HashMap<String, String> x);
+
     public static final class CppProxy extends ProtoTests
     {
         private final long nativeRef;
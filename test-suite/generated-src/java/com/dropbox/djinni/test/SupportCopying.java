@@ -27,4 +27,21 @@ public class SupportCopying {
         "}";
     }
 
+    /*package*/ static long[] packList(java.util.ArrayList<SupportCopying> list) {
+        long[] packed = new long[list.size() * 1];
+        int i = 0;
+        for (SupportCopying value : list) {
+            packed[i++] = value.mX;
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<SupportCopying> unpackList(long[] packed) {
+        java.util.ArrayList<SupportCopying> list = new java.util.ArrayList<SupportCopying>(packed.length / 1);
+        for (int i = 0; i < packed.length; i += 1) {
+            list.add(new SupportCopying((int) packed[i]));
+        }
+        return list;
+    }
+
 }
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+package com.dropbox.djinni.test;
+
+import com.snapchat.djinni.NativeObjectManager;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class TestInternedString {
+    /**
+     * "ok", "not_found" or "café" for codes 0 to 2, and otherwise a description too long
+     * for the JNI string cache
+     */
+    @Nonnull
+    public static native String statusName(int code);
+
+    public static final class CppProxy extends TestInternedString
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            NativeObjectManager.register(this, nativeRef);
+        }
+        public static native void nativeDestroy(long nativeRef);
+    }
+}
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+package com.dropbox.djinni.test;
+
+import com.snapchat.djinni.NativeObjectManager;
+import java.util.ArrayList;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class TestPackedList {
+    @Nonnull
+    public static native ArrayList<PackedPrimitives> reverseList(@Nonnull ArrayList<PackedPrimitives> l);
+
+    public static final class CppProxy extends TestPackedList
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            NativeObjectManager.register(this, nativeRef);
+        }
+        public static native void nativeDestroy(long nativeRef);
+    }
+}
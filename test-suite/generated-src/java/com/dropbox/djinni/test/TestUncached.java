@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+package com.dropbox.djinni.test;
+
+import com.snapchat.djinni.NativeObjectManager;
+import java.util.ArrayList;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class TestUncached {
+    @CheckForNull
+    public static native UncachedToken createCppToken();
+
+    @CheckForNull
+    public static native UncachedToken tokenId(@CheckForNull UncachedToken t);
+
+    /** Whether `a` and `b` reached C++ as the same object */
+    public static native boolean sameToken(@CheckForNull UncachedToken a, @CheckForNull UncachedToken b);
+
+    /** `t` converted back to the caller's language twice */
+    @Nonnull
+    public static native ArrayList<UncachedToken> tokenTwice(@CheckForNull UncachedToken t);
+
+    public static final class CppProxy extends TestUncached
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            NativeObjectManager.register(this, nativeRef);
+        }
+        public static native void nativeDestroy(long nativeRef);
+    }
+}
@@ -0,0 +1,33 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+package com.dropbox.djinni.test;
+
+import com.snapchat.djinni.NativeObjectManager;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class TestZeroCopy {
+    /** `size` bytes counting up from 0 and wrapping around at 256 */
+    @Nonnull
+    public static native java.nio.ByteBuffer makeBytes(int size);
+
+    /** What C++ receives from `source.get_bytes(size)` */
+    @Nonnull
+    public static native byte[] readSource(@CheckForNull ZeroCopySource source, int size);
+
+    public static final class CppProxy extends TestZeroCopy
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            NativeObjectManager.register(this, nativeRef);
+        }
+        public static native void nativeDestroy(long nativeRef);
+    }
+}
@@ -0,0 +1,36 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+package com.dropbox.djinni.test;
+
+import com.snapchat.djinni.NativeObjectManager;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class UncachedToken {
+    @Nonnull
+    public abstract String whoami();
+
+    public static final class CppProxy extends UncachedToken
+    {
+        private final long nativeRef;
+        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            NativeObjectManager.register(this, nativeRef);
+        }
+        public static native void nativeDestroy(long nativeRef);
+
+        @Override
+        public String whoami()
+        {
+            assert !this.destroyed.get() : "trying to use a destroyed object";
+            return native_whoami(this.nativeRef);
+        }
+        private native String native_whoami(long _nativeRef);
+    }
+}
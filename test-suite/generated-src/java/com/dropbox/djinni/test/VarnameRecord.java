@@ -32,4 +32,21 @@ public class VarnameRecord {
         "}";
     }
 
+    /*package*/ static long[] packList(java.util.ArrayList<VarnameRecord> list) {
+        long[] packed = new long[list.size() * 1];
+        int i = 0;
+        for (VarnameRecord value : list) {
+            packed[i++] = value.mField;
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<VarnameRecord> unpackList(long[] packed) {
+        java.util.ArrayList<VarnameRecord> list = new java.util.ArrayList<VarnameRecord>(packed.length / 1);
+        for (int i = 0; i < packed.length; i += 1) {
+            list.add(new VarnameRecord((byte) packed[i]));
+        }
+        return list;
+    }
+
 }
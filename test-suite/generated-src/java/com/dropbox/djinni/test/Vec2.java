@@ -55,4 +55,23 @@ public class Vec2 {
         "}";
     }
 
+    /*package*/ static long[] packList(java.util.ArrayList<Vec2> list) {
+        long[] packed = new long[list.size() * 2];
+        int i = 0;
+        for (Vec2 value : list) {
+            packed[i++] = value.mX;
+            packed[i++] = value.mY;
+        }
+        return packed;
+    }
+
+    /*package*/ static java.util.ArrayList<Vec2> unpackList(long[] packed) {
+        java.util.ArrayList<Vec2> list = new java.util.ArrayList<Vec2>(packed.length / 2);
+        for (int i = 0; i < packed.length; i += 2) {
+            list.add(new Vec2((int) packed[i],
+                              (int) packed[i + 1]));
+        }
+        return list;
+    }
+
 }
@@ -0,0 +1,12 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class ZeroCopySource {
+    @Nonnull
+    public abstract java.nio.ByteBuffer getBytes(int size);
+}
@@ -25,4 +25,26 @@ auto NativeExtendedRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
     return {::djinni::Bool::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mFoo))};
 }
 
+void NativeExtendedRecord::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::Bool::pack(c.foo);
+}
+
+auto NativeExtendedRecord::unpack(const jlong* in) -> CppType {
+    return {::djinni::Bool::unpack(in[0])};
+}
+
+auto NativeExtendedRecord::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativeExtendedRecord>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeExtendedRecord::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeExtendedRecord>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
 } // namespace djinni_generated
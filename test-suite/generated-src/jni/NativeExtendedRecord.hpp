@@ -20,12 +20,21 @@ public:
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
 
+    // Lists of this record cross JNI as a long[] with one slot per field (see ::djinni::List)
+    static constexpr size_t kPackedFields = 1;
+    static void pack(const CppType& c, jlong* out);
+    static CppType unpack(const jlong* in);
+    static ::djinni::LocalRef<jlongArray> packList(JNIEnv* jniEnv, jobject list);
+    static ::djinni::LocalRef<jobject> unpackList(JNIEnv* jniEnv, jlongArray packed);
+
 private:
     NativeExtendedRecord();
     friend ::djinni::JniClass<NativeExtendedRecord>;
 
     const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/ExtendedRecord") };
     const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(Z)V") };
+    const jmethodID jpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "packList", "(Ljava/util/ArrayList;)[J") };
+    const jmethodID junpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "unpackList", "([J)Ljava/util/ArrayList;") };
     const jfieldID field_mFoo { ::djinni::jniGetFieldID(clazz.get(), "mFoo", "Z") };
 };
 
@@ -0,0 +1,71 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#include "NativePackedPrimitives.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeColor.hpp"
+
+namespace djinni_generated {
+
+NativePackedPrimitives::NativePackedPrimitives() = default;
+
+NativePackedPrimitives::~NativePackedPrimitives() = default;
+
+auto NativePackedPrimitives::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    const auto& data = ::djinni::JniClass<NativePackedPrimitives>::get();
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::Bool::fromCpp(jniEnv, c.b)),
+                                                           ::djinni::get(::djinni::I8::fromCpp(jniEnv, c.eight)),
+                                                           ::djinni::get(::djinni::I16::fromCpp(jniEnv, c.sixteen)),
+                                                           ::djinni::get(::djinni::F32::fromCpp(jniEnv, c.fthirtytwo)),
+                                                           ::djinni::get(::djinni::F64::fromCpp(jniEnv, c.fsixtyfour)),
+                                                           ::djinni::get(::djinni_generated::NativeColor::fromCpp(jniEnv, c.hue)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativePackedPrimitives::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, 7);
+    assert(j != nullptr);
+    const auto& data = ::djinni::JniClass<NativePackedPrimitives>::get();
+    return {::djinni::Bool::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mB)),
+            ::djinni::I8::toCpp(jniEnv, jniEnv->GetByteField(j, data.field_mEight)),
+            ::djinni::I16::toCpp(jniEnv, jniEnv->GetShortField(j, data.field_mSixteen)),
+            ::djinni::F32::toCpp(jniEnv, jniEnv->GetFloatField(j, data.field_mFthirtytwo)),
+            ::djinni::F64::toCpp(jniEnv, jniEnv->GetDoubleField(j, data.field_mFsixtyfour)),
+            ::djinni_generated::NativeColor::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mHue))};
+}
+
+void NativePackedPrimitives::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::Bool::pack(c.b);
+    out[1] = ::djinni::I8::pack(c.eight);
+    out[2] = ::djinni::I16::pack(c.sixteen);
+    out[3] = ::djinni::F32::pack(c.fthirtytwo);
+    out[4] = ::djinni::F64::pack(c.fsixtyfour);
+    out[5] = static_cast<jlong>(c.hue);
+}
+
+auto NativePackedPrimitives::unpack(const jlong* in) -> CppType {
+    return {::djinni::Bool::unpack(in[0]),
+            ::djinni::I8::unpack(in[1]),
+            ::djinni::I16::unpack(in[2]),
+            ::djinni::F32::unpack(in[3]),
+            ::djinni::F64::unpack(in[4]),
+            static_cast<::testsuite::color>(in[5])};
+}
+
+auto NativePackedPrimitives::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativePackedPrimitives>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativePackedPrimitives::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativePackedPrimitives>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,46 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "packed_primitives.hpp"
+
+namespace djinni_generated {
+
+class NativePackedPrimitives final {
+public:
+    using CppType = ::testsuite::PackedPrimitives;
+    using JniType = jobject;
+
+    using Boxed = NativePackedPrimitives;
+
+    ~NativePackedPrimitives();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+
+    // Lists of this record cross JNI as a long[] with one slot per field (see ::djinni::List)
+    static constexpr size_t kPackedFields = 6;
+    static void pack(const CppType& c, jlong* out);
+    static CppType unpack(const jlong* in);
+    static ::djinni::LocalRef<jlongArray> packList(JNIEnv* jniEnv, jobject list);
+    static ::djinni::LocalRef<jobject> unpackList(JNIEnv* jniEnv, jlongArray packed);
+
+private:
+    NativePackedPrimitives();
+    friend ::djinni::JniClass<NativePackedPrimitives>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/PackedPrimitives") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(ZBSFDLcom/dropbox/djinni/test/Color;)V") };
+    const jmethodID jpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "packList", "(Ljava/util/ArrayList;)[J") };
+    const jmethodID junpackList { ::djinni::jniGetStaticMethodID(clazz.get(), "unpackList", "([J)Ljava/util/ArrayList;") };
+    const jfieldID field_mB { ::djinni::jniGetFieldID(clazz.get(), "mB", "Z") };
+    const jfieldID field_mEight { ::djinni::jniGetFieldID(clazz.get(), "mEight", "B") };
+    const jfieldID field_mSixteen { ::djinni::jniGetFieldID(clazz.get(), "mSixteen", "S") };
+    const jfieldID field_mFthirtytwo { ::djinni::jniGetFieldID(clazz.get(), "mFthirtytwo", "F") };
+    const jfieldID field_mFsixtyfour { ::djinni::jniGetFieldID(clazz.get(), "mFsixtyfour", "D") };
+    const jfieldID field_mHue { ::djinni::jniGetFieldID(clazz.get(), "mHue", "Lcom/dropbox/djinni/test/Color;") };
+};
+
+} // namespace djinni_generated
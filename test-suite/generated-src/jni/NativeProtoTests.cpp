@@ -6,6 +6,7 @@
 #include "NativeRecordWithEmbeddedCppProto.hpp"
 #include "NativeRecordWithEmbeddedProto.hpp"
 #include "Outcome_jni.hpp"
+#include "ProtobufArena_jni.hpp"
 
 namespace djinni_generated {
 
@@ -24,7 +25,7 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ProtoTests_00024CppProxy_na
 CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_protoToStrings(JNIEnv* jniEnv, jobject /*this*/, jobject j_x)
 {
     try {
-        auto r = ::testsuite::ProtoTests::protoToStrings(::djinni::Protobuf<::djinni::test::AddressBook, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','A','d','d','r','e','s','s','B','o','o','k'>>::toCpp(jniEnv, j_x));
+        auto r = ::testsuite::ProtoTests::protoToStrings(::djinni::ArenaProtobuf<::djinni::test::AddressBook, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','A','d','d','r','e','s','s','B','o','o','k'>, ::djinni::GpbMessageLiteDirectSerializer>::toCpp(jniEnv, j_x));
         return ::djinni::release(::djinni::List<::djinni::String>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -33,7 +34,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringsToProt
 {
     try {
         auto r = ::testsuite::ProtoTests::stringsToProto(::djinni::List<::djinni::String>::toCpp(jniEnv, j_x));
-        return ::djinni::release(::djinni::Protobuf<::djinni::test::AddressBook, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','A','d','d','r','e','s','s','B','o','o','k'>>::fromCpp(jniEnv, r));
+        return ::djinni::release(::djinni::Protobuf<::djinni::test::AddressBook, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','A','d','d','r','e','s','s','B','o','o','k'>, ::djinni::GpbMessageLiteDirectSerializer>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
@@ -56,7 +57,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringToEmbed
 CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_ProtoTests_cppProtoToString(JNIEnv* jniEnv, jobject /*this*/, jobject j_x)
 {
     try {
-        auto r = ::testsuite::ProtoTests::cppProtoToString(::djinni::Protobuf<::djinni::test2::PersistingState, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','2','/','T','e','s','t','2','$','P','e','r','s','i','s','t','i','n','g','S','t','a','t','e'>>::toCpp(jniEnv, j_x));
+        auto r = ::testsuite::ProtoTests::cppProtoToString(::djinni::ArenaProtobuf<::djinni::test2::PersistingState, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','2','/','T','e','s','t','2','$','P','e','r','s','i','s','t','i','n','g','S','t','a','t','e'>>::toCpp(jniEnv, j_x));
         return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -88,7 +89,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringToEmbed
 CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_protoListToStrings(JNIEnv* jniEnv, jobject /*this*/, jobject j_x)
 {
     try {
-        auto r = ::testsuite::ProtoTests::protoListToStrings(::djinni::List<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>>>::toCpp(jniEnv, j_x));
+        auto r = ::testsuite::ProtoTests::protoListToStrings(::djinni::List<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>>::toCpp(jniEnv, j_x));
         return ::djinni::release(::djinni::List<::djinni::String>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -97,14 +98,14 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringsToProt
 {
     try {
         auto r = ::testsuite::ProtoTests::stringsToProtoList(::djinni::List<::djinni::String>::toCpp(jniEnv, j_x));
-        return ::djinni::release(::djinni::List<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>>>::fromCpp(jniEnv, r));
+        return ::djinni::release(::djinni::List<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
 CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_ProtoTests_optionalProtoToString(JNIEnv* jniEnv, jobject /*this*/, jobject j_x)
 {
     try {
-        auto r = ::testsuite::ProtoTests::optionalProtoToString(::djinni::Optional<std::experimental::optional, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>>>::toCpp(jniEnv, j_x));
+        auto r = ::testsuite::ProtoTests::optionalProtoToString(::djinni::Optional<std::experimental::optional, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>>::toCpp(jniEnv, j_x));
         return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
@@ -113,15 +114,31 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringToOptio
 {
     try {
         auto r = ::testsuite::ProtoTests::stringToOptionalProto(::djinni::String::toCpp(jniEnv, j_x));
-        return ::djinni::release(::djinni::Optional<std::experimental::optional, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>>>::fromCpp(jniEnv, r));
+        return ::djinni::release(::djinni::Optional<std::experimental::optional, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT ::djinni::Outcome<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>>, ::djinni::I32>::JniType JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringToProtoOutcome(JNIEnv* jniEnv, jobject /*this*/, jstring j_x)
+CJNIEXPORT ::djinni::Outcome<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>, ::djinni::I32>::JniType JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringToProtoOutcome(JNIEnv* jniEnv, jobject /*this*/, jstring j_x)
 {
     try {
         auto r = ::testsuite::ProtoTests::stringToProtoOutcome(::djinni::String::toCpp(jniEnv, j_x));
-        return ::djinni::release(::djinni::Outcome<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>>, ::djinni::I32>::fromCpp(jniEnv, r));
+        return ::djinni::release(::djinni::Outcome<::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>, ::djinni::I32>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_protoMapToStrings(JNIEnv* jniEnv, jobject /*this*/, jobject j_x)
+{
+    try {
+        auto r = ::testsuite::ProtoTests::protoMapToStrings(::djinni::Map<::djinni::String, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>>::toCpp(jniEnv, j_x));
+        return ::djinni::release(::djinni::Map<::djinni::String, ::djinni::String>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProtoTests_stringsToProtoMap(JNIEnv* jniEnv, jobject /*this*/, jobject j_x)
+{
+    try {
+        auto r = ::testsuite::ProtoTests::stringsToProtoMap(::djinni::Map<::djinni::String, ::djinni::String>::toCpp(jniEnv, j_x));
+        return ::djinni::release(::djinni::Map<::djinni::String, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JavaClassName<'d','j','i','n','n','i','/','t','e','s','t','/','T','e','s','t','$','P','e','r','s','o','n'>, ::djinni::GpbMessageLiteDirectSerializer>>::fromCpp(jniEnv, r));
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
@@ -2,7 +2,7 @@
 // This file was generated by Djinni from proto.djinni
 
 #include "NativeRecordWithEmbeddedCppProto.hpp"  // my header
-#include "Marshal.hpp"
+#include "ProtobufArena_jni.hpp"
 
 namespace djinni_generated {
 
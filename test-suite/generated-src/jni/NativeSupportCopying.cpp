@@ -25,4 +25,26 @@ auto NativeSupportCopying::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
     return {::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mX))};
 }
 
+void NativeSupportCopying::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::I32::pack(c.x);
+}
+
+auto NativeSupportCopying::unpack(const jlong* in) -> CppType {
+    return {::djinni::I32::unpack(in[0])};
+}
+
+auto NativeSupportCopying::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativeSupportCopying>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeSupportCopying::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeSupportCopying>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
 } // namespace djinni_generated
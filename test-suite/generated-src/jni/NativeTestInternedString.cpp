@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#include "NativeTestInternedString.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeTestInternedString::NativeTestInternedString() : ::djinni::JniInterface<::testsuite::TestInternedString, NativeTestInternedString>("com/dropbox/djinni/test/TestInternedString$CppProxy") {}
+
+NativeTestInternedString::~NativeTestInternedString() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestInternedString_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        delete reinterpret_cast<::djinni::CppProxyHandle<::testsuite::TestInternedString>*>(nativeRef);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_TestInternedString_statusName(JNIEnv* jniEnv, jobject /*this*/, jint j_code)
+{
+    try {
+        auto r = ::testsuite::TestInternedString::status_name(::djinni::I32::toCpp(jniEnv, j_code));
+        return ::djinni::release(::djinni::InternedString::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "test_interned_string.hpp"
+
+namespace djinni_generated {
+
+class NativeTestInternedString final : ::djinni::JniInterface<::testsuite::TestInternedString, NativeTestInternedString> {
+public:
+    using CppType = std::shared_ptr<::testsuite::TestInternedString>;
+    using CppOptType = std::shared_ptr<::testsuite::TestInternedString>;
+    using JniType = jobject;
+
+    using Boxed = NativeTestInternedString;
+
+    ~NativeTestInternedString();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeTestInternedString>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeTestInternedString>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeTestInternedString();
+    friend ::djinni::JniClass<NativeTestInternedString>;
+    friend ::djinni::JniInterface<::testsuite::TestInternedString, NativeTestInternedString>;
+
+};
+
+} // namespace djinni_generated
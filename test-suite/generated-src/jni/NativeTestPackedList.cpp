@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#include "NativeTestPackedList.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativePackedPrimitives.hpp"
+
+namespace djinni_generated {
+
+NativeTestPackedList::NativeTestPackedList() : ::djinni::JniInterface<::testsuite::TestPackedList, NativeTestPackedList>("com/dropbox/djinni/test/TestPackedList$CppProxy") {}
+
+NativeTestPackedList::~NativeTestPackedList() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestPackedList_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        delete reinterpret_cast<::djinni::CppProxyHandle<::testsuite::TestPackedList>*>(nativeRef);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestPackedList_reverseList(JNIEnv* jniEnv, jobject /*this*/, jobject j_l)
+{
+    try {
+        auto r = ::testsuite::TestPackedList::reverse_list(::djinni::List<::djinni_generated::NativePackedPrimitives>::toCpp(jniEnv, j_l));
+        return ::djinni::release(::djinni::List<::djinni_generated::NativePackedPrimitives>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "test_packed_list.hpp"
+
+namespace djinni_generated {
+
+class NativeTestPackedList final : ::djinni::JniInterface<::testsuite::TestPackedList, NativeTestPackedList> {
+public:
+    using CppType = std::shared_ptr<::testsuite::TestPackedList>;
+    using CppOptType = std::shared_ptr<::testsuite::TestPackedList>;
+    using JniType = jobject;
+
+    using Boxed = NativeTestPackedList;
+
+    ~NativeTestPackedList();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeTestPackedList>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeTestPackedList>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeTestPackedList();
+    friend ::djinni::JniClass<NativeTestPackedList>;
+    friend ::djinni::JniInterface<::testsuite::TestPackedList, NativeTestPackedList>;
+
+};
+
+} // namespace djinni_generated
@@ -0,0 +1,55 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#include "NativeTestUncached.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeUncachedToken.hpp"
+
+namespace djinni_generated {
+
+NativeTestUncached::NativeTestUncached() : ::djinni::JniInterface<::testsuite::TestUncached, NativeTestUncached>("com/dropbox/djinni/test/TestUncached$CppProxy") {}
+
+NativeTestUncached::~NativeTestUncached() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestUncached_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        delete reinterpret_cast<::djinni::CppProxyHandle<::testsuite::TestUncached>*>(nativeRef);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestUncached_createCppToken(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        auto r = ::testsuite::TestUncached::create_cpp_token();
+        return ::djinni::release(::djinni_generated::NativeUncachedToken::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestUncached_tokenId(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
+{
+    try {
+        auto r = ::testsuite::TestUncached::token_id(::djinni_generated::NativeUncachedToken::toCpp(jniEnv, j_t));
+        return ::djinni::release(::djinni_generated::NativeUncachedToken::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestUncached_sameToken(JNIEnv* jniEnv, jobject /*this*/, jobject j_a, jobject j_b)
+{
+    try {
+        auto r = ::testsuite::TestUncached::same_token(::djinni_generated::NativeUncachedToken::toCpp(jniEnv, j_a),
+                                                       ::djinni_generated::NativeUncachedToken::toCpp(jniEnv, j_b));
+        return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestUncached_tokenTwice(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
+{
+    try {
+        auto r = ::testsuite::TestUncached::token_twice(::djinni_generated::NativeUncachedToken::toCpp(jniEnv, j_t));
+        return ::djinni::release(::djinni::List<::djinni_generated::NativeUncachedToken>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "test_uncached.hpp"
+
+namespace djinni_generated {
+
+class NativeTestUncached final : ::djinni::JniInterface<::testsuite::TestUncached, NativeTestUncached> {
+public:
+    using CppType = std::shared_ptr<::testsuite::TestUncached>;
+    using CppOptType = std::shared_ptr<::testsuite::TestUncached>;
+    using JniType = jobject;
+
+    using Boxed = NativeTestUncached;
+
+    ~NativeTestUncached();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeTestUncached>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeTestUncached>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeTestUncached();
+    friend ::djinni::JniClass<NativeTestUncached>;
+    friend ::djinni::JniInterface<::testsuite::TestUncached, NativeTestUncached>;
+
+};
+
+} // namespace djinni_generated
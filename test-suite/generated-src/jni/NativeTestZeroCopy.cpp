@@ -0,0 +1,40 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#include "NativeTestZeroCopy.hpp"  // my header
+#include "DataRef_jni.hpp"
+#include "Marshal.hpp"
+#include "NativeZeroCopySource.hpp"
+
+namespace djinni_generated {
+
+NativeTestZeroCopy::NativeTestZeroCopy() : ::djinni::JniInterface<::testsuite::TestZeroCopy, NativeTestZeroCopy>("com/dropbox/djinni/test/TestZeroCopy$CppProxy") {}
+
+NativeTestZeroCopy::~NativeTestZeroCopy() = default;
+
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestZeroCopy_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        delete reinterpret_cast<::djinni::CppProxyHandle<::testsuite::TestZeroCopy>*>(nativeRef);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestZeroCopy_makeBytes(JNIEnv* jniEnv, jobject /*this*/, jint j_size)
+{
+    try {
+        auto r = ::testsuite::TestZeroCopy::make_bytes(::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::BinaryBuffer::fromCpp(jniEnv, std::move(r)));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+CJNIEXPORT jbyteArray JNICALL Java_com_dropbox_djinni_test_TestZeroCopy_readSource(JNIEnv* jniEnv, jobject /*this*/, jobject j_source, jint j_size)
+{
+    try {
+        auto r = ::testsuite::TestZeroCopy::read_source(::djinni_generated::NativeZeroCopySource::toCpp(jniEnv, j_source),
+                                                        ::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::Binary::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "test_zero_copy.hpp"
+
+namespace djinni_generated {
+
+class NativeTestZeroCopy final : ::djinni::JniInterface<::testsuite::TestZeroCopy, NativeTestZeroCopy> {
+public:
+    using CppType = std::shared_ptr<::testsuite::TestZeroCopy>;
+    using CppOptType = std::shared_ptr<::testsuite::TestZeroCopy>;
+    using JniType = jobject;
+
+    using Boxed = NativeTestZeroCopy;
+
+    ~NativeTestZeroCopy();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeTestZeroCopy>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeTestZeroCopy>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeTestZeroCopy();
+    friend ::djinni::JniClass<NativeTestZeroCopy>;
+    friend ::djinni::JniInterface<::testsuite::TestZeroCopy, NativeTestZeroCopy>;
+
+};
+
+} // namespace djinni_generated
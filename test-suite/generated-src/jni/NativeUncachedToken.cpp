@@ -0,0 +1,42 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#include "NativeUncachedToken.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeUncachedToken::NativeUncachedToken() : ::djinni::JniInterface<::testsuite::UncachedToken, NativeUncachedToken>("com/dropbox/djinni/test/UncachedToken$CppProxy") {}
+
+NativeUncachedToken::~NativeUncachedToken() = default;
+
+NativeUncachedToken::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::ProxyCacheBypass{}, ::djinni::jniGetThreadEnv(), j) { }
+
+NativeUncachedToken::JavaProxy::~JavaProxy() = default;
+
+std::string NativeUncachedToken::JavaProxy::whoami() {
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeUncachedToken>::get();
+    auto jret = (jstring)jniEnv->CallObjectMethod(Handle::get().get(), data.method_whoami);
+    ::djinni::jniExceptionCheck(jniEnv);
+    return ::djinni::String::toCpp(jniEnv, jret);
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_UncachedToken_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        delete reinterpret_cast<::djinni::CppProxyHandle<::testsuite::UncachedToken>*>(nativeRef);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_UncachedToken_00024CppProxy_native_1whoami(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        const auto& ref = ::djinni::objectFromHandleAddress<::testsuite::UncachedToken>(nativeRef);
+        auto r = ref->whoami();
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+} // namespace djinni_generated
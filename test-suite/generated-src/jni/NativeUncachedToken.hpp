@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "uncached_token.hpp"
+
+namespace djinni_generated {
+
+class NativeUncachedToken final : ::djinni::JniInterface<::testsuite::UncachedToken, NativeUncachedToken> {
+public:
+    using CppType = std::shared_ptr<::testsuite::UncachedToken>;
+    using CppOptType = std::shared_ptr<::testsuite::UncachedToken>;
+    using JniType = jobject;
+
+    using Boxed = NativeUncachedToken;
+
+    static constexpr bool kUsesProxyCache = false;
+
+    ~NativeUncachedToken();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeUncachedToken>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeUncachedToken>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeUncachedToken();
+    friend ::djinni::JniClass<NativeUncachedToken>;
+    friend ::djinni::JniInterface<::testsuite::UncachedToken, NativeUncachedToken>;
+
+    class JavaProxy final : ::djinni::JavaProxyHandle<JavaProxy>, public ::testsuite::UncachedToken
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        std::string whoami() override;
+
+    private:
+        friend ::djinni::JniInterface<::testsuite::UncachedToken, ::djinni_generated::NativeUncachedToken>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/UncachedToken") };
+    const jmethodID method_whoami { ::djinni::jniGetMethodID(clazz.get(), "whoami", "()Ljava/lang/String;") };
+};
+
+} // namespace djinni_generated
@@ -25,4 +25,26 @@ auto NativeVarnameRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
     return {::djinni::I8::toCpp(jniEnv, jniEnv->GetByteField(j, data.field_mField))};
 }
 
+void NativeVarnameRecord::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::I8::pack(c._field_);
+}
+
+auto NativeVarnameRecord::unpack(const jlong* in) -> CppType {
+    return {::djinni::I8::unpack(in[0])};
+}
+
+auto NativeVarnameRecord::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativeVarnameRecord>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeVarnameRecord::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeVarnameRecord>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
 } // namespace djinni_generated
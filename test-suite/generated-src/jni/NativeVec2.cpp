@@ -27,4 +27,28 @@ auto NativeVec2::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
             ::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mY))};
 }
 
+void NativeVec2::pack(const CppType& c, jlong* out) {
+    out[0] = ::djinni::I32::pack(c.x);
+    out[1] = ::djinni::I32::pack(c.y);
+}
+
+auto NativeVec2::unpack(const jlong* in) -> CppType {
+    return {::djinni::I32::unpack(in[0]),
+            ::djinni::I32::unpack(in[1])};
+}
+
+auto NativeVec2::packList(JNIEnv* jniEnv, jobject list) -> ::djinni::LocalRef<jlongArray> {
+    const auto& data = ::djinni::JniClass<NativeVec2>::get();
+    auto r = ::djinni::LocalRef<jlongArray>{jniEnv, static_cast<jlongArray>(jniEnv->CallStaticObjectMethod(data.clazz.get(), data.jpackList, list))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeVec2::unpackList(JNIEnv* jniEnv, jlongArray packed) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeVec2>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv, jniEnv->CallStaticObjectMethod(data.clazz.get(), data.junpackList, packed)};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
 } // namespace djinni_generated
@@ -0,0 +1,28 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#include "NativeZeroCopySource.hpp"  // my header
+#include "DataRef_jni.hpp"
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeZeroCopySource::NativeZeroCopySource() : ::djinni::JniInterface<::testsuite::ZeroCopySource, NativeZeroCopySource>() {}
+
+NativeZeroCopySource::~NativeZeroCopySource() = default;
+
+NativeZeroCopySource::JavaProxy::JavaProxy(JniType j) : Handle(::djinni::jniGetThreadEnv(), j) { }
+
+NativeZeroCopySource::JavaProxy::~JavaProxy() = default;
+
+std::vector<uint8_t> NativeZeroCopySource::JavaProxy::get_bytes(int32_t c_size) {
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeZeroCopySource>::get();
+    auto jret = jniEnv->CallObjectMethod(Handle::get().get(), data.method_getBytes,
+                                         ::djinni::get(::djinni::I32::fromCpp(jniEnv, c_size)));
+    ::djinni::jniExceptionCheck(jniEnv);
+    return ::djinni::BinaryBuffer::toCpp(jniEnv, jret);
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,46 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "zero_copy_source.hpp"
+
+namespace djinni_generated {
+
+class NativeZeroCopySource final : ::djinni::JniInterface<::testsuite::ZeroCopySource, NativeZeroCopySource> {
+public:
+    using CppType = std::shared_ptr<::testsuite::ZeroCopySource>;
+    using CppOptType = std::shared_ptr<::testsuite::ZeroCopySource>;
+    using JniType = jobject;
+
+    using Boxed = NativeZeroCopySource;
+
+    ~NativeZeroCopySource();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeZeroCopySource>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCppOpt(JNIEnv* jniEnv, const CppOptType& c) { return {jniEnv, ::djinni::JniClass<NativeZeroCopySource>::get()._toJava(jniEnv, c)}; }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return fromCppOpt(jniEnv, c); }
+
+private:
+    NativeZeroCopySource();
+    friend ::djinni::JniClass<NativeZeroCopySource>;
+    friend ::djinni::JniInterface<::testsuite::ZeroCopySource, NativeZeroCopySource>;
+
+    class JavaProxy final : ::djinni::JavaProxyHandle<JavaProxy>, public ::testsuite::ZeroCopySource
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        std::vector<uint8_t> get_bytes(int32_t size) override;
+
+    private:
+        friend ::djinni::JniInterface<::testsuite::ZeroCopySource, ::djinni_generated::NativeZeroCopySource>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/ZeroCopySource") };
+    const jmethodID method_getBytes { ::djinni::jniGetMethodID(clazz.get(), "getBytes", "(I)Ljava/nio/ByteBuffer;") };
+};
+
+} // namespace djinni_generated
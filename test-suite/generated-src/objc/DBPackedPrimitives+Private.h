@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#import "DBPackedPrimitives.h"
+#include "packed_primitives.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBPackedPrimitives;
+
+namespace djinni_generated {
+
+struct PackedPrimitives
+{
+    using CppType = ::testsuite::PackedPrimitives;
+    using ObjcType = DBPackedPrimitives*;
+
+    using Boxed = PackedPrimitives;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+} // namespace djinni_generated
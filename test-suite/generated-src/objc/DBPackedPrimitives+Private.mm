@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#import "DBPackedPrimitives+Private.h"
+#import "DBColor+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto PackedPrimitives::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::Bool::toCpp(obj.b),
+            ::djinni::I8::toCpp(obj.eight),
+            ::djinni::I16::toCpp(obj.sixteen),
+            ::djinni::F32::toCpp(obj.fthirtytwo),
+            ::djinni::F64::toCpp(obj.fsixtyfour),
+            ::djinni::Enum<::testsuite::color, DBColor>::toCpp(obj.hue)};
+}
+
+auto PackedPrimitives::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBPackedPrimitives alloc] initWithB:(::djinni::Bool::fromCpp(cpp.b))
+                                           eight:(::djinni::I8::fromCpp(cpp.eight))
+                                         sixteen:(::djinni::I16::fromCpp(cpp.sixteen))
+                                      fthirtytwo:(::djinni::F32::fromCpp(cpp.fthirtytwo))
+                                      fsixtyfour:(::djinni::F64::fromCpp(cpp.fsixtyfour))
+                                             hue:(::djinni::Enum<::testsuite::color, DBColor>::fromCpp(cpp.hue))];
+}
+
+} // namespace djinni_generated
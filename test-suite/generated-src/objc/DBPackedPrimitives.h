@@ -0,0 +1,36 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#import "DBColor.h"
+#import <Foundation/Foundation.h>
+
+/** Only primitives and an enum, so JNI passes lists of it packed into a long[] */
+@interface DBPackedPrimitives : NSObject
+- (nonnull instancetype)init NS_UNAVAILABLE;
++ (nonnull instancetype)new NS_UNAVAILABLE;
+- (nonnull instancetype)initWithB:(BOOL)b
+                            eight:(int8_t)eight
+                          sixteen:(int16_t)sixteen
+                       fthirtytwo:(float)fthirtytwo
+                       fsixtyfour:(double)fsixtyfour
+                              hue:(DBColor)hue NS_DESIGNATED_INITIALIZER;
++ (nonnull instancetype)packedPrimitivesWithB:(BOOL)b
+                                        eight:(int8_t)eight
+                                      sixteen:(int16_t)sixteen
+                                   fthirtytwo:(float)fthirtytwo
+                                   fsixtyfour:(double)fsixtyfour
+                                          hue:(DBColor)hue;
+
+@property (nonatomic, readonly) BOOL b;
+
+@property (nonatomic, readonly) int8_t eight;
+
+@property (nonatomic, readonly) int16_t sixteen;
+
+@property (nonatomic, readonly) float fthirtytwo;
+
+@property (nonatomic, readonly) double fsixtyfour;
+
+@property (nonatomic, readonly) DBColor hue;
+
+@end
@@ -0,0 +1,74 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#import "DBPackedPrimitives.h"
+
+
+@implementation DBPackedPrimitives
+
+- (nonnull instancetype)initWithB:(BOOL)b
+                            eight:(int8_t)eight
+                          sixteen:(int16_t)sixteen
+                       fthirtytwo:(float)fthirtytwo
+                       fsixtyfour:(double)fsixtyfour
+                              hue:(DBColor)hue
+{
+    if (self = [super init]) {
+        _b = b;
+        _eight = eight;
+        _sixteen = sixteen;
+        _fthirtytwo = fthirtytwo;
+        _fsixtyfour = fsixtyfour;
+        _hue = hue;
+    }
+    return self;
+}
+
++ (nonnull instancetype)packedPrimitivesWithB:(BOOL)b
+                                        eight:(int8_t)eight
+                                      sixteen:(int16_t)sixteen
+                                   fthirtytwo:(float)fthirtytwo
+                                   fsixtyfour:(double)fsixtyfour
+                                          hue:(DBColor)hue
+{
+    return [[self alloc] initWithB:b
+                             eight:eight
+                           sixteen:sixteen
+                        fthirtytwo:fthirtytwo
+                        fsixtyfour:fsixtyfour
+                               hue:hue];
+}
+
+- (BOOL)isEqual:(id)other
+{
+    if (![other isKindOfClass:[DBPackedPrimitives class]]) {
+        return NO;
+    }
+    DBPackedPrimitives *typedOther = (DBPackedPrimitives *)other;
+    return self.b == typedOther.b &&
+            self.eight == typedOther.eight &&
+            self.sixteen == typedOther.sixteen &&
+            self.fthirtytwo == typedOther.fthirtytwo &&
+            self.fsixtyfour == typedOther.fsixtyfour &&
+            self.hue == typedOther.hue;
+}
+
+- (NSUInteger)hash
+{
+    return NSStringFromClass([self class]).hash ^
+            (NSUInteger)self.b ^
+            (NSUInteger)self.eight ^
+            (NSUInteger)self.sixteen ^
+            (NSUInteger)self.fthirtytwo ^
+            (NSUInteger)self.fsixtyfour ^
+            (NSUInteger)self.hue;
+}
+
+#ifndef DJINNI_DISABLE_DESCRIPTION_METHODS
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@ %p b:%@ eight:%@ sixteen:%@ fthirtytwo:%@ fsixtyfour:%@ hue:%@>", self.class, (void *)self, @(self.b), @(self.eight), @(self.sixteen), @(self.fthirtytwo), @(self.fsixtyfour), @(self.hue)];
+}
+
+#endif
+@end
@@ -125,6 +125,20 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
++ (nonnull NSDictionary<NSString *, NSString *> *)protoMapToStrings:(nonnull NSDictionary<NSString *, DJTestPerson *> *)x {
+    try {
+        auto objcpp_result_ = ::testsuite::ProtoTests::protoMapToStrings(::djinni::Map<::djinni::String, ::djinni::Protobuf<::djinni::test::Person, DJTestPerson>>::toCpp(x));
+        return ::djinni::Map<::djinni::String, ::djinni::String>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSDictionary<NSString *, DJTestPerson *> *)stringsToProtoMap:(nonnull NSDictionary<NSString *, NSString *> *)x {
+    try {
+        auto objcpp_result_ = ::testsuite::ProtoTests::stringsToProtoMap(::djinni::Map<::djinni::String, ::djinni::String>::toCpp(x));
+        return ::djinni::Map<::djinni::String, ::djinni::Protobuf<::djinni::test::Person, DJTestPerson>>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 namespace djinni_generated {
 
 auto ProtoTests::toCpp(ObjcType objc) -> CppType
@@ -37,4 +37,8 @@
 
 + (nonnull DJOutcome<DJTestPerson *, NSNumber *> *)stringToProtoOutcome:(nonnull NSString *)x;
 
++ (nonnull NSDictionary<NSString *, NSString *> *)protoMapToStrings:(nonnull NSDictionary<NSString *, DJTestPerson *> *)x;
+
++ (nonnull NSDictionary<NSString *, DJTestPerson *> *)stringsToProtoMap:(nonnull NSDictionary<NSString *, NSString *> *)x;
+
 @end
@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#include "test_interned_string.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBTestInternedString;
+
+namespace djinni_generated {
+
+class TestInternedString
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::TestInternedString>;
+    using CppOptType = std::shared_ptr<::testsuite::TestInternedString>;
+    using ObjcType = DBTestInternedString*;
+
+    using Boxed = TestInternedString;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCppOpt(const CppOptType& cpp);
+    static ObjcType fromCpp(const CppType& cpp) { return fromCppOpt(cpp); }
+
+private:
+    class ObjcProxy;
+};
+
+} // namespace djinni_generated
+
@@ -0,0 +1,60 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#import "DBTestInternedString+Private.h"
+#import "DBTestInternedString.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBTestInternedString ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestInternedString>&)cppRef;
+
+@end
+
+@implementation DBTestInternedString {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::TestInternedString>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestInternedString>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (nonnull NSString *)statusName:(int32_t)code {
+    try {
+        auto objcpp_result_ = ::testsuite::TestInternedString::status_name(::djinni::I32::toCpp(code));
+        return ::djinni::String::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto TestInternedString::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto TestInternedString::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBTestInternedString>(cpp);
+}
+
+} // namespace djinni_generated
+
+@end
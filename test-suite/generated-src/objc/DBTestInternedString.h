@@ -0,0 +1,15 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#import <Foundation/Foundation.h>
+
+
+@interface DBTestInternedString : NSObject
+
+/**
+ * "ok", "not_found" or "café" for codes 0 to 2, and otherwise a description too long
+ * for the JNI string cache
+ */
++ (nonnull NSString *)statusName:(int32_t)code;
+
+@end
@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#include "test_packed_list.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBTestPackedList;
+
+namespace djinni_generated {
+
+class TestPackedList
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::TestPackedList>;
+    using CppOptType = std::shared_ptr<::testsuite::TestPackedList>;
+    using ObjcType = DBTestPackedList*;
+
+    using Boxed = TestPackedList;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCppOpt(const CppOptType& cpp);
+    static ObjcType fromCpp(const CppType& cpp) { return fromCppOpt(cpp); }
+
+private:
+    class ObjcProxy;
+};
+
+} // namespace djinni_generated
+
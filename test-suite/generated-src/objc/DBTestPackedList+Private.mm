@@ -0,0 +1,61 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#import "DBTestPackedList+Private.h"
+#import "DBPackedPrimitives+Private.h"
+#import "DBTestPackedList.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBTestPackedList ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestPackedList>&)cppRef;
+
+@end
+
+@implementation DBTestPackedList {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::TestPackedList>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestPackedList>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (nonnull NSArray<DBPackedPrimitives *> *)reverseList:(nonnull NSArray<DBPackedPrimitives *> *)l {
+    try {
+        auto objcpp_result_ = ::testsuite::TestPackedList::reverse_list(::djinni::List<::djinni_generated::PackedPrimitives>::toCpp(l));
+        return ::djinni::List<::djinni_generated::PackedPrimitives>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto TestPackedList::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto TestPackedList::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBTestPackedList>(cpp);
+}
+
+} // namespace djinni_generated
+
+@end
@@ -0,0 +1,12 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#import "DBPackedPrimitives.h"
+#import <Foundation/Foundation.h>
+
+
+@interface DBTestPackedList : NSObject
+
++ (nonnull NSArray<DBPackedPrimitives *> *)reverseList:(nonnull NSArray<DBPackedPrimitives *> *)l;
+
+@end
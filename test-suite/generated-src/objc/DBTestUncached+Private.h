@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#include "test_uncached.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBTestUncached;
+
+namespace djinni_generated {
+
+class TestUncached
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::TestUncached>;
+    using CppOptType = std::shared_ptr<::testsuite::TestUncached>;
+    using ObjcType = DBTestUncached*;
+
+    using Boxed = TestUncached;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCppOpt(const CppOptType& cpp);
+    static ObjcType fromCpp(const CppType& cpp) { return fromCppOpt(cpp); }
+
+private:
+    class ObjcProxy;
+};
+
+} // namespace djinni_generated
+
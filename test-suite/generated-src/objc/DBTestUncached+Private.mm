@@ -0,0 +1,84 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#import "DBTestUncached+Private.h"
+#import "DBTestUncached.h"
+#import "DBUncachedToken+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBTestUncached ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestUncached>&)cppRef;
+
+@end
+
+@implementation DBTestUncached {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::TestUncached>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestUncached>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (nullable id<DBUncachedToken>)createCppToken {
+    try {
+        auto objcpp_result_ = ::testsuite::TestUncached::create_cpp_token();
+        return ::djinni_generated::UncachedToken::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nullable id<DBUncachedToken>)tokenId:(nullable id<DBUncachedToken>)t {
+    try {
+        auto objcpp_result_ = ::testsuite::TestUncached::token_id(::djinni_generated::UncachedToken::toCpp(t));
+        return ::djinni_generated::UncachedToken::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (BOOL)sameToken:(nullable id<DBUncachedToken>)a
+                b:(nullable id<DBUncachedToken>)b {
+    try {
+        auto objcpp_result_ = ::testsuite::TestUncached::same_token(::djinni_generated::UncachedToken::toCpp(a),
+                                                                    ::djinni_generated::UncachedToken::toCpp(b));
+        return ::djinni::Bool::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSArray<id<DBUncachedToken>> *)tokenTwice:(nullable id<DBUncachedToken>)t {
+    try {
+        auto objcpp_result_ = ::testsuite::TestUncached::token_twice(::djinni_generated::UncachedToken::toCpp(t));
+        return ::djinni::List<::djinni_generated::UncachedToken>::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto TestUncached::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto TestUncached::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBTestUncached>(cpp);
+}
+
+} // namespace djinni_generated
+
+@end
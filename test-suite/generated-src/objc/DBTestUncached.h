@@ -0,0 +1,21 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#import <Foundation/Foundation.h>
+@protocol DBUncachedToken;
+
+
+@interface DBTestUncached : NSObject
+
++ (nullable id<DBUncachedToken>)createCppToken;
+
++ (nullable id<DBUncachedToken>)tokenId:(nullable id<DBUncachedToken>)t;
+
+/** Whether `a` and `b` reached C++ as the same object */
++ (BOOL)sameToken:(nullable id<DBUncachedToken>)a
+                b:(nullable id<DBUncachedToken>)b;
+
+/** `t` converted back to the caller's language twice */
++ (nonnull NSArray<id<DBUncachedToken>> *)tokenTwice:(nullable id<DBUncachedToken>)t;
+
+@end
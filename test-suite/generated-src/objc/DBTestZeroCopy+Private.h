@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#include "test_zero_copy.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBTestZeroCopy;
+
+namespace djinni_generated {
+
+class TestZeroCopy
+{
+public:
+    using CppType = std::shared_ptr<::testsuite::TestZeroCopy>;
+    using CppOptType = std::shared_ptr<::testsuite::TestZeroCopy>;
+    using ObjcType = DBTestZeroCopy*;
+
+    using Boxed = TestZeroCopy;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCppOpt(const CppOptType& cpp);
+    static ObjcType fromCpp(const CppType& cpp) { return fromCppOpt(cpp); }
+
+private:
+    class ObjcProxy;
+};
+
+} // namespace djinni_generated
+
@@ -0,0 +1,70 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#import "DBTestZeroCopy+Private.h"
+#import "DBTestZeroCopy.h"
+#import "DBZeroCopySource+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBTestZeroCopy ()
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestZeroCopy>&)cppRef;
+
+@end
+
+@implementation DBTestZeroCopy {
+    ::djinni::CppProxyCache::Handle<std::shared_ptr<::testsuite::TestZeroCopy>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::TestZeroCopy>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
++ (nonnull NSData *)makeBytes:(int32_t)size {
+    try {
+        auto objcpp_result_ = ::testsuite::TestZeroCopy::make_bytes(::djinni::I32::toCpp(size));
+        return ::djinni::Binary::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSData *)readSource:(nullable DBZeroCopySource *)source
+                          size:(int32_t)size {
+    try {
+        auto objcpp_result_ = ::testsuite::TestZeroCopy::read_source(::djinni_generated::ZeroCopySource::toCpp(source),
+                                                                     ::djinni::I32::toCpp(size));
+        return ::djinni::Binary::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+auto TestZeroCopy::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc->_cppRefHandle.get();
+}
+
+auto TestZeroCopy::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::get_cpp_proxy<DBTestZeroCopy>(cpp);
+}
+
+} // namespace djinni_generated
+
+@end
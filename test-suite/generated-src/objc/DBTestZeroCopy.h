@@ -0,0 +1,17 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#import <Foundation/Foundation.h>
+@class DBZeroCopySource;
+
+
+@interface DBTestZeroCopy : NSObject
+
+/** `size` bytes counting up from 0 and wrapping around at 256 */
++ (nonnull NSData *)makeBytes:(int32_t)size;
+
+/** What C++ receives from `source.get_bytes(size)` */
++ (nonnull NSData *)readSource:(nullable DBZeroCopySource *)source
+                          size:(int32_t)size;
+
+@end
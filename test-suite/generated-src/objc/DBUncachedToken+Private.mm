@@ -0,0 +1,87 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#import "DBUncachedToken+Private.h"
+#import "DBUncachedToken.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBUncachedTokenCppProxy : NSObject<DBUncachedToken>
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::UncachedToken>&)cppRef;
+
+@end
+
+@implementation DBUncachedTokenCppProxy {
+    ::djinni::UncachedCppRef<std::shared_ptr<::testsuite::UncachedToken>> _cppRefHandle;
+}
+
+- (id)initWithCpp:(const std::shared_ptr<::testsuite::UncachedToken>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRefHandle.assign(cppRef);
+    }
+    return self;
+}
+
+- (nonnull NSString *)whoami {
+    try {
+        auto objcpp_result_ = _cppRefHandle.get()->whoami();
+        return ::djinni::String::fromCpp(objcpp_result_);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+namespace djinni_generated {
+
+class UncachedToken::ObjcProxy final
+: public ::testsuite::UncachedToken
+, private ::djinni::ObjcProxyBase<ObjcType>
+{
+    friend class ::djinni_generated::UncachedToken;
+public:
+    using ObjcProxyBase::ObjcProxyBase;
+    std::string whoami() override
+    {
+        @autoreleasepool {
+            auto objcpp_result_ = [djinni_private_get_proxied_objc_object() whoami];
+            return ::djinni::String::toCpp(objcpp_result_);
+        }
+    }
+};
+
+} // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto UncachedToken::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    if ([(id)objc isKindOfClass:[DBUncachedTokenCppProxy class]]) {
+        return ((DBUncachedTokenCppProxy*)objc)->_cppRefHandle.get();
+    }
+    return ::djinni::new_objc_proxy<ObjcProxy>(objc);
+}
+
+auto UncachedToken::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    if (auto cppPtr = dynamic_cast<ObjcProxy*>(cpp.get())) {
+        return cppPtr->djinni_private_get_proxied_objc_object();
+    }
+    return ::djinni::new_cpp_proxy<DBUncachedTokenCppProxy>(cpp);
+}
+
+} // namespace djinni_generated
+
+@end
@@ -0,0 +1,11 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#import <Foundation/Foundation.h>
+
+
+@protocol DBUncachedToken <NSObject>
+
+- (nonnull NSString *)whoami;
+
+@end
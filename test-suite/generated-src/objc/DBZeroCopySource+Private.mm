@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#import "DBZeroCopySource+Private.h"
+#import "DBZeroCopySource.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <stdexcept>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+auto ZeroCopySource::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    DJINNI_UNIMPLEMENTED(@"Interface not implementable in any language.");
+}
+
+auto ZeroCopySource::fromCppOpt(const CppOptType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    DJINNI_UNIMPLEMENTED(@"Interface not implementable in any language.");
+}
+
+} // namespace djinni_generated
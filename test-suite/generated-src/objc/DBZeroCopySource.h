@@ -0,0 +1,11 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#import <Foundation/Foundation.h>
+
+
+@interface DBZeroCopySource : NSObject
+
+- (nonnull NSData *)getBytes:(int32_t)size;
+
+@end
@@ -29,6 +29,8 @@ export interface ProtoTests_statics {
     optionalProtoToString(x: Person | undefined): string;
     stringToOptionalProto(x: string): Person | undefined;
     stringToProtoOutcome(x: string): Outcome<Person, number>;
+    protoMapToStrings(x: Map<string, Person>): Map<string, string>;
+    stringsToProtoMap(x: Map<string, string>): Map<string, Person>;
 }
 
 export interface /*record*/ NestedOutcome {
@@ -151,6 +153,60 @@ export interface /*record*/ RecordWithFlags {
     access: AccessFlags;
 }
 
+export interface TestInternedString {
+}
+export interface TestInternedString_statics {
+    /**
+     * "ok", "not_found" or "café" for codes 0 to 2, and otherwise a description too long
+     * for the JNI string cache
+     */
+    statusName(code: number): string;
+}
+
+export interface UncachedToken {
+    whoami(): string;
+}
+
+export interface TestUncached {
+}
+export interface TestUncached_statics {
+    createCppToken(): UncachedToken;
+    tokenId(t: UncachedToken): UncachedToken;
+    /** Whether `a` and `b` reached C++ as the same object */
+    sameToken(a: UncachedToken, b: UncachedToken): boolean;
+    /** `t` converted back to the caller's language twice */
+    tokenTwice(t: UncachedToken): Array<UncachedToken>;
+}
+
+export interface ZeroCopySource {
+    getBytes(size: number): Uint8Array;
+}
+
+export interface TestZeroCopy {
+}
+export interface TestZeroCopy_statics {
+    /** `size` bytes counting up from 0 and wrapping around at 256 */
+    makeBytes(size: number): Uint8Array;
+    /** What C++ receives from `source.get_bytes(size)` */
+    readSource(source: ZeroCopySource, size: number): Uint8Array;
+}
+
+/** Only primitives and an enum, so JNI passes lists of it packed into a long[] */
+export interface /*record*/ PackedPrimitives {
+    b: boolean;
+    eight: number;
+    sixteen: number;
+    fthirtytwo: number;
+    fsixtyfour: number;
+    hue: Color;
+}
+
+export interface TestPackedList {
+}
+export interface TestPackedList_statics {
+    reverseList(l: Array<PackedPrimitives>): Array<PackedPrimitives>;
+}
+
 export interface TestStaticMethodLanguage {
 }
 
@@ -613,6 +669,10 @@ export interface ns_testsuite {
     TestDuration: TestDuration_statics;
     DataRefTest: DataRefTest_statics;
     FlagRoundtrip: FlagRoundtrip_statics;
+    TestInternedString: TestInternedString_statics;
+    TestUncached: TestUncached_statics;
+    TestZeroCopy: TestZeroCopy_statics;
+    TestPackedList: TestPackedList_statics;
     TestArray: TestArray_statics;
     ListenerCaller: ListenerCaller_statics;
     ReturnOne: ReturnOne_statics;
@@ -627,6 +687,10 @@ export interface Test_statics {
     testsuite_TestDuration: TestDuration_statics;
     testsuite_DataRefTest: DataRefTest_statics;
     testsuite_FlagRoundtrip: FlagRoundtrip_statics;
+    testsuite_TestInternedString: TestInternedString_statics;
+    testsuite_TestUncached: TestUncached_statics;
+    testsuite_TestZeroCopy: TestZeroCopy_statics;
+    testsuite_TestPackedList: TestPackedList_statics;
     testsuite_TestArray: TestArray_statics;
     testsuite_ListenerCaller: ListenerCaller_statics;
     testsuite_ReturnOne: ReturnOne_statics;
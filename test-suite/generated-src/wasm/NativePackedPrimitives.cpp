@@ -0,0 +1,28 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#include "NativePackedPrimitives.hpp"  // my header
+#include "NativeColor.hpp"
+
+namespace djinni_generated {
+
+auto NativePackedPrimitives::toCpp(const JsType& j) -> CppType {
+    return {::djinni::Bool::Boxed::toCpp(j["b"]),
+            ::djinni::I8::Boxed::toCpp(j["eight"]),
+            ::djinni::I16::Boxed::toCpp(j["sixteen"]),
+            ::djinni::F32::Boxed::toCpp(j["fthirtytwo"]),
+            ::djinni::F64::Boxed::toCpp(j["fsixtyfour"]),
+            ::djinni_generated::NativeColor::Boxed::toCpp(j["hue"])};
+}
+auto NativePackedPrimitives::fromCpp(const CppType& c) -> JsType {
+    em::val js = em::val::object();
+    js.set("b", ::djinni::Bool::Boxed::fromCpp(c.b));
+    js.set("eight", ::djinni::I8::Boxed::fromCpp(c.eight));
+    js.set("sixteen", ::djinni::I16::Boxed::fromCpp(c.sixteen));
+    js.set("fthirtytwo", ::djinni::F32::Boxed::fromCpp(c.fthirtytwo));
+    js.set("fsixtyfour", ::djinni::F64::Boxed::fromCpp(c.fsixtyfour));
+    js.set("hue", ::djinni_generated::NativeColor::Boxed::fromCpp(c.hue));
+    return js;
+}
+
+} // namespace djinni_generated
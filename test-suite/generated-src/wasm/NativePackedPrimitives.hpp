@@ -0,0 +1,21 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "packed_primitives.hpp"
+
+namespace djinni_generated {
+
+struct NativePackedPrimitives
+{
+    using CppType = ::testsuite::PackedPrimitives;
+    using JsType = em::val;
+    using Boxed = NativePackedPrimitives;
+
+    static CppType toCpp(const JsType& j);
+    static JsType fromCpp(const CppType& c);
+};
+
+} // namespace djinni_generated
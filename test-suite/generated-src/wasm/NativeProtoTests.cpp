@@ -5,6 +5,7 @@
 #include "NativeRecordWithEmbeddedCppProto.hpp"
 #include "NativeRecordWithEmbeddedProto.hpp"
 #include "Outcome_wasm.hpp"
+#include "ProtobufArena_wasm.hpp"
 
 namespace djinni_generated {
 
@@ -16,7 +17,7 @@ em::val NativeProtoTests::cppProxyMethods() {
 
 em::val NativeProtoTests::protoToStrings(const em::val& w_x) {
     try {
-        auto r = ::testsuite::ProtoTests::protoToStrings(::djinni::Protobuf<::djinni::test::AddressBook, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','.','A','d','d','r','e','s','s','B','o','o','k'>>::toCpp(w_x));
+        auto r = ::testsuite::ProtoTests::protoToStrings(::djinni::ArenaProtobuf<::djinni::test::AddressBook, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','.','A','d','d','r','e','s','s','B','o','o','k'>>::toCpp(w_x));
         return ::djinni::List<::djinni::String>::fromCpp(r);
     }
     catch(const std::exception& e) {
@@ -52,7 +53,7 @@ em::val NativeProtoTests::stringToEmbeddedProto(const std::string& w_x) {
 }
 std::string NativeProtoTests::cppProtoToString(const em::val& w_x) {
     try {
-        auto r = ::testsuite::ProtoTests::cppProtoToString(::djinni::Protobuf<::djinni::test2::PersistingState, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','2','.','P','e','r','s','i','s','t','i','n','g','S','t','a','t','e'>>::toCpp(w_x));
+        auto r = ::testsuite::ProtoTests::cppProtoToString(::djinni::ArenaProtobuf<::djinni::test2::PersistingState, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','2','.','P','e','r','s','i','s','t','i','n','g','S','t','a','t','e'>>::toCpp(w_x));
         return ::djinni::String::fromCpp(r);
     }
     catch(const std::exception& e) {
@@ -131,6 +132,24 @@ em::val NativeProtoTests::stringToProtoOutcome(const std::string& w_x) {
         return ::djinni::ExceptionHandlingTraits<::djinni::Outcome<::djinni::Protobuf<::djinni::test::Person, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','.','P','e','r','s','o','n'>>, ::djinni::I32>>::handleNativeException(e);
     }
 }
+em::val NativeProtoTests::protoMapToStrings(const em::val& w_x) {
+    try {
+        auto r = ::testsuite::ProtoTests::protoMapToStrings(::djinni::Map<::djinni::String, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','.','P','e','r','s','o','n'>>>::toCpp(w_x));
+        return ::djinni::Map<::djinni::String, ::djinni::String>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Map<::djinni::String, ::djinni::String>>::handleNativeException(e);
+    }
+}
+em::val NativeProtoTests::stringsToProtoMap(const em::val& w_x) {
+    try {
+        auto r = ::testsuite::ProtoTests::stringsToProtoMap(::djinni::Map<::djinni::String, ::djinni::String>::toCpp(w_x));
+        return ::djinni::Map<::djinni::String, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','.','P','e','r','s','o','n'>>>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Map<::djinni::String, ::djinni::Protobuf<::djinni::test::Person, ::djinni::JsClassName<'p','r','o','t','o','t','e','s','t','.','P','e','r','s','o','n'>>>>::handleNativeException(e);
+    }
+}
 
 EMSCRIPTEN_BINDINGS(testsuite_proto_tests) {
     ::djinni::DjinniClass_<::testsuite::ProtoTests>("testsuite_ProtoTests", "testsuite.ProtoTests")
@@ -149,6 +168,8 @@ EMSCRIPTEN_BINDINGS(testsuite_proto_tests) {
         .class_function("optionalProtoToString", NativeProtoTests::optionalProtoToString)
         .class_function("stringToOptionalProto", NativeProtoTests::stringToOptionalProto)
         .class_function("stringToProtoOutcome", NativeProtoTests::stringToProtoOutcome)
+        .class_function("protoMapToStrings", NativeProtoTests::protoMapToStrings)
+        .class_function("stringsToProtoMap", NativeProtoTests::stringsToProtoMap)
         ;
 }
 
@@ -36,6 +36,8 @@ struct NativeProtoTests : ::djinni::JsInterface<::testsuite::ProtoTests, NativeP
     static std::string optionalProtoToString(const em::val& w_x);
     static em::val stringToOptionalProto(const std::string& w_x);
     static em::val stringToProtoOutcome(const std::string& w_x);
+    static em::val protoMapToStrings(const em::val& w_x);
+    static em::val stringsToProtoMap(const em::val& w_x);
 
 };
 
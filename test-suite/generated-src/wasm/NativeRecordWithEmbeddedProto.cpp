@@ -2,6 +2,7 @@
 // This file was generated by Djinni from proto.djinni
 
 #include "NativeRecordWithEmbeddedProto.hpp"  // my header
+#include "ProtobufArena_wasm.hpp"
 
 namespace djinni_generated {
 
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#include "NativeTestInternedString.hpp"  // my header
+
+namespace djinni_generated {
+
+em::val NativeTestInternedString::cppProxyMethods() {
+    static const em::val methods = em::val::array(std::vector<std::string> {
+    });
+    return methods;
+}
+
+std::string NativeTestInternedString::status_name(int32_t w_code) {
+    try {
+        auto r = ::testsuite::TestInternedString::status_name(::djinni::I32::toCpp(w_code));
+        return ::djinni::String::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::String>::handleNativeException(e);
+    }
+}
+
+EMSCRIPTEN_BINDINGS(testsuite_test_interned_string) {
+    ::djinni::DjinniClass_<::testsuite::TestInternedString>("testsuite_TestInternedString", "testsuite.TestInternedString")
+        .smart_ptr<std::shared_ptr<::testsuite::TestInternedString>>("testsuite_TestInternedString")
+        .function("nativeDestroy", &NativeTestInternedString::nativeDestroy)
+        .class_function("statusName", NativeTestInternedString::status_name)
+        ;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from interned_string.djinni
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "test_interned_string.hpp"
+
+namespace djinni_generated {
+
+struct NativeTestInternedString : ::djinni::JsInterface<::testsuite::TestInternedString, NativeTestInternedString> {
+    using CppType = std::shared_ptr<::testsuite::TestInternedString>;
+    using CppOptType = std::shared_ptr<::testsuite::TestInternedString>;
+    using JsType = em::val;
+    using Boxed = NativeTestInternedString;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeTestInternedString::fromCpp");
+        return fromCppOpt(c);
+    }
+
+    static em::val cppProxyMethods();
+
+    static std::string status_name(int32_t w_code);
+
+};
+
+} // namespace djinni_generated
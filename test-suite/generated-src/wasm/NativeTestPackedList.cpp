@@ -0,0 +1,33 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#include "NativeTestPackedList.hpp"  // my header
+#include "NativePackedPrimitives.hpp"
+
+namespace djinni_generated {
+
+em::val NativeTestPackedList::cppProxyMethods() {
+    static const em::val methods = em::val::array(std::vector<std::string> {
+    });
+    return methods;
+}
+
+em::val NativeTestPackedList::reverse_list(const em::val& w_l) {
+    try {
+        auto r = ::testsuite::TestPackedList::reverse_list(::djinni::List<::djinni_generated::NativePackedPrimitives>::toCpp(w_l));
+        return ::djinni::List<::djinni_generated::NativePackedPrimitives>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::List<::djinni_generated::NativePackedPrimitives>>::handleNativeException(e);
+    }
+}
+
+EMSCRIPTEN_BINDINGS(testsuite_test_packed_list) {
+    ::djinni::DjinniClass_<::testsuite::TestPackedList>("testsuite_TestPackedList", "testsuite.TestPackedList")
+        .smart_ptr<std::shared_ptr<::testsuite::TestPackedList>>("testsuite_TestPackedList")
+        .function("nativeDestroy", &NativeTestPackedList::nativeDestroy)
+        .class_function("reverseList", NativeTestPackedList::reverse_list)
+        ;
+}
+
+} // namespace djinni_generated
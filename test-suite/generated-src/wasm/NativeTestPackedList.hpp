@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from packed_list.djinni
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "test_packed_list.hpp"
+
+namespace djinni_generated {
+
+struct NativeTestPackedList : ::djinni::JsInterface<::testsuite::TestPackedList, NativeTestPackedList> {
+    using CppType = std::shared_ptr<::testsuite::TestPackedList>;
+    using CppOptType = std::shared_ptr<::testsuite::TestPackedList>;
+    using JsType = em::val;
+    using Boxed = NativeTestPackedList;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeTestPackedList::fromCpp");
+        return fromCppOpt(c);
+    }
+
+    static em::val cppProxyMethods();
+
+    static em::val reverse_list(const em::val& w_l);
+
+};
+
+} // namespace djinni_generated
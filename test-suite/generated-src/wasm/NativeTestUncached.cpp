@@ -0,0 +1,64 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#include "NativeTestUncached.hpp"  // my header
+#include "NativeUncachedToken.hpp"
+
+namespace djinni_generated {
+
+em::val NativeTestUncached::cppProxyMethods() {
+    static const em::val methods = em::val::array(std::vector<std::string> {
+    });
+    return methods;
+}
+
+em::val NativeTestUncached::create_cpp_token() {
+    try {
+        auto r = ::testsuite::TestUncached::create_cpp_token();
+        return ::djinni_generated::NativeUncachedToken::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni_generated::NativeUncachedToken>::handleNativeException(e);
+    }
+}
+em::val NativeTestUncached::token_id(const em::val& w_t) {
+    try {
+        auto r = ::testsuite::TestUncached::token_id(::djinni_generated::NativeUncachedToken::toCpp(w_t));
+        return ::djinni_generated::NativeUncachedToken::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni_generated::NativeUncachedToken>::handleNativeException(e);
+    }
+}
+bool NativeTestUncached::same_token(const em::val& w_a,const em::val& w_b) {
+    try {
+        auto r = ::testsuite::TestUncached::same_token(::djinni_generated::NativeUncachedToken::toCpp(w_a),
+                   ::djinni_generated::NativeUncachedToken::toCpp(w_b));
+        return ::djinni::Bool::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Bool>::handleNativeException(e);
+    }
+}
+em::val NativeTestUncached::token_twice(const em::val& w_t) {
+    try {
+        auto r = ::testsuite::TestUncached::token_twice(::djinni_generated::NativeUncachedToken::toCpp(w_t));
+        return ::djinni::List<::djinni_generated::NativeUncachedToken>::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::List<::djinni_generated::NativeUncachedToken>>::handleNativeException(e);
+    }
+}
+
+EMSCRIPTEN_BINDINGS(testsuite_test_uncached) {
+    ::djinni::DjinniClass_<::testsuite::TestUncached>("testsuite_TestUncached", "testsuite.TestUncached")
+        .smart_ptr<std::shared_ptr<::testsuite::TestUncached>>("testsuite_TestUncached")
+        .function("nativeDestroy", &NativeTestUncached::nativeDestroy)
+        .class_function("createCppToken", NativeTestUncached::create_cpp_token)
+        .class_function("tokenId", NativeTestUncached::token_id)
+        .class_function("sameToken", NativeTestUncached::same_token)
+        .class_function("tokenTwice", NativeTestUncached::token_twice)
+        ;
+}
+
+} // namespace djinni_generated
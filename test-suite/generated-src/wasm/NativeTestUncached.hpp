@@ -0,0 +1,33 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "test_uncached.hpp"
+
+namespace djinni_generated {
+
+struct NativeTestUncached : ::djinni::JsInterface<::testsuite::TestUncached, NativeTestUncached> {
+    using CppType = std::shared_ptr<::testsuite::TestUncached>;
+    using CppOptType = std::shared_ptr<::testsuite::TestUncached>;
+    using JsType = em::val;
+    using Boxed = NativeTestUncached;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeTestUncached::fromCpp");
+        return fromCppOpt(c);
+    }
+
+    static em::val cppProxyMethods();
+
+    static em::val create_cpp_token();
+    static em::val token_id(const em::val& w_t);
+    static bool same_token(const em::val& w_a,const em::val& w_b);
+    static em::val token_twice(const em::val& w_t);
+
+};
+
+} // namespace djinni_generated
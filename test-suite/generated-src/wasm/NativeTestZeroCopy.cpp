@@ -0,0 +1,44 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#include "NativeTestZeroCopy.hpp"  // my header
+#include "NativeZeroCopySource.hpp"
+
+namespace djinni_generated {
+
+em::val NativeTestZeroCopy::cppProxyMethods() {
+    static const em::val methods = em::val::array(std::vector<std::string> {
+    });
+    return methods;
+}
+
+em::val NativeTestZeroCopy::make_bytes(int32_t w_size) {
+    try {
+        auto r = ::testsuite::TestZeroCopy::make_bytes(::djinni::I32::toCpp(w_size));
+        return ::djinni::Binary::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Binary>::handleNativeException(e);
+    }
+}
+em::val NativeTestZeroCopy::read_source(const em::val& w_source,int32_t w_size) {
+    try {
+        auto r = ::testsuite::TestZeroCopy::read_source(::djinni_generated::NativeZeroCopySource::toCpp(w_source),
+                    ::djinni::I32::toCpp(w_size));
+        return ::djinni::Binary::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::Binary>::handleNativeException(e);
+    }
+}
+
+EMSCRIPTEN_BINDINGS(testsuite_test_zero_copy) {
+    ::djinni::DjinniClass_<::testsuite::TestZeroCopy>("testsuite_TestZeroCopy", "testsuite.TestZeroCopy")
+        .smart_ptr<std::shared_ptr<::testsuite::TestZeroCopy>>("testsuite_TestZeroCopy")
+        .function("nativeDestroy", &NativeTestZeroCopy::nativeDestroy)
+        .class_function("makeBytes", NativeTestZeroCopy::make_bytes)
+        .class_function("readSource", NativeTestZeroCopy::read_source)
+        ;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "test_zero_copy.hpp"
+
+namespace djinni_generated {
+
+struct NativeTestZeroCopy : ::djinni::JsInterface<::testsuite::TestZeroCopy, NativeTestZeroCopy> {
+    using CppType = std::shared_ptr<::testsuite::TestZeroCopy>;
+    using CppOptType = std::shared_ptr<::testsuite::TestZeroCopy>;
+    using JsType = em::val;
+    using Boxed = NativeTestZeroCopy;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeTestZeroCopy::fromCpp");
+        return fromCppOpt(c);
+    }
+
+    static em::val cppProxyMethods();
+
+    static em::val make_bytes(int32_t w_size);
+    static em::val read_source(const em::val& w_source,int32_t w_size);
+
+};
+
+} // namespace djinni_generated
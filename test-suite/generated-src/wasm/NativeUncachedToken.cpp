@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#include "NativeUncachedToken.hpp"  // my header
+
+namespace djinni_generated {
+
+em::val NativeUncachedToken::cppProxyMethods() {
+    static const em::val methods = em::val::array(std::vector<std::string> {
+        "whoami",
+    });
+    return methods;
+}
+
+std::string NativeUncachedToken::whoami(const CppType& self) {
+    try {
+        auto r = self->whoami();
+        return ::djinni::String::fromCpp(r);
+    }
+    catch(const std::exception& e) {
+        return ::djinni::ExceptionHandlingTraits<::djinni::String>::handleNativeException(e);
+    }
+}
+
+std::string NativeUncachedToken::JsProxy::whoami() {
+    auto ret = callMethod("whoami");
+    checkError(ret);
+    return ::djinni::String::toCpp(ret.as<std::string>());
+}
+
+EMSCRIPTEN_BINDINGS(testsuite_uncached_token) {
+    ::djinni::DjinniClass_<::testsuite::UncachedToken>("testsuite_UncachedToken", "testsuite.UncachedToken")
+        .smart_ptr<std::shared_ptr<::testsuite::UncachedToken>>("testsuite_UncachedToken")
+        .function("nativeDestroy", &NativeUncachedToken::nativeDestroy)
+        .function("whoami", NativeUncachedToken::whoami)
+        ;
+}
+
+} // namespace djinni_generated
@@ -0,0 +1,35 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from uncached.djinni
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "uncached_token.hpp"
+
+namespace djinni_generated {
+
+struct NativeUncachedToken : ::djinni::JsInterface<::testsuite::UncachedToken, NativeUncachedToken> {
+    using CppType = std::shared_ptr<::testsuite::UncachedToken>;
+    using CppOptType = std::shared_ptr<::testsuite::UncachedToken>;
+    using JsType = em::val;
+    using Boxed = NativeUncachedToken;
+    static constexpr bool kUsesProxyCache = false;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeUncachedToken::fromCpp");
+        return fromCppOpt(c);
+    }
+
+    static em::val cppProxyMethods();
+
+    static std::string whoami(const CppType& self);
+
+    struct JsProxy: ::djinni::JsProxyBase, ::testsuite::UncachedToken, ::djinni::InstanceTracker<JsProxy> {
+        JsProxy(const em::val& v) : JsProxyBase(v, false) {}
+        std::string whoami() override;
+    };
+};
+
+} // namespace djinni_generated
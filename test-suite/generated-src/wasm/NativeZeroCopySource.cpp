@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#include "NativeZeroCopySource.hpp"  // my header
+
+namespace djinni_generated {
+
+
+EMSCRIPTEN_BINDINGS(testsuite_zero_copy_source) {
+    ::djinni::DjinniClass_<::testsuite::ZeroCopySource>("testsuite_ZeroCopySource", "testsuite.ZeroCopySource")
+        .smart_ptr<std::shared_ptr<::testsuite::ZeroCopySource>>("testsuite_ZeroCopySource")
+        .function("nativeDestroy", &NativeZeroCopySource::nativeDestroy)
+        ;
+}
+
+} // namespace djinni_generated
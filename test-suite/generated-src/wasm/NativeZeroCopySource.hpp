@@ -0,0 +1,27 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file was generated by Djinni from zero_copy.djinni
+
+#pragma once
+
+#include "djinni_wasm.hpp"
+#include "zero_copy_source.hpp"
+
+namespace djinni_generated {
+
+struct NativeZeroCopySource : ::djinni::JsInterface<::testsuite::ZeroCopySource, NativeZeroCopySource> {
+    using CppType = std::shared_ptr<::testsuite::ZeroCopySource>;
+    using CppOptType = std::shared_ptr<::testsuite::ZeroCopySource>;
+    using JsType = em::val;
+    using Boxed = NativeZeroCopySource;
+
+    static CppType toCpp(JsType j) { return _fromJs(j); }
+    static JsType fromCppOpt(const CppOptType& c) { return {_toJs(c)}; }
+    static JsType fromCpp(const CppType& c) {
+        ::djinni::checkForNull(c.get(), "NativeZeroCopySource::fromCpp");
+        return fromCppOpt(c);
+    }
+
+
+};
+
+} // namespace djinni_generated
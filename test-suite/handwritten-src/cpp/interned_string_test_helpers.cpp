@@ -0,0 +1,15 @@
+#include "test_interned_string.hpp"
+
+namespace testsuite {
+
+std::string TestInternedString::status_name(int32_t code) {
+    switch (code) {
+        case 0: return "ok";
+        case 1: return "not_found";
+        case 2: return "café";
+        default: return "status " + std::to_string(code) + " is not one of the known codes, "
+                        "so it is described at length";
+    }
+}
+
+} // namespace testsuite
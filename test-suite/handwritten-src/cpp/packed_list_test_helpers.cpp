@@ -0,0 +1,10 @@
+#include "test_packed_list.hpp"
+#include "packed_primitives.hpp"
+
+namespace testsuite {
+
+std::vector<PackedPrimitives> TestPackedList::reverse_list(const std::vector<PackedPrimitives>& l) {
+    return {l.rbegin(), l.rend()};
+}
+
+} // namespace testsuite
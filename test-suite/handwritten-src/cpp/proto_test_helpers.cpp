@@ -92,4 +92,24 @@ djinni::expected<::djinni::test::Person, int32_t> ProtoTests::stringToProtoOutco
     return proto;    
 }
 
+std::unordered_map<std::string, std::string> ProtoTests::protoMapToStrings(const std::unordered_map<std::string, ::djinni::test::Person>& x) {
+    std::unordered_map<std::string, std::string> ret;
+    for (const auto& i : x) {
+        ret.emplace(i.first, i.second.name());
+    }
+    return ret;
+}
+
+std::unordered_map<std::string, ::djinni::test::Person> ProtoTests::stringsToProtoMap(const std::unordered_map<std::string, std::string>& x) {
+    std::unordered_map<std::string, ::djinni::test::Person> ret;
+    int id = 0;
+    for (const auto& i : x) {
+        ::djinni::test::Person proto;
+        proto.set_name(i.second);
+        proto.set_id(++id);
+        ret.emplace(i.first, proto);
+    }
+    return ret;
+}
+
 }
@@ -0,0 +1,30 @@
+#include "test_uncached.hpp"
+#include "uncached_token.hpp"
+
+namespace testsuite {
+
+namespace {
+
+class CppUncachedToken : public UncachedToken {
+    std::string whoami() override { return "C++"; }
+};
+
+} // namespace
+
+std::shared_ptr<UncachedToken> TestUncached::create_cpp_token() {
+    return std::make_shared<CppUncachedToken>();
+}
+
+std::shared_ptr<UncachedToken> TestUncached::token_id(const std::shared_ptr<UncachedToken>& t) {
+    return t;
+}
+
+bool TestUncached::same_token(const std::shared_ptr<UncachedToken>& a, const std::shared_ptr<UncachedToken>& b) {
+    return a == b;
+}
+
+std::vector<std::shared_ptr<UncachedToken>> TestUncached::token_twice(const std::shared_ptr<UncachedToken>& t) {
+    return {t, t};
+}
+
+} // namespace testsuite
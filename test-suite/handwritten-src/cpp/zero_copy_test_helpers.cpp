@@ -0,0 +1,18 @@
+#include "test_zero_copy.hpp"
+#include "zero_copy_source.hpp"
+
+namespace testsuite {
+
+std::vector<uint8_t> TestZeroCopy::make_bytes(int32_t size) {
+    std::vector<uint8_t> bytes(static_cast<size_t>(size));
+    for (size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> TestZeroCopy::read_source(const std::shared_ptr<ZeroCopySource>& source, int32_t size) {
+    return source->get_bytes(size);
+}
+
+} // namespace testsuite
@@ -28,6 +28,10 @@ public class AllTests extends TestSuite {
         mySuite.addTestSuite(OutcomeTest.class);
         mySuite.addTestSuite(ProtoTest.class);
         mySuite.addTestSuite(ArrayTest.class);
+        mySuite.addTestSuite(PackedListTest.class);
+        mySuite.addTestSuite(ZeroCopyTest.class);
+        mySuite.addTestSuite(UncachedTest.class);
+        mySuite.addTestSuite(InternedStringTest.class);
         mySuite.addTestSuite(DataTest.class);
         mySuite.addTestSuite(AsyncTest.class);
         mySuite.addTestSuite(InterfaceAndAbstractClass.class);
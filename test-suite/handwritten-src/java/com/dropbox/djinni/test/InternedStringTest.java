@@ -0,0 +1,39 @@
+package com.dropbox.djinni.test;
+
+import com.snapchat.djinni.StringCacheCounters;
+import junit.framework.TestCase;
+
+public class InternedStringTest extends TestCase {
+
+    public void testValues() {
+        assertEquals("ok", TestInternedString.statusName(0));
+        assertEquals("not_found", TestInternedString.statusName(1));
+        assertEquals("café", TestInternedString.statusName(2));
+        assertEquals("status 7 is not one of the known codes, so it is described at length",
+                     TestInternedString.statusName(7));
+    }
+
+    // The second conversion of the same short string is served from the cache.
+    public void testRepeatedStringHitsCache() {
+        TestInternedString.statusName(0);
+        StringCacheCounters before = StringCacheCounters.get();
+        String first = TestInternedString.statusName(0);
+        String second = TestInternedString.statusName(0);
+        StringCacheCounters after = StringCacheCounters.get();
+        assertEquals("ok", second);
+        assertSame(first, second);
+        assertTrue(after.hits >= before.hits + 2);
+    }
+
+    // Strings longer than the cache's limit are converted each time, bypassing the counters.
+    public void testLongStringSkipsCache() {
+        StringCacheCounters before = StringCacheCounters.get();
+        String first = TestInternedString.statusName(8);
+        String second = TestInternedString.statusName(8);
+        StringCacheCounters after = StringCacheCounters.get();
+        assertEquals(first, second);
+        assertNotSame(first, second);
+        assertEquals(before.hits, after.hits);
+        assertEquals(before.misses, after.misses);
+    }
+}
@@ -0,0 +1,50 @@
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import junit.framework.TestCase;
+
+public class PackedListTest extends TestCase {
+
+    private static ArrayList<PackedPrimitives> makeList(int size) {
+        Color[] colors = Color.values();
+        ArrayList<PackedPrimitives> list = new ArrayList<PackedPrimitives>(size);
+        for (int i = 0; i < size; i++) {
+            list.add(new PackedPrimitives(i % 2 == 0,
+                                          (byte) (Byte.MIN_VALUE + i),
+                                          (short) (Short.MAX_VALUE - i),
+                                          -1.5f * i,
+                                          Math.PI * i,
+                                          colors[i % colors.length]));
+        }
+        return list;
+    }
+
+    private static void checkReverse(ArrayList<PackedPrimitives> list) {
+        ArrayList<PackedPrimitives> expected = new ArrayList<PackedPrimitives>(list);
+        Collections.reverse(expected);
+        assertEquals(expected, TestPackedList.reverseList(list));
+    }
+
+    public void testEmpty() {
+        assertEquals(new ArrayList<PackedPrimitives>(), TestPackedList.reverseList(new ArrayList<PackedPrimitives>()));
+    }
+
+    public void testRoundTrip() {
+        checkReverse(makeList(20));
+    }
+
+    public void testExtremes() {
+        ArrayList<PackedPrimitives> list = new ArrayList<PackedPrimitives>();
+        list.add(new PackedPrimitives(true, Byte.MIN_VALUE, Short.MIN_VALUE, -Float.MAX_VALUE, Double.NEGATIVE_INFINITY, Color.RED));
+        list.add(new PackedPrimitives(false, Byte.MAX_VALUE, Short.MAX_VALUE, Float.MIN_VALUE, Double.MIN_VALUE, Color.VIOLET));
+        list.add(new PackedPrimitives(true, (byte) -1, (short) -1, Float.POSITIVE_INFINITY, -Double.MAX_VALUE, Color.INDIGO));
+        checkReverse(list);
+    }
+
+    // 36000 slots is past the default 256 KB critical copy threshold, so the long[] is copied in
+    // chunks, and 6 fields per record don't divide the chunk size evenly.
+    public void testLargeList() {
+        checkReverse(makeList(6000));
+    }
+}
@@ -1,6 +1,7 @@
 package com.dropbox.djinni.test;
 
 import java.util.ArrayList;
+import java.util.HashMap;
 import junit.framework.TestCase;
 import djinni.test.Test.AddressBook;
 import djinni.test.Test.Person;
@@ -30,6 +31,23 @@ public class ProtoTest extends TestCase {
         assertEquals(proto.getSerializedSize(), 0);
     }
 
+    public void testLargeMessages() {
+        // AddressBook uses GpbMessageLiteDirectSerializer (see proto.yaml), so a message this
+        // big goes through direct buffers in both directions.
+        ArrayList<String> names = new ArrayList<String>();
+        for (int i = 0; i < 10000; i++) {
+            names.add("person" + i);
+        }
+        AddressBook proto = ProtoTests.stringsToProto(names);
+        assertEquals(proto.getPeopleCount(), 10000);
+        assertEquals(proto.getPeople(9999).getName(), "person9999");
+        assertEquals(proto.getPeople(9999).getId(), 10000);
+        ArrayList<String> r = ProtoTests.protoToStrings(proto);
+        assertEquals(r, names);
+        // And again, to reuse the scratch memory left behind by the first round trip
+        assertEquals(ProtoTests.protoToStrings(ProtoTests.stringsToProto(names)), names);
+    }
+
     public void testEmbeddedProto() {
         Person p = Person.newBuilder().setName("tom").setId(1).build();
         RecordWithEmbeddedProto rec = new RecordWithEmbeddedProto(p);
@@ -60,5 +78,16 @@ public class ProtoTest extends TestCase {
 
         Outcome<Person, Integer> r = ProtoTests.stringToProtoOutcome("tom");
         assertEquals(r.resultOr(null).getName(), "tom");
+
+        HashMap<String, Person> pmap = new HashMap<>();
+        pmap.put("cat", p1);
+        pmap.put("mouse", p2);
+        HashMap<String, String> smap = ProtoTests.protoMapToStrings(pmap);
+        assertEquals(smap.get("cat"), "tom");
+        assertEquals(smap.get("mouse"), "jerry");
+
+        pmap = ProtoTests.stringsToProtoMap(smap);
+        assertEquals(pmap.get("cat").getName(), "tom");
+        assertEquals(pmap.get("mouse").getName(), "jerry");
     }
 }
@@ -0,0 +1,36 @@
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import junit.framework.TestCase;
+
+public class UncachedTest extends TestCase {
+
+    private class JavaToken extends UncachedToken {
+        public String whoami() { return "Java"; }
+    }
+
+    // Each crossing into C++ gets its own proxy, but C++ hands the original back.
+    public void testJavaToken() {
+        UncachedToken jt = new JavaToken();
+        assertFalse(TestUncached.sameToken(jt, jt));
+        assertSame(jt, TestUncached.tokenId(jt));
+        ArrayList<UncachedToken> twice = TestUncached.tokenTwice(jt);
+        assertSame(jt, twice.get(0));
+        assertSame(jt, twice.get(1));
+    }
+
+    // Each crossing into Java gets its own CppProxy, which all unwrap to the same C++ object.
+    public void testCppToken() {
+        UncachedToken ct = TestUncached.createCppToken();
+        assertEquals("C++", ct.whoami());
+        assertTrue(TestUncached.sameToken(ct, ct));
+        UncachedToken returned = TestUncached.tokenId(ct);
+        assertNotSame(ct, returned);
+        assertTrue(TestUncached.sameToken(ct, returned));
+        ArrayList<UncachedToken> twice = TestUncached.tokenTwice(ct);
+        assertNotSame(twice.get(0), twice.get(1));
+        assertNotSame(ct, twice.get(0));
+        assertTrue(TestUncached.sameToken(twice.get(0), twice.get(1)));
+        assertEquals("C++", twice.get(1).whoami());
+    }
+}
@@ -0,0 +1,107 @@
+package com.dropbox.djinni.test;
+
+import com.snapchat.djinni.ZeroCopyBinary;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import junit.framework.TestCase;
+
+public class ZeroCopyTest extends TestCase {
+
+    private static byte[] expectedBytes(int size) {
+        byte[] bytes = new byte[size];
+        for (int i = 0; i < size; i++) {
+            bytes[i] = (byte) i;
+        }
+        return bytes;
+    }
+
+    private static byte[] remainingBytes(ByteBuffer buffer) {
+        byte[] bytes = new byte[buffer.remaining()];
+        buffer.duplicate().get(bytes);
+        return bytes;
+    }
+
+    private static int threshold() {
+        return (int) ZeroCopyBinary.getThreshold();
+    }
+
+    // Hands out the expected bytes from the middle of a bigger array, so that C++ has to honour
+    // both the buffer's position() and its arrayOffset().
+    private static class ArraySource extends ZeroCopySource {
+        @Override
+        public ByteBuffer getBytes(int size) {
+            byte[] backing = new byte[size + 8];
+            Arrays.fill(backing, (byte) 0x55);
+            System.arraycopy(expectedBytes(size), 0, backing, 5, size);
+            ByteBuffer wrapped = ByteBuffer.wrap(backing);
+            wrapped.position(2);
+            ByteBuffer slice = wrapped.slice();
+            slice.position(3);
+            slice.limit(3 + size);
+            return slice;
+        }
+    }
+
+    private static class DirectSource extends ZeroCopySource {
+        @Override
+        public ByteBuffer getBytes(int size) {
+            ByteBuffer buffer = ByteBuffer.allocateDirect(size + 8);
+            buffer.position(4);
+            buffer.put(expectedBytes(size));
+            buffer.flip();
+            buffer.position(4);
+            return buffer;
+        }
+    }
+
+    private static void checkResult(int size, boolean direct) {
+        ByteBuffer buffer = TestZeroCopy.makeBytes(size);
+        assertEquals(direct, buffer.isDirect());
+        assertTrue(Arrays.equals(expectedBytes(size), remainingBytes(buffer)));
+    }
+
+    public void testEmptyResult() {
+        checkResult(0, false);
+    }
+
+    public void testResultBelowThreshold() {
+        checkResult(threshold() - 1, false);
+    }
+
+    public void testResultAtThreshold() {
+        checkResult(threshold(), true);
+    }
+
+    public void testResultAboveThreshold() {
+        checkResult(threshold() * 4 + 3, true);
+    }
+
+    public void testChangedThreshold() {
+        long saved = ZeroCopyBinary.getThreshold();
+        try {
+            ZeroCopyBinary.setThreshold(64);
+            assertEquals(64, ZeroCopyBinary.getThreshold());
+            checkResult(63, false);
+            checkResult(64, true);
+        } finally {
+            ZeroCopyBinary.setThreshold(saved);
+        }
+    }
+
+    public void testArrayBackedSource() {
+        ArraySource source = new ArraySource();
+        ByteBuffer buffer = source.getBytes(16);
+        assertEquals(3, buffer.position());
+        assertEquals(2, buffer.arrayOffset());
+        for (int size : new int[] {0, 16, threshold() - 1, threshold(), threshold() * 4 + 3}) {
+            assertTrue(Arrays.equals(expectedBytes(size), TestZeroCopy.readSource(source, size)));
+        }
+    }
+
+    public void testDirectSource() {
+        DirectSource source = new DirectSource();
+        for (int size : new int[] {0, 16, threshold() - 1, threshold(), threshold() * 4 + 3}) {
+            assertTrue(Arrays.equals(expectedBytes(size), TestZeroCopy.readSource(source, size)));
+        }
+    }
+}
@@ -93,6 +93,15 @@
 
     DJOutcome<DJTestPerson*, NSNumber*>* r = [DBProtoTests stringToProtoOutcome:@"tom"];
     XCTAssertEqualObjects(r, [DJOutcome fromResult:tom]);
+
+    NSDictionary<NSString*, DJTestPerson*>* pmap = @{@"cat": tom, @"mouse": jerry};
+    NSDictionary<NSString*, NSString*>* smap = [DBProtoTests protoMapToStrings:pmap];
+    NSDictionary<NSString*, NSString*>* namesByRole = @{@"cat": @"tom", @"mouse": @"jerry"};
+    XCTAssertEqualObjects(smap, namesByRole);
+
+    NSDictionary<NSString*, DJTestPerson*>* pmap2 = [DBProtoTests stringsToProtoMap:smap];
+    XCTAssertEqualObjects(pmap2[@"cat"].name, @"tom");
+    XCTAssertEqualObjects(pmap2[@"mouse"].name, @"jerry");
 }
 
 @end
@@ -0,0 +1,47 @@
+#import "DBTestUncached.h"
+#import "DBUncachedToken.h"
+#import <XCTest/XCTest.h>
+
+@interface DBUncachedTests : XCTestCase
+
+@end
+
+@interface DBObjcUncachedToken : NSObject<DBUncachedToken>
+- (NSString *)whoami;
+@end
+@implementation DBObjcUncachedToken
+- (NSString *)whoami {
+    return @"ObjC";
+}
+@end
+
+@implementation DBUncachedTests
+
+// Each crossing into C++ gets its own proxy, but C++ hands the original back.
+- (void)testObjcToken
+{
+    id<DBUncachedToken> t = [[DBObjcUncachedToken alloc] init];
+    XCTAssertFalse([DBTestUncached sameToken:t b:t]);
+    XCTAssertEqual([DBTestUncached tokenId:t], t);
+    NSArray<id<DBUncachedToken>> *twice = [DBTestUncached tokenTwice:t];
+    XCTAssertEqual(twice[0], t);
+    XCTAssertEqual(twice[1], t);
+}
+
+// Each crossing into ObjC gets its own wrapper, which all unwrap to the same C++ object.
+- (void)testCppToken
+{
+    id<DBUncachedToken> ct = [DBTestUncached createCppToken];
+    XCTAssertEqualObjects([ct whoami], @"C++");
+    XCTAssertTrue([DBTestUncached sameToken:ct b:ct]);
+    id<DBUncachedToken> returned = [DBTestUncached tokenId:ct];
+    XCTAssertNotEqual(returned, ct);
+    XCTAssertTrue([DBTestUncached sameToken:ct b:returned]);
+    NSArray<id<DBUncachedToken>> *twice = [DBTestUncached tokenTwice:ct];
+    XCTAssertNotEqual(twice[0], twice[1]);
+    XCTAssertNotEqual(twice[0], ct);
+    XCTAssertTrue([DBTestUncached sameToken:twice[0] b:twice[1]]);
+    XCTAssertEqualObjects([twice[1] whoami], @"C++");
+}
+
+@end
@@ -60,6 +60,15 @@ export class ProtoTest extends TestCase {
 
         const r = this.m.testsuite.ProtoTests.stringToProtoOutcome('tom');
         assertEq(r, {result: {name: 'tom', id: 1, email:'', phones:[]}});
+
+        const pmap = new Map<string, prototest.Person>([['cat', p1], ['mouse', p2]]);
+        const smap = this.m.testsuite.ProtoTests.protoMapToStrings(pmap);
+        assertEq(smap.get('cat'), 'tom');
+        assertEq(smap.get('mouse'), 'jerry');
+
+        const pmap2 = this.m.testsuite.ProtoTests.stringsToProtoMap(smap);
+        assertEq(pmap2.get('cat')?.name, 'tom');
+        assertEq(pmap2.get('mouse')?.name, 'jerry');
     }
 }
 
@@ -0,0 +1,44 @@
+import {TestCase, allTests, assertTrue, assertFalse, assertSame, assertNotSame, assertEq} from "./testutils"
+import * as test from "../../generated-src/ts/test";
+
+class JsUncachedToken {
+    whoami() {
+        return "Javascript";
+    }
+}
+
+export class UncachedTest extends TestCase {
+    m: test.Test_statics;
+
+    constructor(module: test.Test_statics) {
+        super(module);
+        this.m = module;
+    }
+
+    // Each crossing into C++ gets its own proxy, but C++ hands the original back.
+    testJsToken() {
+        var t = new JsUncachedToken();
+        assertFalse(this.m.testsuite.TestUncached.sameToken(t, t));
+        assertSame(this.m.testsuite.TestUncached.tokenId(t), t);
+        var twice = this.m.testsuite.TestUncached.tokenTwice(t);
+        assertSame(twice[0], t);
+        assertSame(twice[1], t);
+    }
+
+    // Each crossing into JS gets its own proxy, which all unwrap to the same C++ object.
+    testCppToken() {
+        var ct = this.m.testsuite.TestUncached.createCppToken();
+        assertEq(ct.whoami(), "C++");
+        assertTrue(this.m.testsuite.TestUncached.sameToken(ct, ct));
+        var returned = this.m.testsuite.TestUncached.tokenId(ct);
+        assertNotSame(returned, ct);
+        assertTrue(this.m.testsuite.TestUncached.sameToken(ct, returned));
+        var twice = this.m.testsuite.TestUncached.tokenTwice(ct);
+        assertNotSame(twice[0], twice[1]);
+        assertNotSame(twice[0], ct);
+        assertTrue(this.m.testsuite.TestUncached.sameToken(twice[0], twice[1]));
+        assertEq(twice[1].whoami(), "C++");
+    }
+}
+
+allTests.push(UncachedTest);
@@ -16,6 +16,7 @@ import "./PrimitivesTest"
 import "./ProtoTest"
 import "./SetRecordTest"
 import "./TokenTest"
+import "./UncachedTest"
 import "./WcharTest"
 
 declare function Module(): Promise<DjinniModule>;